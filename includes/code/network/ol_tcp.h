@@ -9,21 +9,12 @@ extern "C" {
     #include <stdint.h>
     #include <stdbool.h>
 
+    #include "ol_poller.h" /* OL_POLL_* masks */
+
     /* Forward decls for OLSRT core types */
     typedef struct ol_event_loop ol_event_loop_t;
     typedef struct ol_future      ol_future_t;
-    typedef struct ol_mutex       ol_mutex_t;
-
-    /* Poll masks (must match ol_poller.h) */
-    #ifndef OL_POLL_IN
-    #define OL_POLL_IN  0x01u
-    #endif
-    #ifndef OL_POLL_OUT
-    #define OL_POLL_OUT 0x02u
-    #endif
-    #ifndef OL_POLL_ERR
-    #define OL_POLL_ERR 0x04u
-    #endif
+    typedef struct ol_event_loop_group ol_event_loop_group_t;
 
     /* Endpoint abstraction */
     typedef struct ol_endpoint {
@@ -53,6 +44,16 @@ extern "C" {
     int         ol_tcp_socket_listen(ol_tcp_socket_t *s, int backlog);
     /* Accept: returns future that fulfills with (ol_tcp_socket_t*) of the new connection. */
     ol_future_t* ol_tcp_socket_accept(ol_tcp_socket_t *s, int64_t deadline_ns);
+    /* SO_REUSEPORT: lets several sockets bind the same endpoint; the kernel
+     * spreads incoming connections across them. Call before bind. */
+    int         ol_tcp_socket_set_reuseport(ol_tcp_socket_t *s, bool on);
+    /* Open, bind and listen one SO_REUSEPORT listener per loop of the group,
+     * so each loop accepts its own share of connections. Writes up to 'max'
+     * listeners (out[i] belongs to loop i); returns how many were created,
+     * 0 on error. Where SO_REUSEPORT is unavailable, listen on one loop and
+     * hand accepted sockets to ol_event_loop_group_next() instead. */
+    size_t      ol_tcp_listen_sharded(ol_event_loop_group_t *group, const ol_endpoint_t *ep,
+                                      int backlog, ol_tcp_socket_t **out, size_t max);
 
     /* Client side */
     /* Connect: future fulfills with 0 on success; rejects on error code or -3 on timeout. */
@@ -54,6 +54,11 @@ typedef struct ol_process ol_process_t;
  */
 typedef struct ol_arena ol_arena_t;
 
+/**
+ * @brief Opaque type representing a broadcast group of actors
+ */
+typedef struct ol_actor_group ol_actor_group_t;
+
 /* ==================== Type Definitions ==================== */
 
 /**
@@ -100,6 +105,10 @@ typedef void (*ol_actor_value_destructor)(void* value);
  * the promise that will be resolved with the response.
  * It enables asynchronous request/response communication
  * between actors.
+ * 
+ * Envelopes are created only by ol_actor_ask() and ol_actor_call(); they are
+ * pooled by the target actor and recycled once replied to. Inside a
+ * behavior, ol_actor_current_ask() tells an ask apart from a plain message.
  */
 typedef struct ol_ask_envelope {
     void* payload;                 /**< Message payload (the actual request data) */
@@ -122,6 +131,7 @@ typedef struct ol_actor_stats {
     size_t mailbox_capacity;       /**< Maximum mailbox capacity (0 = unbounded) */
     size_t mailbox_peak;           /**< Peak mailbox size reached */
     size_t overflow_events;        /**< Number of mailbox overflow events */
+    size_t priority_messages;      /**< Messages sent with ol_actor_send_priority() */
 } ol_actor_stats_t;
 
 /* ==================== Actor Creation & Lifecycle ==================== */
@@ -129,7 +139,7 @@ typedef struct ol_actor_stats {
 /**
  * @brief Create a new actor instance
  * 
- * @param pool Parallel pool for execution (currently deprecated, kept for compatibility)
+ * @param pool Pool that runs the actor, or NULL for a dedicated process
  * @param capacity Mailbox capacity (0 = unbounded)
  * @param dtor Message destructor function (can be NULL)
  * @param initial Initial behavior function (must not be NULL)
@@ -138,6 +148,12 @@ typedef struct ol_actor_stats {
  * 
  * @note The actor is created in a stopped state. Call ol_actor_start() to begin
  *       message processing.
+ * @note With a pool, actors are scheduled M:N: an actor with an empty mailbox
+ *       holds no process, stack or thread. A send that makes the mailbox
+ *       non-empty queues the actor on the pool, where it handles a bounded
+ *       number of messages before yielding to other ready actors. Such
+ *       actors have no process (ol_actor_get_process() returns NULL), and
+ *       behaviors run on pool threads, so they must not block.
  * @warning The initial behavior function must not be NULL.
  */
 ol_actor_t* ol_actor_create(ol_parallel_pool_t* pool,
@@ -195,13 +211,20 @@ int ol_actor_close(ol_actor_t* actor);
  * 
  * @note If the actor is running, it will be stopped first.
  *       This function handles NULL input gracefully (no-op).
+ *       A pooled actor waits for its queued or running slice; this is safe
+ *       on the pool's own workers (they run queued tasks meanwhile) and
+ *       after ol_parallel_shutdown(), but not from the actor's own behavior.
+ * @warning Every send to the actor must have returned before this is
+ *          called; a send that overlaps the teardown may touch the freed
+ *          mailbox. An ol_actor_call() still waiting for its reply is fine:
+ *          its request is cancelled and the call returns -1.
  */
 void ol_actor_destroy(ol_actor_t* actor);
 
 /* ==================== Message Passing ==================== */
 
 /**
- * @brief Send message to actor (blocking)
+ * @brief Send message to actor (never blocks)
  * 
  * @param actor Actor instance to receive the message
  * @param msg Message to send (ownership transferred to actor)
@@ -209,13 +232,33 @@ void ol_actor_destroy(ol_actor_t* actor);
  *         - 0: Success
  *         - -1: Error (e.g., actor is NULL, closed, or mailbox full)
  * 
- * @note This function blocks if the mailbox is full (for bounded mailboxes).
- *       For non-blocking send, use ol_actor_try_send().
+ * @note A full bounded mailbox rejects the message at once: the call
+ *       returns -1 and msg is destroyed with the actor's msg_dtor (if any),
+ *       as it is for a closed actor. To wait for space, use
+ *       ol_actor_send_timeout(); to keep the message when the mailbox is
+ *       full, use ol_actor_try_send().
  * @warning The message must be allocated with ol_arena_alloc() if the actor
  *          uses arena-based memory management.
  */
 int ol_actor_send(ol_actor_t* actor, void* msg);
 
+/**
+ * @brief Send a control message ahead of queued user messages
+ * 
+ * @param actor Actor instance to receive the message
+ * @param msg Message to send (ownership transferred to actor)
+ * @return int Operation result:
+ *         - 0: Success
+ *         - -1: Error (e.g., actor is NULL or closed, out of memory)
+ * 
+ * @note The mailbox keeps a separate priority lane that the actor always
+ *       drains first, so stop requests, exit notices and similar control
+ *       traffic are handled after at most the batch in progress rather
+ *       than behind the whole data backlog. The priority lane is not
+ *       bounded by the mailbox capacity and never reports "full".
+ */
+int ol_actor_send_priority(ol_actor_t* actor, void* msg);
+
 /**
  * @brief Send message to actor with timeout
  * 
@@ -261,6 +304,29 @@ int ol_actor_try_send(ol_actor_t* actor, void* msg);
  */
 ol_future_t* ol_actor_ask(ol_actor_t* actor, void* msg);
 
+/**
+ * @brief Send a request and wait for the reply (synchronous ask)
+ * 
+ * @param actor Actor instance to send the request to
+ * @param msg Request message (ownership transferred)
+ * @param out_reply Receives the value given to ol_actor_reply_ok(); the
+ *                  caller owns it (may be NULL to discard the reply)
+ * @param out_error Receives the code given to ol_actor_reply_error() (may be NULL)
+ * @param timeout_ms Timeout in milliseconds (0 = infinite)
+ * @return int Operation result:
+ *         - 0: Reply received
+ *         - -1: Error (not sent, or the actor did not reply)
+ *         - -2: Actor replied with an error (see out_error)
+ *         - -3: Timeout expired before the reply arrived
+ * 
+ * @note Allocation-free fast path: the reply is stored directly in the
+ *       pooled envelope the caller waits on, without a promise or future.
+ * @warning Blocks the calling thread. Calling it from a pooled actor can
+ *          deadlock if the target needs the same pool thread to run.
+ */
+int ol_actor_call(ol_actor_t* actor, void* msg, void** out_reply,
+                  int* out_error, uint32_t timeout_ms);
+
 /* ==================== Behavior Control ==================== */
 
 /**
@@ -308,8 +374,9 @@ void ol_actor_set_context(ol_actor_t* actor, void* context);
  * @param value Reply value (ownership transferred)
  * @param dtor Value destructor function (can be NULL)
  * 
- * @note This function fulfills the promise in the ask envelope with the
- *       provided value. The envelope is automatically freed after this call.
+ * @note This function fulfills the promise in the ask envelope (or hands the
+ *       value to the waiting ol_actor_call()). The envelope is recycled
+ *       after this call and must not be used again.
  * @warning This function must only be called from within the actor's
  *          behavior function that received the ask envelope.
  */
@@ -321,8 +388,9 @@ void ol_actor_reply_ok(ol_ask_envelope_t* envelope, void* value, ol_actor_value_
  * @param envelope Ask envelope to reply to
  * @param error_code Error code to report
  * 
- * @note This function rejects the promise in the ask envelope with the
- *       provided error code. The envelope is automatically freed after this call.
+ * @note This function rejects the promise in the ask envelope (or fails the
+ *       waiting ol_actor_call()) with the provided error code. The envelope
+ *       is recycled after this call and must not be used again.
  */
 void ol_actor_reply_error(ol_ask_envelope_t* envelope, int error_code);
 
@@ -337,6 +405,19 @@ void ol_actor_reply_error(ol_ask_envelope_t* envelope, int error_code);
  */
 void ol_actor_reply_cancel(ol_ask_envelope_t* envelope);
 
+/**
+ * @brief Get the ask envelope of the message being handled
+ * 
+ * @param actor Actor instance (the behavior's own)
+ * @return ol_ask_envelope_t* The envelope if the current message is an ask
+ *         that has not been replied to yet, NULL otherwise
+ * 
+ * @note Asks are tagged when sent, so this never inspects the message
+ *       itself. An ask still unanswered when the behavior returns is
+ *       cancelled.
+ */
+ol_ask_envelope_t* ol_actor_current_ask(const ol_actor_t* actor);
+
 /* ==================== Introspection ==================== */
 
 /**
@@ -356,7 +437,7 @@ bool ol_actor_is_running(const ol_actor_t* actor);
  * @param actor Actor instance
  * @return size_t Number of messages currently in the mailbox, 0 if actor is NULL
  * 
- * @note This includes both messages in the ring buffer and overflow list.
+ * @note This includes messages on both the data and the priority lane.
  */
 size_t ol_actor_mailbox_length(const ol_actor_t* actor);
 
@@ -385,8 +466,10 @@ ol_actor_t* ol_actor_self(void);
  * 
  * @param actor Actor instance
  * @return ol_process_t* Actor's isolated process, NULL if actor is NULL
+ *         or pool-scheduled
  * 
- * @note Each actor runs in its own isolated process for memory safety.
+ * @note Each actor created without a pool runs in its own isolated process
+ *       for memory safety.
  */
 ol_process_t* ol_actor_get_process(const ol_actor_t* actor);
 
@@ -395,8 +478,10 @@ ol_process_t* ol_actor_get_process(const ol_actor_t* actor);
  * 
  * @param actor Actor instance
  * @return ol_arena_t* Actor's private memory arena, NULL if actor is NULL
+ *         or the arena cannot be mapped
  * 
- * @note Each actor has its own memory arena for allocation isolation.
+ * @note Each actor has its own memory arena for allocation isolation,
+ *       mapped on the first call.
  */
 ol_arena_t* ol_actor_get_arena(const ol_actor_t* actor);
 
@@ -452,6 +537,68 @@ int ol_actor_get_stats(const ol_actor_t* actor, ol_actor_stats_t* stats);
  */
 size_t ol_actor_process_batch(ol_actor_t* actor, size_t max_batch_size);
 
+/* ==================== Actor Groups ==================== */
+
+/**
+ * @brief Create an empty actor group
+ * 
+ * @return ol_actor_group_t* New group or NULL on allocation failure
+ */
+ol_actor_group_t* ol_actor_group_create(void);
+
+/**
+ * @brief Destroy a group (members are not affected)
+ * 
+ * @param group Group to destroy (may be NULL)
+ */
+void ol_actor_group_destroy(ol_actor_group_t* group);
+
+/**
+ * @brief Add an actor to a group
+ * 
+ * @param group Group to join
+ * @param actor Actor to add
+ * @return int 0 on success (or already a member), -1 on error
+ * 
+ * @note An actor must leave every group before it is destroyed.
+ */
+int ol_actor_group_join(ol_actor_group_t* group, ol_actor_t* actor);
+
+/**
+ * @brief Remove an actor from a group
+ * 
+ * @param group Group to leave
+ * @param actor Actor to remove
+ * @return int 0 on success, -1 if the actor is not a member
+ */
+int ol_actor_group_leave(ol_actor_group_t* group, ol_actor_t* actor);
+
+/**
+ * @brief Get the number of actors in a group
+ * 
+ * @param group Group instance
+ * @return size_t Member count (0 if group is NULL)
+ */
+size_t ol_actor_group_size(ol_actor_group_t* group);
+
+/**
+ * @brief Send one message to every member of a group
+ * 
+ * @param group Group to broadcast to
+ * @param msg Message shared by all members (ownership transferred)
+ * @param dtor Destructor for msg (may be NULL)
+ * @return int Number of members the message was queued to, or -1 on error
+ * 
+ * @note The message is not copied: every member's behavior receives the
+ *       same pointer and must treat it as read-only. dtor runs exactly
+ *       once, after the last member has handled or dropped it (at once if
+ *       no member accepted it). Members with a closed or full mailbox are
+ *       skipped. Pooled members are woken with one batched submission per
+ *       pool.
+ */
+int ol_actor_group_broadcast(ol_actor_group_t* group, void* msg,
+                             ol_actor_msg_destructor dtor);
+
 #ifdef __cplusplus
 }
 #endif
@@ -120,6 +120,22 @@ typedef void (*ol_process_entry_fn)(ol_process_t* self, void* arg);
 typedef void (*ol_exit_handler_fn)(ol_process_t* process, ol_pid_t from_pid, 
                                    ol_exit_reason_t reason, void* exit_data);
 
+/**
+ * @brief Selective receive matcher signature
+ * 
+ * @param data Decoded message data (owned by the mailbox; do not free)
+ * @param size Message size in bytes
+ * @param sender Sender PID (0 if anonymous)
+ * @param ctx Context passed to ol_process_recv_match()
+ * @return bool true to receive this message, false to leave it queued
+ * 
+ * @note Must give the same answer for the same message and ctx during one
+ *       ol_process_recv_match() call: a message rejected while it waits is
+ *       not offered again until the next call.
+ */
+typedef bool (*ol_process_match_fn)(const void* data, size_t size,
+                                    ol_pid_t sender, void* ctx);
+
 /**
  * @brief Create a new process with full isolation
  * 
@@ -239,14 +255,31 @@ int ol_process_unlink(ol_process_t* process1, ol_process_t* process2);
  * @param sender_pid Sender PID (0 for anonymous send)
  * @return int OL_SUCCESS on success, OL_ERROR on error
  * 
- * @details Sends a message to the process's mailbox. The message is
- * serialized for inter-process communication if needed.
+ * @details Sends a copy of the message to the process's mailbox. Processes
+ * share the address space, so the payload is copied once and never
+ * serialized or checksummed.
  * 
- * @note Messages to same-arena processes may use zero-copy optimization.
+ * @note To avoid the copy, use ol_process_send_owned().
  */
 int ol_process_send(ol_process_t* process, const void* data, size_t size,
                    ol_pid_t sender_pid);
 
+/**
+ * @brief Send a message by handing over its buffer (zero-copy)
+ * 
+ * @param process Target process
+ * @param data Buffer from malloc() holding the message (ownership transferred,
+ *             freed on error)
+ * @param size Message size in bytes
+ * @param sender_pid Sender PID (0 for anonymous send)
+ * @return int OL_SUCCESS on success, OL_ERROR on error
+ * 
+ * @details The receiver gets the same pointer from ol_process_recv() and
+ * frees it with free(). The sender must not touch the buffer afterwards.
+ */
+int ol_process_send_owned(ol_process_t* process, void* data, size_t size,
+                          ol_pid_t sender_pid);
+
 /**
  * @brief Receive a message with timeout
  * 
@@ -267,6 +300,72 @@ int ol_process_send(ol_process_t* process, const void* data, size_t size,
 int ol_process_recv(ol_process_t* process, void** out_data, size_t* out_size,
                    ol_pid_t* out_sender, int timeout_ms);
 
+/**
+ * @brief Receive the first message accepted by a matcher (selective receive)
+ * 
+ * @param process Process to receive for
+ * @param match Matcher called with queued messages, oldest first
+ * @param ctx Context passed to the matcher
+ * @param out_data Will receive pointer to message data
+ * @param out_size Will receive message size
+ * @param out_sender Will receive sender PID (optional, can be NULL)
+ * @param timeout_ms Timeout in milliseconds (0 = non-blocking, -1 = infinite)
+ * @return int 1 on success (message received),
+ *             0 on timeout (no matching message),
+ *             -1 on error (process dead, etc.)
+ * 
+ * @details Erlang-style receive: rejected messages stay in the mailbox in
+ * order for later receives. A save-queue cursor means messages already
+ * rejected are not rescanned while the call waits; each call starts again
+ * from the oldest message, so a reused ctx may change its answers.
+ * 
+ * @note The caller is responsible for freeing the received data with free().
+ */
+int ol_process_recv_match(ol_process_t* process, ol_process_match_fn match,
+                          void* ctx, void** out_data, size_t* out_size,
+                          ol_pid_t* out_sender, int timeout_ms);
+
+/**
+ * @brief Create a unique reference for request/reply tagging
+ * 
+ * @return uint64_t New non-zero reference
+ */
+uint64_t ol_process_make_ref(void);
+
+/**
+ * @brief Send a message tagged with a reference
+ * 
+ * @param process Target process
+ * @param data Message data
+ * @param size Message size in bytes
+ * @param sender_pid Sender PID (0 for anonymous send)
+ * @param ref Reference from ol_process_make_ref() (0 = untagged, as ol_process_send())
+ * @return int OL_SUCCESS on success, OL_ERROR on error
+ * 
+ * @note Typically a server's reply, carrying the reference from the request.
+ */
+int ol_process_send_ref(ol_process_t* process, const void* data, size_t size,
+                        ol_pid_t sender_pid, uint64_t ref);
+
+/**
+ * @brief Receive the message tagged with a reference
+ * 
+ * @param process Process to receive for
+ * @param ref Reference to wait for
+ * @param out_data Will receive pointer to message data
+ * @param out_size Will receive message size
+ * @param out_sender Will receive sender PID (optional, can be NULL)
+ * @param timeout_ms Timeout in milliseconds (0 = non-blocking, -1 = infinite)
+ * @return int 1 on success, 0 on timeout, -1 on error
+ * 
+ * @details RPC fast path: only tagged messages are examined, by reference
+ * alone, so the reply is found in O(1) regardless of other queued traffic.
+ * 
+ * @note The caller is responsible for freeing the received data with free().
+ */
+int ol_process_recv_ref(ol_process_t* process, uint64_t ref, void** out_data,
+                        size_t* out_size, ol_pid_t* out_sender, int timeout_ms);
+
 /**
  * @brief Set process exit handler
  * 
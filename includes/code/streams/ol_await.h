@@ -32,9 +32,12 @@ OL_API int ol_await_future(ol_future_t *f, int64_t deadline_ns);
 /**
  * @brief Await a future cooperatively from an event loop thread
  * 
- * Polls the future in short slices and yields control to the event loop
- * between polls, keeping the loop responsive. This must only be called
- * from the event loop thread.
+ * Registers a continuation that wakes the loop when the future settles,
+ * then runs loop iterations (ol_event_loop_run_once()) until it does, so
+ * other events keep being served and the caller resumes as soon as the
+ * promise is resolved. Without a loop this is ol_await_future().
+ * After a timeout the continuation is removed again; only one that was
+ * already dispatched can still wake the loop.
  * 
  * @param loop Event loop instance (optional)
  * @param f Future to await (must not be NULL)
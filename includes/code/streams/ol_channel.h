@@ -27,6 +27,43 @@ typedef struct ol_channel ol_channel_t;
  */
 typedef void (*ol_chan_item_destructor)(void *item);
 
+/** @brief Operation of an ol_channel_select() case */
+typedef enum {
+    OL_CHAN_SELECT_RECV = 0,    /**< Receive an item */
+    OL_CHAN_SELECT_SEND         /**< Send case->item */
+} ol_chan_select_op_t;
+
+/**
+ * @brief One case of an ol_channel_select() call
+ */
+typedef struct {
+    ol_channel_t *ch;           /**< Channel (NULL: case is never ready) */
+    ol_chan_select_op_t op;     /**< Receive or send */
+    void *item;                 /**< SEND: item to send; RECV: received item */
+    int result;                 /**< Chosen case only. RECV: 1 item received,
+                                     0 channel closed and empty.
+                                     SEND: OL_SUCCESS, or OL_CLOSED (item
+                                     destroyed as by ol_channel_send) */
+} ol_chan_case_t;
+
+/** @brief Readiness event: items available or channel closed (= OL_POLL_IN) */
+#define OL_CHAN_EV_READ  0x01u
+/** @brief Readiness event: space available or channel closed (= OL_POLL_OUT) */
+#define OL_CHAN_EV_WRITE 0x02u
+
+/**
+ * @brief Readiness hook invoked when an armed event becomes ready
+ *
+ * Runs on the thread that changed the channel, with the channel's internal
+ * lock held: it must be short, must not block and must not call back into
+ * the channel.
+ *
+ * @param ch Channel that became ready
+ * @param events Ready events (OL_CHAN_EV_READ / OL_CHAN_EV_WRITE)
+ * @param ctx Context given to ol_channel_set_ready_hook()
+ */
+typedef void (*ol_chan_ready_fn)(ol_channel_t *ch, uint32_t events, void *ctx);
+
 /**
  * @brief Create a new channel
  * 
@@ -124,6 +161,107 @@ OL_API int ol_channel_recv_deadline(ol_channel_t *ch,
  */
 OL_API int ol_channel_try_recv(ol_channel_t *ch, void **out_item);
 
+/**
+ * @brief Send a batch of items
+ * 
+ * Moves as many items as fit per lock acquisition (or per CAS on bounded
+ * channels) and wakes receivers once per batch, blocking for space until
+ * all n items are queued, the deadline passes or the channel closes.
+ * Items are queued in order; items[sent..n) were not queued and remain
+ * owned by the caller.
+ * 
+ * @param ch Channel handle
+ * @param items Items to send (ownership of queued items transferred)
+ * @param n Number of items
+ * @param deadline_ns Absolute deadline in nanoseconds (0 for infinite)
+ * @return Number of items sent (n on full success; fewer if the channel
+ *         closed or the deadline passed after a partial send), or
+ *         OL_CLOSED / OL_TIMEOUT if nothing was sent, OL_ERROR on error
+ */
+OL_API int ol_channel_send_many(ol_channel_t *ch,
+                                void *const *items,
+                                size_t n,
+                                int64_t deadline_ns);
+
+/**
+ * @brief Receive a batch of items
+ * 
+ * Blocks until at least one item is available, then takes up to max
+ * items without blocking further (one lock acquisition or CAS per batch).
+ * 
+ * @param ch Channel handle
+ * @param out Output array with room for max items
+ * @param max Maximum number of items to receive
+ * @param deadline_ns Absolute deadline in nanoseconds (0 for infinite)
+ * @return Number of items received (>0), 0 if channel closed and empty,
+ *         OL_TIMEOUT on timeout, OL_ERROR on error
+ */
+OL_API int ol_channel_recv_many(ol_channel_t *ch,
+                                void **out,
+                                size_t max,
+                                int64_t deadline_ns);
+
+/**
+ * @brief Receive up to max items without blocking
+ * 
+ * @param ch Channel handle
+ * @param out Output array with room for max items
+ * @param max Maximum number of items to receive
+ * @return Number of items received (0 if none available), OL_ERROR on error
+ */
+OL_API int ol_channel_try_recv_many(ol_channel_t *ch,
+                                    void **out,
+                                    size_t max);
+
+/**
+ * @brief Wait until one of several send/receive cases can proceed
+ * 
+ * Go-style select: performs exactly one ready case and returns its index.
+ * When several are ready the starting case rotates, so none starves. If
+ * none is ready the caller blocks on a single waiter registered with every
+ * channel involved (no polling) until one becomes ready, the deadline
+ * passes, or a channel closes (a receive on a closed, drained channel
+ * completes with result 0; a send completes with OL_CLOSED).
+ * 
+ * @param cases Array of cases (result/item of the chosen case are updated)
+ * @param n Number of cases
+ * @param deadline_ns Absolute deadline in nanoseconds (0 for infinite)
+ * @return Index of the completed case, OL_TIMEOUT on timeout,
+ *         OL_NOMEM or OL_ERROR on error
+ */
+OL_API int ol_channel_select(ol_chan_case_t *cases,
+                             size_t n,
+                             int64_t deadline_ns);
+
+/**
+ * @brief Install or remove the channel's readiness hook
+ * 
+ * A channel has at most one hook; it is how an event loop watches a
+ * channel (see ol_event_loop_register_channel()). Removing the hook also
+ * disarms it, and no invocation is in progress once this returns.
+ * 
+ * @param ch Channel handle
+ * @param fn Hook to install, or NULL to remove the current one
+ * @param ctx Context passed to fn
+ * @return OL_SUCCESS, or OL_ERROR if a different hook is already installed
+ */
+OL_API int ol_channel_set_ready_hook(ol_channel_t *ch,
+                                     ol_chan_ready_fn fn,
+                                     void *ctx);
+
+/**
+ * @brief Arm the readiness hook for one notification
+ * 
+ * One-shot: the hook fires once for the armed events, either right away if
+ * the channel is already ready or on the next transition, and must then be
+ * re-armed. While unarmed, send/recv stay on their lock-free fast path.
+ * 
+ * @param ch Channel handle
+ * @param events OL_CHAN_EV_READ and/or OL_CHAN_EV_WRITE
+ * @return OL_SUCCESS, or OL_ERROR if no hook is installed
+ */
+OL_API int ol_channel_arm_ready(ol_channel_t *ch, uint32_t events);
+
 /**
  * @brief Check if channel is closed
  * 
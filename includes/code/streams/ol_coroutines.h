@@ -6,6 +6,12 @@
  * This header provides a coroutine abstraction built on platform-specific
  * green thread backends. Coroutines are cooperative and run on a single-
  * threaded scheduler.
+ * 
+ * Stackless coroutines (ol_co_stackless_spawn()) have no green thread or
+ * stack: a step function is re-entered on every ol_co_resume() and jumps
+ * back to its last OL_CO_YIELD() with a switch on the saved resume point
+ * (protothread style). State that must survive a yield lives in an
+ * explicit, heap-allocated frame struct rather than in locals.
  */
 
 #ifndef OL_COROUTINES_H
@@ -28,6 +34,26 @@ typedef struct ol_co ol_co_t;
  */
 typedef void* (*ol_co_entry_fn)(void *arg);
 
+/** @brief Step outcome of a stackless coroutine */
+typedef enum {
+    OL_CO_STEP_YIELD = 0, /**< Suspended at an OL_CO_YIELD() */
+    OL_CO_STEP_DONE  = 1  /**< Finished (OL_CO_RETURN() or OL_CO_END()) */
+} ol_co_step_t;
+
+/**
+ * @brief Stackless coroutine step function
+ * 
+ * Runs from the last yield point to the next one on every resume. Write
+ * the body between OL_CO_BEGIN() and OL_CO_END(); locals do not survive
+ * OL_CO_YIELD(), so keep such state in the frame.
+ * 
+ * @param co Coroutine being stepped
+ * @param frame Coroutine frame (see ol_co_stackless_spawn())
+ * @param payload Payload passed to this ol_co_resume()
+ * @return OL_CO_STEP_YIELD or OL_CO_STEP_DONE (returned by the macros)
+ */
+typedef ol_co_step_t (*ol_co_step_fn)(ol_co_t *co, void *frame, void *payload);
+
 /**
  * @brief Initialize the coroutine scheduler
  * 
@@ -54,9 +80,29 @@ OL_API ol_co_t* ol_co_spawn(ol_co_entry_fn entry,
                             void *arg,
                             size_t stack_size);
 
+/**
+ * @brief Spawn a stackless coroutine
+ * 
+ * The coroutine and its frame are one heap allocation; nothing runs until
+ * the first ol_co_resume(), which runs the step synchronously on the
+ * caller's stack without taking a lock. A stackless coroutine must only be
+ * resumed by one thread at a time.
+ * 
+ * @param step Step function (must not be NULL)
+ * @param frame_size Size of the frame struct in bytes (may be 0)
+ * @param frame_init Initial frame contents (NULL = zeroed)
+ * @return New coroutine handle, or NULL on error
+ */
+OL_API ol_co_t* ol_co_stackless_spawn(ol_co_step_fn step,
+                                      size_t frame_size,
+                                      const void *frame_init);
+
 /**
  * @brief Resume a coroutine
  * 
+ * A stackless coroutine runs to its next yield (or end) before this
+ * returns; ol_co_yielded() then holds the yielded payload.
+ * 
  * @param co Coroutine to resume (must not be NULL)
  * @param payload Payload passed to coroutine (optional)
  * @return OL_SUCCESS on success, OL_ERROR on error
@@ -73,10 +119,19 @@ OL_API int ol_co_resume(ol_co_t *co, void *payload);
  */
 OL_API void* ol_co_yield(void *payload);
 
+/**
+ * @brief Get the payload of the coroutine's last yield
+ * 
+ * @param co Coroutine handle
+ * @return Last yielded payload, or NULL if none
+ */
+OL_API void* ol_co_yielded(const ol_co_t *co);
+
 /**
  * @brief Join a coroutine
  * 
- * Blocks until the coroutine completes and returns its result.
+ * Blocks until the coroutine completes and returns its result. A
+ * stackless coroutine is resumed with NULL payloads until it finishes.
  * 
  * @param co Coroutine to join (must not be NULL)
  * @return Coroutine result, or NULL on error
@@ -120,6 +175,47 @@ OL_API bool ol_co_is_alive(const ol_co_t *co);
  */
 OL_API bool ol_co_is_canceled(const ol_co_t *co);
 
+/* --------------------------------------------------------------------------
+ * Stackless coroutine frame macros
+ * -------------------------------------------------------------------------- */
+
+/** @brief Resume point of a stackless coroutine (used by the macros) */
+OL_API int ol_co_frame_pc(const ol_co_t *co);
+
+/** @brief Record a yield point and payload (used by OL_CO_YIELD()) */
+OL_API void ol_co_frame_suspend(ol_co_t *co, int pc, void *payload);
+
+/** @brief Record the final result (used by OL_CO_RETURN()) */
+OL_API void ol_co_frame_finish(ol_co_t *co, void *result);
+
+/**
+ * @brief Open a stackless step body
+ * 
+ * The body is a switch on the resume point, so OL_CO_YIELD() may not be
+ * used inside another switch statement in the same step function.
+ */
+#define OL_CO_BEGIN(co) \
+    switch (ol_co_frame_pc(co)) { case 0:
+
+/** @brief Yield payload to the resumer; continues here on the next resume */
+#define OL_CO_YIELD(co, payload) \
+    do { \
+        ol_co_frame_suspend((co), __LINE__, (payload)); \
+        return OL_CO_STEP_YIELD; \
+        case __LINE__:; \
+    } while (0)
+
+/** @brief Finish with a result (returned by ol_co_join()) */
+#define OL_CO_RETURN(co, result) \
+    do { \
+        ol_co_frame_finish((co), (result)); \
+        return OL_CO_STEP_DONE; \
+    } while (0)
+
+/** @brief Close a stackless step body (finishes with a NULL result) */
+#define OL_CO_END(co) \
+    } OL_CO_RETURN((co), NULL)
+
 #ifdef __cplusplus
 }
 #endif
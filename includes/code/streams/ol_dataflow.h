@@ -80,6 +80,11 @@ int ol_df_graph_stop(ol_df_graph_t *g);
  */
 int ol_df_push(ol_df_graph_t *g, ol_df_node_t *to, void *item);
 
+/* Push a batch into a node's implicit input with one channel operation per run.
+ * Returns the number of items pushed (the rest stay owned by the caller), -1 on error.
+ */
+int ol_df_push_many(ol_df_graph_t *g, ol_df_node_t *to, void *const *items, size_t n);
+
 /* Emit helper for node handlers: send item to outbound port (0..out_ports-1).
  * Provided to handlers via the emit function pointer argument; exposed here for manual use.
  */
@@ -13,6 +13,7 @@
 #include "ol_common.h"
 #include "ol_poller.h"
 #include "ol_deadlines.h"
+#include "ol_channel.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -23,8 +24,9 @@ typedef struct ol_event_loop ol_event_loop_t;
 
 /** @brief Event type enumeration */
 typedef enum {
-    OL_EV_IO,    /**< I/O event */
-    OL_EV_TIMER  /**< Timer event */
+    OL_EV_IO,     /**< I/O event */
+    OL_EV_TIMER,  /**< Timer event */
+    OL_EV_CHANNEL /**< Channel readiness (fd argument carries OL_POLL_IN/OUT) */
 } ol_ev_type_t;
 
 /** @brief Event callback type */
@@ -33,6 +35,17 @@ typedef void (*ol_event_cb)(ol_event_loop_t *loop,
                            int fd,
                            void *user_data);
 
+/**
+ * @brief Completion callback for operations submitted with ol_event_loop_submit()
+ *
+ * @param loop Event loop
+ * @param result Bytes transferred / accepted fd (>= 0), or negative errno
+ * @param user_data User data passed to ol_event_loop_submit()
+ */
+typedef void (*ol_io_complete_cb)(ol_event_loop_t *loop,
+                                  int result,
+                                  void *user_data);
+
 /**
  * @brief Create a new event loop
  * 
@@ -40,6 +53,18 @@ typedef void (*ol_event_cb)(ol_event_loop_t *loop,
  */
 OL_API ol_event_loop_t* ol_event_loop_create(void);
 
+/**
+ * @brief Create a new event loop on a specific poller backend
+ *
+ * OL_POLLER_BACKEND_IO_URING adds a completion ring next to readiness
+ * polling; when the kernel lacks support the loop silently falls back to
+ * readiness only (check with ol_event_loop_has_completions()).
+ *
+ * @param backend Requested poller backend
+ * @return New event loop handle, or NULL on error
+ */
+OL_API ol_event_loop_t* ol_event_loop_create_ex(ol_poller_backend_t backend);
+
 /**
  * @brief Destroy an event loop
  * 
@@ -57,6 +82,20 @@ OL_API void ol_event_loop_destroy(ol_event_loop_t *loop);
  */
 OL_API int ol_event_loop_run(ol_event_loop_t *loop);
 
+/**
+ * @brief Run a single event loop iteration
+ * 
+ * Waits for I/O, a wake or the next timer, then dispatches ready events,
+ * expired timers and posted tasks once. May be called from a callback of
+ * ol_event_loop_run() on the loop thread to make progress while waiting.
+ * 
+ * @param loop Event loop to run
+ * @param deadline_ns Absolute deadline bounding the wait (0 for none)
+ * @return OL_SUCCESS after the iteration, OL_ERROR on error
+ * @warning Must only be called from the loop's thread
+ */
+OL_API int ol_event_loop_run_once(ol_event_loop_t *loop, int64_t deadline_ns);
+
 /**
  * @brief Stop the event loop
  * 
@@ -69,19 +108,72 @@ OL_API void ol_event_loop_stop(ol_event_loop_t *loop);
 /**
  * @brief Wake the event loop
  * 
- * Can be called from another thread to wake the event loop.
+ * Can be called from another thread to wake the event loop. Repeated
+ * wakes before the loop runs again are coalesced into one syscall.
  * 
  * @param loop Event loop to wake
  * @return OL_SUCCESS on success, OL_ERROR on error
  */
 OL_API int ol_event_loop_wake(ol_event_loop_t *loop);
 
+/**
+ * @brief Run a function on the event loop thread
+ * 
+ * Thread-safe and lock-free: the task is pushed onto a multi-producer
+ * queue that the loop drains once per iteration, in posting order.
+ * Tasks still queued when the loop is destroyed run during destruction.
+ * 
+ * @param loop Event loop
+ * @param fn Function to run on the loop thread
+ * @param arg Argument passed to fn
+ * @return OL_SUCCESS on success, OL_NOMEM or OL_ERROR on error
+ */
+OL_API int ol_event_loop_post(ol_event_loop_t *loop,
+                              ol_callback_fn fn,
+                              void *arg);
+
+/**
+ * @brief Check whether the loop accepts completion-based submissions
+ *
+ * @param loop Event loop
+ * @return true if ol_event_loop_submit() is available
+ */
+OL_API bool ol_event_loop_has_completions(const ol_event_loop_t *loop);
+
+/**
+ * @brief Submit an I/O operation for completion on the loop thread
+ *
+ * The operation is queued on the poller's completion ring and flushed with
+ * the rest of the batch on the next loop iteration; cb runs on the loop
+ * thread with the result. buf must stay valid until cb is invoked. Pending
+ * operations complete with -ECANCELED when the loop is destroyed.
+ * Thread-safe.
+ *
+ * @param loop Event loop
+ * @param op Operation type
+ * @param fd Target file descriptor
+ * @param buf Data buffer (sockaddr for OL_IO_OP_CONNECT, unused for accept)
+ * @param len Buffer length (sockaddr length for OL_IO_OP_CONNECT)
+ * @param cb Completion callback
+ * @param user_data User data passed to cb
+ * @return OL_SUCCESS, OL_AGAIN if the ring is full, OL_NOMEM, or OL_ERROR
+ *         if completions are not supported by this loop
+ */
+OL_API int ol_event_loop_submit(ol_event_loop_t *loop,
+                                ol_io_op_type_t op,
+                                int fd,
+                                void *buf,
+                                size_t len,
+                                ol_io_complete_cb cb,
+                                void *user_data);
+
 /**
  * @brief Register an I/O event
  * 
  * @param loop Event loop
  * @param fd File descriptor to monitor
- * @param mask Poll mask (OL_POLL_IN/OL_POLL_OUT)
+ * @param mask Poll mask (OL_POLL_IN/OL_POLL_OUT), optionally combined with
+ *             OL_POLL_ET and/or OL_POLL_ONESHOT (passed through to the poller)
  * @param cb Callback function
  * @param user_data User data passed to callback
  * @return Event ID (>0) on success, 0 on error
@@ -92,12 +184,40 @@ OL_API uint64_t ol_event_loop_register_io(ol_event_loop_t *loop,
                                           ol_event_cb cb,
                                           void *user_data);
 
+/**
+ * @brief Watch a channel for readiness
+ * 
+ * The callback runs on the loop thread with type OL_EV_CHANNEL and the fd
+ * argument set to the ready OL_POLL_IN / OL_POLL_OUT bits (a closed channel
+ * reports every watched direction). Use the non-blocking calls
+ * (ol_channel_try_recv_many() etc.) in the callback. Readiness is
+ * re-checked after each callback, so a channel left non-empty is reported
+ * again; producers on other threads cost at most one loop wake per
+ * empty->non-empty transition, not one per item.
+ * A channel can be registered with one loop at a time. Remove with
+ * ol_event_loop_unregister() before destroying the channel; called off
+ * the loop thread it waits for a callback already running for the channel,
+ * so once it returns neither the loop nor the callback touches it.
+ * 
+ * @param loop Event loop
+ * @param ch Channel to watch
+ * @param mask OL_POLL_IN and/or OL_POLL_OUT
+ * @param cb Callback function
+ * @param user_data User data passed to callback
+ * @return Event ID (>0) on success, 0 on error
+ */
+OL_API uint64_t ol_event_loop_register_channel(ol_event_loop_t *loop,
+                                               ol_channel_t *ch,
+                                               uint32_t mask,
+                                               ol_event_cb cb,
+                                               void *user_data);
+
 /**
  * @brief Modify I/O event mask
  * 
  * @param loop Event loop
  * @param id Event ID to modify
- * @param mask New poll mask
+ * @param mask New poll mask (re-arms OL_POLL_ONESHOT registrations)
  * @return OL_SUCCESS on success, OL_ERROR on error
  */
 OL_API int ol_event_loop_mod_io(ol_event_loop_t *loop,
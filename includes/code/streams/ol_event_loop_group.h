@@ -0,0 +1,91 @@
+/**
+ * @file ol_event_loop_group.h
+ * @brief Group of event loops, one per thread (multi-reactor)
+ * @version 1.2.0
+ *
+ * A single ol_event_loop_t is bound to one thread. The group runs N loops on
+ * N threads (optionally pinned one per CPU) so I/O can scale across cores:
+ * listeners are sharded per loop (see ol_tcp_listen_sharded()) and new
+ * outbound connections go to the least-loaded loop.
+ */
+
+#ifndef OL_EVENT_LOOP_GROUP_H
+#define OL_EVENT_LOOP_GROUP_H
+
+#include "ol_common.h"
+#include "ol_event_loop.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Opaque event loop group handle */
+typedef struct ol_event_loop_group ol_event_loop_group_t;
+
+/**
+ * @brief Create a group and start its loop threads
+ *
+ * @param num_loops Number of loops/threads (0 = number of online CPUs)
+ * @param backend Poller backend for every loop
+ * @param pin_threads Pin loop i to CPU (i mod CPU count) where supported
+ * @return New group handle, or NULL on error
+ */
+OL_API ol_event_loop_group_t* ol_event_loop_group_create(size_t num_loops,
+                                                         ol_poller_backend_t backend,
+                                                         bool pin_threads);
+
+/**
+ * @brief Stop all loops, join their threads and destroy the group
+ *
+ * Must not be called from one of the group's loop threads.
+ *
+ * @param group Group to destroy (may be NULL)
+ */
+OL_API void ol_event_loop_group_destroy(ol_event_loop_group_t *group);
+
+/**
+ * @brief Get number of loops in the group
+ *
+ * @param group Event loop group
+ * @return Loop count
+ */
+OL_API size_t ol_event_loop_group_size(const ol_event_loop_group_t *group);
+
+/**
+ * @brief Get loop by index
+ *
+ * @param group Event loop group
+ * @param index Loop index (< ol_event_loop_group_size())
+ * @return Loop, or NULL if index is out of range
+ */
+OL_API ol_event_loop_t* ol_event_loop_group_get(ol_event_loop_group_t *group,
+                                                size_t index);
+
+/**
+ * @brief Pick the next loop in round-robin order
+ *
+ * Suitable for handing accepted connections to other loops via
+ * ol_event_loop_post(). Thread-safe.
+ *
+ * @param group Event loop group
+ * @return Loop, or NULL on error
+ */
+OL_API ol_event_loop_t* ol_event_loop_group_next(ol_event_loop_group_t *group);
+
+/**
+ * @brief Pick the loop with the fewest registered events
+ *
+ * Load is the loop's active registration count, so a loop serving many
+ * sockets or timers is avoided. Ties are broken round-robin so bursts of
+ * new connections spread out. Thread-safe.
+ *
+ * @param group Event loop group
+ * @return Loop, or NULL on error
+ */
+OL_API ol_event_loop_t* ol_event_loop_group_least_loaded(ol_event_loop_group_t *group);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OL_EVENT_LOOP_GROUP_H */
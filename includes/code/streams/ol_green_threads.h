@@ -22,12 +22,12 @@ extern "C" {
 #include <stdalign.h>
 
 /* ==================== Platform Detection ==================== */
+/* As in ol_common.h, OL_PLATFORM_WINDOWS is only defined on Windows */
 #if defined(_WIN32) || defined(_WIN64)
     #define OL_PLATFORM_WINDOWS 1
     #define OL_PLATFORM_POSIX 0
 #elif defined(__linux__) || defined(__APPLE__) || defined(__FreeBSD__) || \
       defined(__OpenBSD__) || defined(__NetBSD__) || defined(__DragonFly__)
-    #define OL_PLATFORM_WINDOWS 0
     #define OL_PLATFORM_POSIX 1
 #else
     #error "OLSRT: Unsupported platform"
@@ -53,6 +53,8 @@ extern "C" {
 #endif
 
 /* ==================== Compiler Features ==================== */
+/* ol_common.h spells OL_ALWAYS_INLINE without `inline`; this header's wins */
+#undef OL_ALWAYS_INLINE
 #if defined(__GNUC__) || defined(__clang__)
     #define OL_LIKELY(x)   __builtin_expect(!!(x), 1)
     #define OL_UNLIKELY(x) __builtin_expect(!!(x), 0)
@@ -121,8 +123,8 @@ typedef enum {
  */
 typedef enum {
     OL_GT_SCHED_COOPERATIVE = 0,  /**< Only yield voluntarily */
-    OL_GT_SCHED_PREEMPTIVE  = 1,  /**< Time-sliced preemption */
-    OL_GT_SCHED_HYBRID      = 2   /**< Adaptive hybrid scheduling */
+    OL_GT_SCHED_PREEMPTIVE  = 1,  /**< Time-sliced by a CPU-time timer (SIGURG on Linux) */
+    OL_GT_SCHED_HYBRID      = 2   /**< Time-sliced by the calibrated clock at safe points */
 } ol_gt_sched_policy_t;
 
 /**
@@ -147,6 +149,7 @@ typedef struct ol_gt_scheduler ol_gt_scheduler_t;
 typedef struct ol_work_stealing_queue ol_work_stealing_queue_t;
 typedef struct ol_stack_pool ol_stack_pool_t;
 typedef struct ol_gt_statistics ol_gt_statistics_t;
+struct sockaddr;
 
 /* ==================== ORIGINAL API - MUST NOT CHANGE ==================== */
 
@@ -183,6 +186,8 @@ int ol_gt_resume(ol_gt_t* gt);
 
 /**
  * @brief Yield execution to another green thread
+ * @note Also a preemption safe point: a yield with the slice expired is
+ *       counted as a preemptive yield.
  * @note Original API - Signature must not change
  */
 void ol_gt_yield(void);
@@ -289,6 +294,24 @@ void ol_gt_enable_work_stealing(bool enabled);
  */
 void ol_gt_set_preemption_slice(uint64_t microseconds);
 
+/**
+ * @brief Preemption safe point
+ *
+ * If the current thread is not cooperative and its slice has expired, it
+ * is requeued and the oldest ready thread of equal or higher priority runs.
+ * The preemption signal only flags expiry; switches happen here, in
+ * ol_gt_yield(), ol_gt_spawn(), ol_gt_resume() and at entry to ol_gt_read()
+ * and friends.
+ *
+ * @warning Preemption is not asynchronous: a compute loop that makes none
+ *          of these calls keeps its scheduler thread until it finishes.
+ *          Such loops must call ol_gt_preempt_check() every iteration (or
+ *          every few); the check is a flag test when the slice is live.
+ *
+ * @internal Internal API only
+ */
+void ol_gt_preempt_check(void);
+
 /**
  * @brief Pin green thread to specific CPU core
  * @param gt Green thread
@@ -307,6 +330,80 @@ int ol_gt_pin_to_cpu(ol_gt_t* gt, int cpu_id);
  */
 int ol_gt_get_numa_topology(ol_numa_node_t* nodes, int max_nodes);
 
+/* ==================== Blocking-Style I/O ==================== */
+
+/*
+ * These park the calling green thread on its scheduler thread's netpoller
+ * (an ol_poller_t created on first use) instead of blocking the OS thread,
+ * and requeue it when the fd becomes ready or the deadline passes. Called
+ * outside a green thread they block the OS thread in the poller. The fd is
+ * switched to O_NONBLOCK on first use; close it with ol_gt_close() so the
+ * netpoller forgets it. At most one green thread may wait per fd and
+ * direction.
+ *
+ * Deadlines are absolute ol_monotonic_now_ns() values (0 = none). Errors
+ * return -1 with errno set (ETIMEDOUT when the deadline passes, EBUSY when
+ * another green thread already waits on the same fd and direction).
+ */
+
+/**
+ * @brief Read up to len bytes, parking until data is available
+ * @param fd File descriptor
+ * @param buf Output buffer
+ * @param len Buffer size
+ * @param deadline_ns Absolute deadline (0 = none)
+ * @return Bytes read (0 at EOF), or -1 on error
+ */
+ptrdiff_t ol_gt_read(int fd, void* buf, size_t len, int64_t deadline_ns);
+
+/**
+ * @brief Write all len bytes, parking whenever the fd is full
+ * @param fd File descriptor
+ * @param buf Data to write
+ * @param len Number of bytes
+ * @param deadline_ns Absolute deadline (0 = none)
+ * @return len, the bytes written before an error or timeout, or -1 if none were
+ */
+ptrdiff_t ol_gt_write(int fd, const void* buf, size_t len, int64_t deadline_ns);
+
+/**
+ * @brief Accept a connection, parking until one is pending
+ * @param fd Listening socket
+ * @param addr Peer address output (may be NULL)
+ * @param addrlen In: size of addr, out: actual length (may be NULL)
+ * @param deadline_ns Absolute deadline (0 = none)
+ * @return New non-blocking, close-on-exec socket, or -1 on error
+ */
+int ol_gt_accept(int fd, struct sockaddr* addr, uint32_t* addrlen, int64_t deadline_ns);
+
+/**
+ * @brief Connect a socket, parking until the handshake completes
+ * @param fd Socket
+ * @param addr Peer address
+ * @param addrlen Length of addr
+ * @param deadline_ns Absolute deadline (0 = none)
+ * @return 0 on success, -1 on error
+ */
+int ol_gt_connect(int fd, const struct sockaddr* addr, uint32_t addrlen, int64_t deadline_ns);
+
+/**
+ * @brief Park the current green thread until a deadline
+ * @param deadline_ns Absolute deadline (returns at once if already passed)
+ * @return 0 on success, -1 on error
+ */
+int ol_gt_sleep_until(int64_t deadline_ns);
+
+/**
+ * @brief Close an fd used with the functions above
+ *
+ * Wakes any green thread parked on it with EBADF and drops it from the
+ * netpoller before closing.
+ *
+ * @param fd File descriptor
+ * @return Result of close()
+ */
+int ol_gt_close(int fd);
+
 /* ==================== Statistics Structure ==================== */
 
 /**
@@ -331,9 +428,9 @@ typedef struct ol_gt_statistics {
     uint64_t min_runtime_ns;        /**< Minimum runtime */
     
     /* Memory statistics */
-    size_t stack_usage;             /**< Current stack usage */
-    size_t peak_stack_usage;        /**< Peak stack usage */
-    size_t stack_size;              /**< Allocated stack size */
+    size_t stack_usage;             /**< Resident (committed) stack bytes */
+    size_t peak_stack_usage;        /**< Peak resident stack bytes observed */
+    size_t stack_size;              /**< Reserved stack size */
     uint64_t stack_pool_hits;       /**< Stack pool cache hits */
     uint64_t stack_pool_misses;     /**< Stack pool cache misses */
     
@@ -355,7 +452,11 @@ typedef struct ol_gt_statistics {
     uint64_t numa_local_accesses;   /**< Local NUMA accesses */
     uint64_t numa_remote_accesses;  /**< Remote NUMA accesses */
     
-    uint8_t reserved[128];          /**< Reserved for future expansion */
+    /* Process-wide totals */
+    uint64_t total_spawned;         /**< Threads and schedulers created */
+    uint64_t total_destroyed;       /**< Threads and schedulers torn down */
+    
+    uint8_t reserved[112];          /**< Reserved for future expansion */
 } ol_gt_statistics_t;
 
 /* ==================== Internal Structures (Opaque) ==================== */
@@ -412,26 +513,32 @@ struct ol_gt {
     atomic_bool cancel_requested;
     atomic_bool cancel_flag;
     
+    /* Woken while still running: requeue instead of parking */
+    atomic_bool wake_pending;
+    
     /* Padding to 1024 bytes exactly */
     uint8_t padding[1024 - 384];
-} OL_ALIGNED(64) OL_PACKED;
+} OL_ALIGNED(64);
 
 struct ol_work_stealing_queue {
     /* Chase-Lev work-stealing deque */
-    atomic_uintptr_t* tasks;
+    atomic_uintptr_t* array;
     atomic_long bottom;
     atomic_long top;
     size_t capacity;
     size_t mask;
 };
 
+typedef struct {
+    void** stacks;
+    atomic_size_t count;
+    size_t capacity;
+    size_t stack_size;
+} ol_stack_bucket_t;
+
 struct ol_stack_pool {
     /* Segregated stack pool by size */
-    struct {
-        void** stacks;
-        atomic_size_t count;
-        size_t size;
-    } buckets[8]; /* 1KB, 2KB, 4KB, 8KB, 16KB, 32KB, 64KB, 128KB */
+    ol_stack_bucket_t buckets[8]; /* 64KB, 128KB, 256KB, 512KB, 1MB, 2MB, 4MB, 8MB */
     
     atomic_uint_fast64_t hits;
     atomic_uint_fast64_t misses;
@@ -445,9 +552,24 @@ struct ol_gt_scheduler {
     /* Work stealing queues per priority */
     ol_work_stealing_queue_t queues[5]; /* One per priority level */
     
-    /* Current running thread */
+    /* Current running thread (NULL in the root context) */
     ol_gt_t* current;
     
+    /* Root context: the OS thread's own stack, which picks what runs next */
+#if OL_PLATFORM_WINDOWS
+    void* scheduler_fiber;
+#else
+    void* root_sp;
+#endif
+    uint32_t exit_state;        /* State the thread switching out asked for */
+    
+    /* Ready threads that did not fit in their queue (FIFO via ol_gt.next) */
+    ol_gt_t* overflow_head;
+    ol_gt_t* overflow_tail;
+    
+    /* Next scheduler in the global list (work stealing) */
+    struct ol_gt_scheduler* next;
+    
     /* Statistics */
     ol_gt_statistics_t global_stats;
     
@@ -481,7 +603,7 @@ struct ol_gt_scheduler {
 #elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
     #define OL_PAUSE() _mm_pause()
 #elif defined(__aarch64__) || defined(__arm__)
-    #define OL_PAUSE() asm volatile("yield" ::: "memory")
+    #define OL_PAUSE() __asm__ volatile("yield" ::: "memory")
 #else
     #define OL_PAUSE() ((void)0)
 #endif
@@ -513,12 +635,12 @@ struct ol_gt_scheduler {
     do { \
         _Pragma("GCC diagnostic push") \
         _Pragma("GCC diagnostic ignored \"-Wignored-optimization-argument\"") \
-        asm volatile("" ::: "memory"); \
+        __asm__ volatile("" ::: "memory"); \
         _Pragma("GCC diagnostic pop") \
     } while(0)
 
 #define OL_CRITICAL_SECTION_END() \
-    asm volatile("" ::: "memory")
+    __asm__ volatile("" ::: "memory")
 
 /* ==================== Platform-specific Declarations ==================== */
 
@@ -556,34 +678,6 @@ struct ol_gt_scheduler {
     
 #endif
 
-/* ==================== Assembly Context Switching ==================== */
-
-/**
- * @brief Save current execution context
- * @param ctx Context structure to save into
- * @note Platform-specific assembly implementation
- */
-OL_ALWAYS_INLINE void ol_ctx_save(void* ctx);
-
-/**
- * @brief Restore execution context
- * @param ctx Context structure to restore from
- * @note Platform-specific assembly implementation
- */
-OL_ALWAYS_INLINE void ol_ctx_restore(const void* ctx);
-
-/**
- * @brief Initialize context for new green thread
- * @param ctx Context to initialize
- * @param entry Entry point function
- * @param arg Argument to pass
- * @param stack_base Stack base address
- * @param stack_size Stack size
- * @note Platform-specific assembly implementation
- */
-OL_ALWAYS_INLINE void ol_ctx_make(void* ctx, ol_gt_entry_fn entry, void* arg,
-                                  void* stack_base, size_t stack_size);
-
 /* ==================== Memory Management ==================== */
 
 /**
@@ -678,15 +772,15 @@ const char* ol_gt_error_string(ol_gt_error_t error);
 #define OL_CACHE_ALIGN alignas(OL_CACHE_LINE_SIZE)
 
 /* Compiler barrier */
-#define OL_COMPILER_BARRIER() asm volatile("" ::: "memory")
+#define OL_COMPILER_BARRIER() __asm__ volatile("" ::: "memory")
 
 /* Memory barrier */
 #if defined(__x86_64__) || defined(__i386__)
-    #define OL_MEMORY_BARRIER() asm volatile("mfence" ::: "memory")
+    #define OL_MEMORY_BARRIER() __asm__ volatile("mfence" ::: "memory")
 #elif defined(__aarch64__)
-    #define OL_MEMORY_BARRIER() asm volatile("dmb ish" ::: "memory")
+    #define OL_MEMORY_BARRIER() __asm__ volatile("dmb ish" ::: "memory")
 #elif defined(__arm__)
-    #define OL_MEMORY_BARRIER() asm volatile("dmb" ::: "memory")
+    #define OL_MEMORY_BARRIER() __asm__ volatile("dmb" ::: "memory")
 #else
     #define OL_MEMORY_BARRIER() __sync_synchronize()
 #endif
@@ -710,7 +804,7 @@ const char* ol_gt_error_string(ol_gt_error_t error);
 #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
     static inline uint64_t ol_rdtsc(void) {
         uint32_t lo, hi;
-        asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+        __asm__ volatile("rdtsc" : "=a"(lo), "=d"(hi));
         return ((uint64_t)hi << 32) | lo;
     }
     #define OL_PERF_COUNTER_AVAILABLE 1
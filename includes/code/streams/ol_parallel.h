@@ -14,6 +14,27 @@ typedef struct ol_parallel_pool ol_parallel_pool_t;
 /* Task function signature */
 typedef void (*ol_task_fn)(void *arg);
 
+/* Task priority classes */
+typedef enum {
+    OL_TASK_PRIORITY_HIGH   = 0, /* latency-critical, earliest deadline first */
+    OL_TASK_PRIORITY_NORMAL = 1, /* default (ol_parallel_submit) */
+    OL_TASK_PRIORITY_LOW    = 2  /* background, runs when nothing else is queued */
+} ol_task_priority_t;
+
+#define OL_TASK_PRIORITY_COUNT 3
+
+/* Per-class scheduling counters (see ol_parallel_get_class_stats) */
+typedef struct {
+    size_t   queued;          /* tasks waiting to start */
+    uint64_t submitted;       /* tasks accepted */
+    uint64_t completed;       /* tasks run to completion */
+    uint64_t wait_samples;    /* tasks whose wait was timed: all HIGH and LOW
+                                 tasks, 1 in 16 NORMAL submissions */
+    uint64_t wait_ns_total;   /* sum of timed submit-to-start delays */
+    uint64_t wait_ns_max;     /* longest timed submit-to-start delay */
+    uint64_t deadline_misses; /* HIGH tasks started after their deadline */
+} ol_parallel_class_stats_t;
+
 /* Create a pool with 'num_threads' worker threads (>=1).
  * Returns NULL on failure.
  */
@@ -23,25 +44,108 @@ ol_parallel_pool_t* ol_parallel_create(size_t num_threads);
 void ol_parallel_destroy(ol_parallel_pool_t *pool);
 
 /* Submit a task to the pool (non-blocking).
+ * From a worker thread the task goes to that worker's own queue, where idle
+ * workers may steal it; from other threads it goes to a shared queue.
  * Returns 0 on success, negative on failure.
  */
 int ol_parallel_submit(ol_parallel_pool_t *pool, ol_task_fn fn, void *arg);
 
+/* Submit a task with a priority class.
+ * HIGH tasks run before any other queued work, ordered by deadline_ns
+ * (absolute, ol_monotonic_now_ns() clock; 0 = no deadline, after those
+ * with one). NORMAL is ol_parallel_submit(). LOW tasks run when the pool
+ * is otherwise idle, but still get a minimum share (about 1 in 32 picks)
+ * under sustained load. deadline_ns only orders HIGH tasks.
+ * Returns 0 on success, -2 if the pool is not accepting work, -1 on error.
+ */
+int ol_parallel_submit_ex(ol_parallel_pool_t *pool, ol_task_fn fn, void *arg,
+                          ol_task_priority_t priority, int64_t deadline_ns);
+
+/* Submit 'count' tasks running fn(args[i]) in one go: into the caller's
+ * local queue when it is one of the pool's workers, otherwise under one
+ * lock acquisition of the shared injection queue.
+ * Returns the number of tasks queued (count, or fewer if out of memory),
+ * -2 if the pool is not accepting work, -1 on invalid arguments.
+ */
+int ol_parallel_submit_batch(ol_parallel_pool_t *pool, ol_task_fn fn,
+                             void *const *args, size_t count);
+
 /* Wait until the queue is empty and all currently submitted tasks finish. */
 int ol_parallel_flush(ol_parallel_pool_t *pool);
 
+/* Run one queued task if the caller is one of the pool's workers, so a
+ * worker spinning on a condition another pool task must establish keeps
+ * the pool moving. Returns true if a task ran, false if the caller is not
+ * a worker of pool or nothing was runnable.
+ */
+bool ol_parallel_help(ol_parallel_pool_t *pool);
+
 /* Shutdown:
  * - If drain==true: stop accepting new tasks, run all queued tasks, then stop workers.
- * - If drain==false: stop accepting new tasks, cancel pending (not-yet-started) tasks, stop workers.
+ * - If drain==false: stop accepting new tasks, cancel pending (not-yet-started) tasks,
+ *   stop workers. Runtime tasks others wait on (actor run slices, split ranges of
+ *   ol_parallel_for/reduce) still run.
  * Returns 0 on success.
  */
 int ol_parallel_shutdown(ol_parallel_pool_t *pool, bool drain);
 
+/* Task groups: wait for a subset of the pool's tasks instead of flushing
+ * the whole pool. */
+typedef struct ol_task_group ol_task_group_t;
+
+/* Create a group whose tasks run on 'pool'. Returns NULL on failure. */
+ol_task_group_t* ol_task_group_create(ol_parallel_pool_t *pool);
+
+/* Destroy a group. Wait for it first; pending tasks still reference it. */
+void ol_task_group_destroy(ol_task_group_t *group);
+
+/* Submit fn(arg) as a task of the group.
+ * Returns 0 on success, -2 if the pool is not accepting work, -1 on error.
+ */
+int ol_task_group_run(ol_task_group_t *group, ol_task_fn fn, void *arg);
+
+/* Wait until every task run in the group has finished (or was cancelled by
+ * a non-draining shutdown). Called from one of the pool's workers, it runs
+ * other queued tasks while waiting instead of blocking the thread.
+ * Returns 0 on success.
+ */
+int ol_task_group_wait(ol_task_group_t *group);
+
+/* Data-parallel loops. The range [begin, end) is processed in chunks of at
+ * most 'grain' indices (0 = pick one from the range and thread count),
+ * split adaptively: halves are only handed out when idle workers can take
+ * them. Both calls return once the whole range is done: 0 on success, -2
+ * if the pool is not accepting work, -1 on error. Safe to call from inside
+ * pool tasks (nested loops run on the caller's worker and help).
+ */
+typedef void (*ol_range_fn)(size_t begin, size_t end, void *ctx);
+
+/* Run fn over [begin, end) in parallel chunks. */
+int ol_parallel_for(ol_parallel_pool_t *pool, size_t begin, size_t end, size_t grain,
+                    ol_range_fn fn, void *ctx);
+
+/* Fold [begin, end) into an accumulator of 'result_size' bytes.
+ * 'result' holds the initial (identity) value on entry and the total on
+ * return. fn adds a chunk into acc; combine merges 'other' (the partial
+ * result of the range right after acc's) into acc. Partial results are
+ * combined in range order, so combine only needs to be associative.
+ */
+typedef void (*ol_reduce_fn)(size_t begin, size_t end, void *acc, void *ctx);
+typedef void (*ol_combine_fn)(void *acc, const void *other, void *ctx);
+
+int ol_parallel_reduce(ol_parallel_pool_t *pool, size_t begin, size_t end, size_t grain,
+                       void *result, size_t result_size,
+                       ol_reduce_fn fn, ol_combine_fn combine, void *ctx);
+
 /* Introspection (best-effort) */
 size_t ol_parallel_thread_count(const ol_parallel_pool_t *pool);
 size_t ol_parallel_queue_size(const ol_parallel_pool_t *pool);
 bool   ol_parallel_is_running(const ol_parallel_pool_t *pool);
 
+/* Snapshot the counters of one priority class. Returns 0, or -1 on error. */
+int ol_parallel_get_class_stats(const ol_parallel_pool_t *pool, ol_task_priority_t priority,
+                                ol_parallel_class_stats_t *out);
+
 #ifdef __cplusplus
 }
 #endif
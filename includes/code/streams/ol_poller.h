@@ -23,15 +23,50 @@ typedef struct ol_poller ol_poller_t;
 /** @brief Poll event structure */
 typedef struct {
     int fd;           /**< File descriptor */
-    uint32_t mask;    /**< Event mask (OL_POLL_IN/OUT/ERR) */
-    uint64_t tag;     /**< User tag associated with fd */
+    uint32_t mask;    /**< Event mask (OL_POLL_IN/OUT/ERR or OL_POLL_COMPLETE) */
+    uint64_t tag;     /**< User tag associated with fd (or submitted op) */
+    int32_t result;   /**< Op result for OL_POLL_COMPLETE events (>= 0 or -errno) */
 } ol_poll_event_t;
 
+/** @brief Poller backend selection */
+typedef enum {
+    OL_POLLER_BACKEND_DEFAULT = 0, /**< Platform default (epoll/kqueue/select) */
+    OL_POLLER_BACKEND_IO_URING     /**< Linux: epoll readiness + io_uring completions */
+} ol_poller_backend_t;
+
+/** @brief Completion-based operation types (see ol_poller_submit()) */
+typedef enum {
+    OL_IO_OP_READ,    /**< read(fd, buf, len) */
+    OL_IO_OP_WRITE,   /**< write(fd, buf, len) */
+    OL_IO_OP_RECV,    /**< recv(fd, buf, len, 0) */
+    OL_IO_OP_SEND,    /**< send(fd, buf, len, MSG_NOSIGNAL) */
+    OL_IO_OP_ACCEPT,  /**< accept(fd, NULL, NULL); result is the new fd */
+    OL_IO_OP_CONNECT  /**< connect(fd, buf, len); buf is a struct sockaddr */
+} ol_io_op_type_t;
+
 /** @brief Poll event masks */
 #define OL_POLL_IN  0x01  /**< Readable */
 #define OL_POLL_OUT 0x02  /**< Writable */
 #define OL_POLL_ERR 0x04  /**< Error condition */
 
+/**
+ * @brief Registration mode flags (combine with OL_POLL_IN/OUT)
+ *
+ * OL_POLL_ET reports readiness only on transitions (EPOLLET / EV_CLEAR), so
+ * the caller must drain the fd until EAGAIN. OL_POLL_ONESHOT disarms the fd
+ * after one event (EPOLLONESHOT / EV_ONESHOT) until ol_poller_mod() re-arms
+ * it. Re-arming an edge-triggered fd that is already ready reports it again.
+ * The select backend treats OL_POLL_ET as level-triggered.
+ */
+#define OL_POLL_ET      0x08  /**< Edge-triggered notification */
+#define OL_POLL_ONESHOT 0x10  /**< Disarm after one event */
+
+/** @brief Event mask of a completed submitted operation */
+#define OL_POLL_COMPLETE 0x20
+
+/** @brief Tag reserved for the poller's internal completion notifier */
+#define OL_POLLER_RESERVED_TAG UINT64_MAX
+
 /**
  * @brief Create a new poller instance
  * 
@@ -44,6 +79,51 @@ typedef struct {
  */
 OL_API ol_poller_t* ol_poller_create(void);
 
+/**
+ * @brief Create a poller with an explicit backend
+ * 
+ * OL_POLLER_BACKEND_IO_URING keeps epoll for readiness and adds an
+ * io_uring for completion-based operations. If the kernel lacks io_uring
+ * (or the required opcodes), the poller silently falls back to plain
+ * epoll; check ol_poller_has_completions().
+ * 
+ * @param backend Requested backend
+ * @return New poller handle, or NULL on error
+ */
+OL_API ol_poller_t* ol_poller_create_ex(ol_poller_backend_t backend);
+
+/**
+ * @brief Check whether the poller supports ol_poller_submit()
+ * 
+ * @param p Poller instance
+ * @return true if completion-based operations are available
+ */
+OL_API bool ol_poller_has_completions(const ol_poller_t *p);
+
+/**
+ * @brief Queue a completion-based operation
+ * 
+ * Operations are batched and handed to the kernel on the next
+ * ol_poller_wait(), which reports each completion as an event with
+ * mask OL_POLL_COMPLETE, the submitted tag and the op result. Buffers
+ * must stay valid until the completion is reported. Thread-safe.
+ * 
+ * @param p Poller instance
+ * @param op Operation type
+ * @param fd Target file descriptor
+ * @param buf Data buffer (sockaddr for OL_IO_OP_CONNECT, unused for accept)
+ * @param len Buffer length (sockaddr length for OL_IO_OP_CONNECT)
+ * @param tag Tag reported with the completion (not OL_POLLER_RESERVED_TAG)
+ * @return OL_SUCCESS on success, OL_AGAIN if the submission ring is full,
+ *         OL_ERROR if completions are unsupported
+ */
+OL_API int ol_poller_submit(ol_poller_t *p,
+                            ol_io_op_type_t op,
+                            int fd,
+                            void *buf,
+                            size_t len,
+                            uint64_t tag);
+
 /**
  * @brief Destroy a poller instance
  * 
@@ -56,7 +136,7 @@ OL_API void ol_poller_destroy(ol_poller_t *p);
  * 
  * @param p Poller instance
  * @param fd File descriptor
- * @param mask Event mask (OL_POLL_IN/OUT)
+ * @param mask Event mask (OL_POLL_IN/OUT, optionally OL_POLL_ET/ONESHOT)
  * @param tag User tag associated with fd
  * @return OL_SUCCESS on success, OL_ERROR on error
  */
@@ -70,7 +150,7 @@ OL_API int ol_poller_add(ol_poller_t *p,
  * 
  * @param p Poller instance
  * @param fd File descriptor
- * @param mask New event mask
+ * @param mask New event mask (also re-arms OL_POLL_ONESHOT registrations)
  * @param tag New user tag
  * @return OL_SUCCESS on success, OL_ERROR on error
  */
@@ -138,6 +138,19 @@ OL_API int ol_future_then(ol_future_t *f,
                           ol_future_cb cb,
                           void *user_data);
 
+/**
+ * @brief Remove a continuation that has not run yet
+ * 
+ * @param f Future
+ * @param cb Callback passed to ol_future_then()
+ * @param user_data User data passed to ol_future_then()
+ * @return OL_SUCCESS if removed (cb will never be called),
+ *         OL_ERROR if not registered or already dispatched
+ */
+OL_API int ol_future_remove_then(ol_future_t *f,
+                                 ol_future_cb cb,
+                                 void *user_data);
+
 /**
  * @brief Get value from fulfilled future (const)
  * 
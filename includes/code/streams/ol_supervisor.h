@@ -25,6 +25,7 @@
 #include <stddef.h>
 #include <stdint.h>
 #include "ol_actor.h"
+#include "ol_actor_process.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -72,6 +73,7 @@ typedef struct {
     void* arg;                 /**< Function argument */
     ol_child_policy_t policy;  /**< Restart policy */
     uint32_t shutdown_timeout_ms; /**< Graceful shutdown timeout */
+    size_t arena_size;         /**< Child process arena size (0 = 1MB) */
 } ol_child_spec_t;
 
 /**
@@ -94,8 +96,21 @@ typedef struct {
     int max_restarts;                  /**< Max restarts in window */
     int restart_window_ms;             /**< Restart window in ms */
     bool enable_logging;               /**< Enable supervisor logging */
+    uint32_t shutdown_timeout_ms;      /**< Graceful stop timeout in ms */
 } ol_supervisor_config_t;
 
+/**
+ * @brief Supervisor statistics
+ */
+typedef struct {
+    size_t child_count;                /**< Current number of children */
+    uint64_t max_concurrent_children;  /**< Peak child count */
+    uint64_t total_restarts;           /**< Total restarts performed */
+    uint64_t total_crashes;            /**< Total child crashes */
+    uint64_t uptime_ms;                /**< Time since start */
+    int restarts_in_window;            /**< Restarts in current window */
+} ol_supervisor_stats_t;
+
 /* ==================== Supervisor Lifecycle ==================== */
 
 /**
@@ -207,6 +222,52 @@ int ol_supervisor_get_config(const ol_supervisor_t* supervisor, ol_supervisor_co
  */
 int ol_supervisor_set_config(ol_supervisor_t* supervisor, const ol_supervisor_config_t* config);
 
+/**
+ * @brief Get the supervisor's own process
+ * 
+ * @param supervisor Supervisor instance
+ * @return ol_process_t* Supervisor process, NULL if none
+ */
+ol_process_t* ol_supervisor_get_process(const ol_supervisor_t* supervisor);
+
+/**
+ * @brief Get supervisor statistics
+ * 
+ * @param supervisor Supervisor instance
+ * @param stats Output statistics
+ * @return int OL_SUCCESS on success, OL_ERROR on error
+ */
+int ol_supervisor_get_stats(const ol_supervisor_t* supervisor, ol_supervisor_stats_t* stats);
+
+/**
+ * @brief Restart several children
+ * 
+ * @param supervisor Supervisor instance
+ * @param child_ids Children to restart
+ * @param count Number of entries in child_ids
+ * @return size_t Number of children restarted
+ */
+size_t ol_supervisor_restart_children_batch(ol_supervisor_t* supervisor,
+                                           uint32_t* child_ids, size_t count);
+
+/**
+ * @brief Find a child by its process ID
+ * 
+ * @param supervisor Supervisor instance
+ * @param pid Child process ID
+ * @return uint32_t Child ID, 0 if not found
+ */
+uint32_t ol_supervisor_get_child_by_pid(ol_supervisor_t* supervisor, ol_pid_t pid);
+
+/**
+ * @brief Set the restart intensity and restart its window
+ * 
+ * @param supervisor Supervisor instance
+ * @param max_restarts Max restarts in the window
+ * @param window_ms Window length in ms
+ */
+void ol_supervisor_set_max_restarts(ol_supervisor_t* supervisor, int max_restarts, int window_ms);
+
 /* ==================== Utility Functions ==================== */
 
 /**
@@ -1,9 +1,14 @@
 #include "network/ol_tcp.h"
 
 #include "ol_event_loop.h"
+#include "ol_event_loop_group.h"
 #include "ol_promise.h"
 #include "ol_lock_mutex.h"
 
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
 #if defined(_WIN32)
 #include <winsock2.h>
 #include <ws2tcpip.h>
@@ -19,6 +24,7 @@ static int ol_close_fd(ol_fd_t fd) { return closesocket(fd) == 0 ? 0 : -1; }
 #include <sys/types.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <arpa/inet.h>
 #include <netdb.h>
 #include <unistd.h>
 #include <fcntl.h>
@@ -52,6 +58,20 @@ typedef struct tcp_pending {
     /* For accept, result is a new socket pointer */
 } tcp_pending_t;
 
+struct ol_tcp_socket;
+
+/* Send/recv submitted to the loop's completion ring. Shared by the socket
+ * and the ring (refs); close detaches it so a late completion never touches
+ * a freed socket. */
+typedef struct tcp_uop {
+    ol_mutex_t       mu;       /* guards sock (taken before the socket's mu) */
+    struct ol_tcp_socket *sock; /* NULL once detached by close */
+    uint8_t         *buf;      /* recv buffer (owned) or send cursor */
+    size_t           len;      /* bytes requested by this submission */
+    bool             is_recv;
+    int              refs;
+} tcp_uop_t;
+
 struct ol_tcp_socket {
     ol_event_loop_t *loop;
     ol_fd_t          fd;
@@ -68,12 +88,23 @@ struct ol_tcp_socket {
     tcp_pending_t    pend_send;
     tcp_pending_t    pend_recv;
 
+    /* Completion-mode op in flight (send or recv), NULL in readiness mode */
+    tcp_uop_t       *uop;
+
     /* Sync */
     ol_mutex_t       mu;
 };
 
+/* Sockets are registered edge-triggered so an idle socket that stays
+ * readable/writable does not wake the loop on every poll. Starting an op
+ * re-arms the registration, which reports the fd again if it is ready. */
+#define TCP_POLL_MASK (OL_POLL_IN | OL_POLL_OUT | OL_POLL_ET)
+
 /* Utilities */
 static void set_last_error(ol_tcp_socket_t *s, int e) { s->last_err = e; }
+static void tcp_rearm(ol_tcp_socket_t *s) {
+    if (s->reg_id) (void)ol_event_loop_mod_io(s->loop, s->reg_id, TCP_POLL_MASK);
+}
 static void fulfill_and_reset(tcp_pending_t *p, int status_code, void *value, void (*dtor)(void*)) {
     if (!p->promise) return;
     if (status_code == 0) (void)ol_promise_fulfill(p->promise, value, dtor);
@@ -85,6 +116,114 @@ static void fulfill_and_reset(tcp_pending_t *p, int status_code, void *value, vo
     p->deadline_ns = 0;
 }
 
+/* Completion mode: the loop's poller carries the data transfer itself, so
+ * send/recv finish without a readiness wake-up and a second syscall. */
+static void tcp_uop_release(tcp_uop_t *op) {
+    ol_mutex_lock(&op->mu);
+    int left = --op->refs;
+    ol_mutex_unlock(&op->mu);
+    if (left > 0) return;
+    ol_mutex_destroy(&op->mu);
+    if (op->is_recv) free(op->buf);
+    free(op);
+}
+
+static void tcp_uop_complete(ol_event_loop_t *loop, int result, void *ud);
+
+static int tcp_uop_submit(ol_tcp_socket_t *s, tcp_uop_t *op) {
+    return ol_event_loop_submit(s->loop, op->is_recv ? OL_IO_OP_RECV : OL_IO_OP_SEND,
+                                (int)s->fd, op->buf, op->len, tcp_uop_complete, op);
+}
+
+/* Start a completion-mode op (caller holds s->mu, pending already filled) */
+static int tcp_uop_start(ol_tcp_socket_t *s, bool is_recv) {
+    tcp_uop_t *op = (tcp_uop_t*)calloc(1, sizeof(tcp_uop_t));
+    if (!op) return -1;
+    tcp_pending_t *pend = is_recv ? &s->pend_recv : &s->pend_send;
+    op->is_recv = is_recv;
+    op->len = pend->want_len;
+    op->buf = is_recv ? (uint8_t*)malloc(op->len) : (uint8_t*)pend->send_buf;
+    if (!op->buf || ol_mutex_init(&op->mu) != OL_SUCCESS) {
+        if (is_recv) free(op->buf);
+        free(op);
+        return -1;
+    }
+    op->sock = s;
+    op->refs = 2; /* socket + ring */
+    if (tcp_uop_submit(s, op) != OL_SUCCESS) {
+        op->refs = 1;
+        tcp_uop_release(op);
+        return -1;
+    }
+    s->uop = op;
+    return 0;
+}
+
+static void tcp_uop_complete(ol_event_loop_t *loop, int result, void *ud) {
+    (void)loop;
+    tcp_uop_t *op = (tcp_uop_t*)ud;
+
+    ol_mutex_lock(&op->mu);
+    ol_tcp_socket_t *s = op->sock;
+    bool resubmitted = false;
+    if (s) {
+        ol_mutex_lock(&s->mu);
+        if (s->uop != op) {
+            /* close() already cancelled the promise */
+        } else if (!op->is_recv) {
+            if (result < 0) {
+                set_last_error(s, -result);
+                s->state = TCP_IDLE;
+                fulfill_and_reset(&s->pend_send, -1, NULL, NULL);
+            } else {
+                s->pend_send.want_len -= (size_t)result;
+                op->buf += result;
+                op->len = s->pend_send.want_len;
+                s->pend_send.send_buf = op->buf;
+                if (s->pend_send.want_len == 0) {
+                    s->state = TCP_IDLE;
+                    fulfill_and_reset(&s->pend_send, 0, NULL, NULL);
+                } else if (tcp_uop_submit(s, op) == OL_SUCCESS) {
+                    resubmitted = true; /* short write: ring keeps its ref */
+                } else {
+                    s->state = TCP_IDLE;
+                    fulfill_and_reset(&s->pend_send, -1, NULL, NULL);
+                }
+            }
+        } else if (result < 0) {
+            set_last_error(s, -result);
+            s->state = TCP_IDLE;
+            fulfill_and_reset(&s->pend_recv, -1, NULL, NULL);
+        } else if (result == 0) {
+            s->state = TCP_IDLE;
+            fulfill_and_reset(&s->pend_recv, -2, NULL, NULL);
+        } else {
+            ol_net_buf_t *out = (ol_net_buf_t*)calloc(1, sizeof(ol_net_buf_t));
+            s->state = TCP_IDLE;
+            if (!out) {
+                /* op->buf is freed with the op */
+                set_last_error(s, ENOMEM);
+                fulfill_and_reset(&s->pend_recv, -1, NULL, NULL);
+            } else {
+                out->data = op->buf;
+                out->len  = (size_t)result;
+                out->dtor = free;
+                op->buf = NULL; /* ownership moves to the result */
+                fulfill_and_reset(&s->pend_recv, 0, out, (void(*)(void*))free);
+            }
+        }
+        if (s->uop == op && !resubmitted) {
+            s->uop = NULL;
+            op->sock = NULL;
+            op->refs--; /* socket's ref, op->mu held */
+        }
+        ol_mutex_unlock(&s->mu);
+    }
+    ol_mutex_unlock(&op->mu);
+
+    if (!resubmitted) tcp_uop_release(op);
+}
+
 /* Map endpoint to sockaddr */
 static int ep_to_sockaddr(const ol_endpoint_t *ep, struct sockaddr_storage *ss, socklen_t *ss_len) {
     if (!ep || !ss || !ss_len) return -1;
@@ -154,9 +293,17 @@ static void tcp_io_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *ud
                 (void)ol_set_nonblock(cfd);
                 /* Create child socket wrapper */
                 ol_tcp_socket_t *child = (ol_tcp_socket_t*)calloc(1, sizeof(ol_tcp_socket_t));
+                if (!child) {
+                    (void)ol_close_fd(cfd);
+                    set_last_error(s, ENOMEM);
+                    s->state = TCP_IDLE;
+                    fulfill_and_reset(&s->pend_accept, -1, NULL, NULL);
+                    ol_mutex_unlock(&s->mu);
+                    return;
+                }
                 child->loop = s->loop;
                 child->fd = cfd;
-                child->reg_id = ol_event_loop_register_io(s->loop, (int)cfd, OL_POLL_IN | OL_POLL_OUT, tcp_io_cb, child);
+                child->reg_id = ol_event_loop_register_io(s->loop, (int)cfd, TCP_POLL_MASK, tcp_io_cb, child);
                 child->state = TCP_IDLE;
                 child->last_err = 0;
                 child->is_server = false;
@@ -167,6 +314,13 @@ static void tcp_io_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *ud
             }
         }
 
+        /* A completion-mode op owns the data transfer until it completes;
+         * reading or writing here too would duplicate or reorder bytes. */
+        if (s->uop) {
+            ol_mutex_unlock(&s->mu);
+            return;
+        }
+
         /* SENDING: writable => try to write remaining */
         if (s->state == TCP_SENDING && s->pend_send.promise && s->pend_send.send_buf) {
             const uint8_t *ptr = (const uint8_t*)s->pend_send.send_buf;
@@ -208,6 +362,13 @@ static void tcp_io_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *ud
             if (s->state == TCP_RECEIVING && s->pend_recv.promise && s->pend_recv.want_len > 0) {
                 size_t want = s->pend_recv.want_len;
                 uint8_t *buf = (uint8_t*)malloc(want);
+                if (!buf) {
+                    set_last_error(s, ENOMEM);
+                    s->state = TCP_IDLE;
+                    fulfill_and_reset(&s->pend_recv, -1, NULL, NULL);
+                    ol_mutex_unlock(&s->mu);
+                    return;
+                }
                 #if defined(_WIN32)
                 int got = recv(s->fd, (char*)buf, (int)want, 0);
                 if (got == SOCKET_ERROR) {
@@ -243,6 +404,14 @@ static void tcp_io_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *ud
                     } else {
                         #endif
                         ol_net_buf_t *out = (ol_net_buf_t*)calloc(1, sizeof(ol_net_buf_t));
+                        if (!out) {
+                            free(buf);
+                            set_last_error(s, ENOMEM);
+                            s->state = TCP_IDLE;
+                            fulfill_and_reset(&s->pend_recv, -1, NULL, NULL);
+                            ol_mutex_unlock(&s->mu);
+                            return;
+                        }
                         out->data = buf;
                         out->len  = (size_t)got;
                         out->dtor = free;
@@ -283,7 +452,7 @@ static void tcp_io_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *ud
                 if (ol_set_nonblock(fd) != 0) { set_last_error(s, ol_last_error()); ol_close_fd(fd); return -1; }
 
                 s->fd = fd;
-                s->reg_id = ol_event_loop_register_io(s->loop, (int)fd, OL_POLL_IN | OL_POLL_OUT, tcp_io_cb, s);
+                s->reg_id = ol_event_loop_register_io(s->loop, (int)fd, TCP_POLL_MASK, tcp_io_cb, s);
                 return (s->reg_id != 0) ? 0 : -1;
             }
 
@@ -315,6 +484,47 @@ static void tcp_io_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *ud
                 return 0;
             }
 
+            int ol_tcp_socket_set_reuseport(ol_tcp_socket_t *s, bool on) {
+                if (!s || s->fd == OL_INVALID_FD) return -1;
+                #if defined(SO_REUSEPORT)
+                int v = on ? 1 : 0;
+                if (setsockopt(s->fd, SOL_SOCKET, SO_REUSEPORT, (const void*)&v, sizeof(v)) != 0) {
+                    set_last_error(s, ol_last_error()); return -1;
+                }
+                return 0;
+                #else
+                (void)on;
+                return -1;
+                #endif
+            }
+
+            size_t ol_tcp_listen_sharded(ol_event_loop_group_t *group, const ol_endpoint_t *ep,
+                                         int backlog, ol_tcp_socket_t **out, size_t max) {
+                if (!group || !ep || !out) return 0;
+                size_t n = ol_event_loop_group_size(group);
+                if (n > max) n = max;
+
+                size_t made = 0;
+                for (; made < n; made++) {
+                    ol_tcp_socket_t *s = ol_tcp_socket_create(ol_event_loop_group_get(group, made));
+                    if (!s) break;
+                    if (ol_tcp_socket_open(s, ep->family) != 0 ||
+                        ol_tcp_socket_set_reuseport(s, true) != 0 ||
+                        ol_tcp_socket_bind(s, ep) != 0 ||
+                        ol_tcp_socket_listen(s, backlog) != 0) {
+                        ol_tcp_socket_destroy(s);
+                        break;
+                    }
+                    out[made] = s;
+                }
+
+                if (made < n) {
+                    /* All-or-nothing: a partial shard set would starve some loops */
+                    while (made > 0) { ol_tcp_socket_destroy(out[--made]); out[made] = NULL; }
+                }
+                return made;
+            }
+
             ol_future_t* ol_tcp_socket_accept(ol_tcp_socket_t *s, int64_t deadline_ns) {
                 if (!s || !s->is_server) return NULL;
                 ol_mutex_lock(&s->mu);
@@ -322,12 +532,17 @@ static void tcp_io_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *ud
 
                 ol_promise_t *p = ol_promise_create(s->loop);
                 if (!p) { ol_mutex_unlock(&s->mu); return NULL; }
+                /* Take the future before the loop can settle and free p */
+                ol_future_t *f = ol_promise_get_future(p);
+                if (!f) { ol_promise_destroy(p); ol_mutex_unlock(&s->mu); return NULL; }
                 s->pend_accept.promise = p;
                 s->pend_accept.deadline_ns = deadline_ns;
                 s->state = TCP_ACCEPTING;
                 ol_mutex_unlock(&s->mu);
 
-                ol_future_t *f = ol_promise_get_future(p);
+                /* Pick up connections queued before the op started */
+                tcp_rearm(s);
+
                 return f;
             }
 
@@ -355,12 +570,18 @@ static void tcp_io_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *ud
                 if (s->state != TCP_IDLE || s->pend_connect.promise) { ol_mutex_unlock(&s->mu); return NULL; }
                 ol_promise_t *p = ol_promise_create(s->loop);
                 if (!p) { ol_mutex_unlock(&s->mu); return NULL; }
+                /* Take the future before the loop can settle and free p */
+                ol_future_t *f = ol_promise_get_future(p);
+                if (!f) { ol_promise_destroy(p); ol_mutex_unlock(&s->mu); return NULL; }
                 s->pend_connect.promise = p;
                 s->pend_connect.deadline_ns = deadline_ns;
                 s->state = TCP_CONNECTING;
                 ol_mutex_unlock(&s->mu);
 
-                return ol_promise_get_future(p);
+                /* The writable edge may have fired before the state was set */
+                tcp_rearm(s);
+
+                return f;
             }
 
             ol_future_t* ol_tcp_socket_send(ol_tcp_socket_t *s, const void *buf, size_t len, int64_t deadline_ns) {
@@ -371,18 +592,25 @@ static void tcp_io_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *ud
 
                 ol_promise_t *p = ol_promise_create(s->loop);
                 if (!p) { ol_mutex_unlock(&s->mu); return NULL; }
+                /* Take the future before the loop can settle and free p */
+                ol_future_t *f = ol_promise_get_future(p);
+                if (!f) { ol_promise_destroy(p); ol_mutex_unlock(&s->mu); return NULL; }
 
                 s->pend_send.promise  = p;
                 s->pend_send.send_buf = (void*)buf;
                 s->pend_send.want_len = len;
                 s->pend_send.deadline_ns = deadline_ns;
                 s->state = TCP_SENDING;
+                if (ol_event_loop_has_completions(s->loop) && tcp_uop_start(s, false) == 0) {
+                    ol_mutex_unlock(&s->mu);
+                    return f;
+                }
                 ol_mutex_unlock(&s->mu);
 
-                /* If immediately writable, callback will drain. Otherwise, poller wake ensures loop processes. */
-                (void)ol_event_loop_wake(s->loop);
+                /* If already writable, re-arming reports it and the callback drains. */
+                tcp_rearm(s);
 
-                return ol_promise_get_future(p);
+                return f;
             }
 
             ol_future_t* ol_tcp_socket_recv(ol_tcp_socket_t *s, size_t max_len, int64_t deadline_ns) {
@@ -393,20 +621,33 @@ static void tcp_io_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *ud
 
                 ol_promise_t *p = ol_promise_create(s->loop);
                 if (!p) { ol_mutex_unlock(&s->mu); return NULL; }
+                /* Take the future before the loop can settle and free p */
+                ol_future_t *f = ol_promise_get_future(p);
+                if (!f) { ol_promise_destroy(p); ol_mutex_unlock(&s->mu); return NULL; }
                 s->pend_recv.promise = p;
                 s->pend_recv.want_len = max_len;
                 s->pend_recv.deadline_ns = deadline_ns;
                 s->state = TCP_RECEIVING;
+                if (ol_event_loop_has_completions(s->loop) && tcp_uop_start(s, true) == 0) {
+                    ol_mutex_unlock(&s->mu);
+                    return f;
+                }
                 ol_mutex_unlock(&s->mu);
 
-                (void)ol_event_loop_wake(s->loop);
-                return ol_promise_get_future(p);
+                tcp_rearm(s);
+                return f;
             }
 
             int ol_tcp_socket_close(ol_tcp_socket_t *s) {
                 if (!s) return -1;
                 ol_mutex_lock(&s->mu);
                 if (s->reg_id) { (void)ol_event_loop_unregister(s->loop, s->reg_id); s->reg_id = 0; }
+                tcp_uop_t *uop = s->uop;
+                s->uop = NULL;
+                #if !defined(_WIN32)
+                /* Make an in-flight ring op complete promptly */
+                if (uop && s->fd != OL_INVALID_FD) (void)shutdown(s->fd, SHUT_RDWR);
+                #endif
                 if (s->fd != OL_INVALID_FD) {
                     (void)ol_close_fd(s->fd);
                     s->fd = OL_INVALID_FD;
@@ -418,6 +659,13 @@ static void tcp_io_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *ud
                 if (s->pend_recv.promise)    { ol_promise_cancel(s->pend_recv.promise);    ol_promise_destroy(s->pend_recv.promise);    s->pend_recv.promise = NULL; }
                 s->state = TCP_IDLE;
                 ol_mutex_unlock(&s->mu);
+                if (uop) {
+                    /* Detach outside s->mu (lock order is op, then socket) */
+                    ol_mutex_lock(&uop->mu);
+                    uop->sock = NULL;
+                    ol_mutex_unlock(&uop->mu);
+                    tcp_uop_release(uop);
+                }
                 return 0;
             }
 
@@ -28,7 +28,7 @@
 #include "ol_lock_mutex.h"
 #include "ol_deadlines.h"
 #include "ol_green_threads.h"
-#include "ol_actor_hashmap.h"
+#include "ol_parallel_internal.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -38,6 +38,7 @@
     #include <windows.h>
 #else
     #include <unistd.h>
+    #include <sched.h>
     #include <sys/time.h>
 #endif
 
@@ -61,6 +62,30 @@
  */
 #define ACTOR_BATCH_SIZE         32
 
+/**
+ * @def ACTOR_SCHED_BUDGET
+ * @brief Messages a pooled actor handles per run before it is requeued
+ */
+#define ACTOR_SCHED_BUDGET       128
+
+/**
+ * @def ACTOR_SCHED_DEAD
+ * @brief Scheduling counter value claimed by ol_actor_destroy()
+ */
+#define ACTOR_SCHED_DEAD         (UINT64_C(1) << 63)
+
+/**
+ * @def ACTOR_ASK_POOL_MAX
+ * @brief Free ask records an actor keeps for reuse
+ */
+#define ACTOR_ASK_POOL_MAX       64
+
+/**
+ * @def ACTOR_CALL_SPIN
+ * @brief Polls of the reply slot before ol_actor_call() parks (multi-CPU only)
+ */
+#define ACTOR_CALL_SPIN          1000
+
 /**
  * @def ACTOR_TIMEOUT_MS
  * @brief Default timeout for actor shutdown operations (5 seconds)
@@ -82,34 +107,121 @@
 /* ==================== Internal Structures ==================== */
 
 /**
- * @brief Actor mailbox with lock-free optimizations
+ * @brief Message kinds, recorded in the mailbox node at send time
+ */
+typedef enum {
+    ACTOR_MSG_USER = 0,   /**< Plain message, released with msg_dtor */
+    ACTOR_MSG_ASK  = 1,   /**< Pooled ask record (see actor_ask_t) */
+    ACTOR_MSG_SHARED = 2  /**< Broadcast message shared by several mailboxes */
+} actor_msg_kind_t;
+
+/**
+ * @brief A received message with its kind
+ */
+typedef struct actor_msg {
+    void* msg;                  /**< Message payload */
+    actor_msg_kind_t kind;      /**< How the payload must be released */
+} actor_msg_t;
+
+/**
+ * @brief Mailbox node: one queued message
+ */
+typedef struct actor_msg_node {
+    struct actor_msg_node* volatile next; /**< Next (newer) message */
+    actor_msg_t item;                     /**< Message and kind */
+} actor_msg_node_t;
+
+/**
+ * @brief One broadcast message queued in many mailboxes
+ * 
+ * @details Every mailbox holding it owns one reference; the receiver that
+ * drops the last one runs the destructor.
+ */
+typedef struct actor_shared_msg {
+    void* payload;                   /**< Message handed to each behavior (read-only) */
+    ol_actor_msg_destructor dtor;    /**< Runs once, after the last receiver */
+    volatile size_t refs;            /**< Mailboxes still holding the message */
+} actor_shared_msg_t;
+
+/**
+ * @brief Reply slot states of a pooled ask record
+ */
+enum {
+    ACTOR_ASK_PENDING = 0,      /**< No reply yet */
+    ACTOR_ASK_REPLIED = 1,      /**< Reply stored; the caller owns the record */
+    ACTOR_ASK_ABANDONED = 2     /**< Caller timed out; the replier owns the record */
+};
+
+/**
+ * @brief Pooled ask record
+ * 
+ * @details The public envelope is the first member, so the pointer handed to
+ * the behavior converts back. A record carries either a promise
+ * (ol_actor_ask()) or, with env.reply == NULL, the reply slot of a waiting
+ * ol_actor_call(). Records come from and return to the target actor's free
+ * list, so a warm request/response cycle allocates nothing.
+ */
+typedef struct actor_ask {
+    ol_ask_envelope_t env;           /**< Public part seen by the behavior */
+    struct actor_ask* next_free;     /**< Free-list link */
+    ol_actor_t* owner;               /**< Actor whose free list the record returns to */
+    
+    /* Reply slot (ol_actor_call() only) */
+    volatile uint32_t slot;          /**< ACTOR_ASK_PENDING/REPLIED/ABANDONED */
+    void* value;                     /**< Reply value */
+    ol_actor_value_destructor dtor;  /**< Reply value destructor */
+    int error;                       /**< 0, or the ol_actor_reply_error() code */
+    bool cancelled;                  /**< Request dropped without a reply */
+    ol_mutex_t mutex;                /**< Orders the reply against the caller's exit */
+    ol_cond_t done;                  /**< Signaled when the slot leaves PENDING */
+} actor_ask_t;
+
+/**
+ * @brief Lock-free multi-producer single-consumer message queue
  * 
- * @details This structure implements an optimized mailbox with:
- * - Fast path: single-producer lock-free ring buffer for common case
- * - Slow path: overflow list with mutex protection for high contention
- * - Synchronization primitives for waiting on empty/full conditions
- * - Statistics tracking for monitoring and debugging
+ * @details Vyukov's intrusive MPSC queue. A sender links its node with a
+ * single atomic exchange on tail, so messages from any one sender stay in
+ * FIFO order and senders never wait on each other. The only consumer (the
+ * actor's process, or its current pool run) follows next pointers from a
+ * dummy head node.
+ */
+typedef struct actor_msg_queue {
+    /* Producer side */
+    actor_msg_node_t* volatile tail; /**< Newest node, swapped by senders */
+    char tail_pad[64 - sizeof(void*)]; /**< Keep senders off the consumer's line */
+    
+    /* Consumer side */
+    actor_msg_node_t* head;          /**< Dummy node before the oldest message */
+    char head_pad[64 - sizeof(void*)]; /**< Keep the consumer off the next line */
+} actor_msg_queue_t;
+
+/**
+ * @brief Actor mailbox: a data lane and a priority (system) lane
+ * 
+ * @details Both lanes are actor_msg_queue_t. The consumer always drains the
+ * priority lane first, so control messages (stop requests, exit and cancel
+ * notices) are never queued behind a backlog of user messages. The size
+ * counter covers both lanes and backs ol_actor_mailbox_length(); only the
+ * data lane is bounded by capacity. The mutex and condition variable are
+ * used only to park a process-backed receiver.
  */
 typedef struct actor_mailbox {
-    /* Fast path: single-producer lock-free ring buffer */
-    void** ring_buffer;          /**< Ring buffer array for messages */
-    size_t capacity;             /**< Buffer capacity (number of slots) */
-    volatile size_t head;        /**< Read position (atomic access) */
-    volatile size_t tail;        /**< Write position (atomic access) */
+    actor_msg_queue_t normal;        /**< Data lane (bounded by capacity) */
+    actor_msg_queue_t priority;      /**< System lane (drained first, unbounded) */
     
-    /* Slow path: overflow list for batch processing */
-    void** overflow_list;        /**< List for overflow messages when ring buffer is full */
-    size_t overflow_count;       /**< Number of overflow messages */
+    /* Accounting */
+    size_t capacity;                 /**< Maximum queued messages */
+    volatile size_t size;            /**< Messages queued (reserved before linking) */
+    volatile size_t waiters;         /**< Receivers parked on not_empty */
     
-    /* Synchronization */
-    ol_mutex_t mutex;            /**< Mutex for overflow list synchronization */
-    ol_cond_t not_empty;         /**< Condition variable signaled when mailbox is not empty */
-    ol_cond_t not_full;          /**< Condition variable signaled when mailbox is not full */
+    /* Synchronization (parking only) */
+    ol_mutex_t mutex;                /**< Protects parking on not_empty */
+    ol_cond_t not_empty;             /**< Signaled when a parked receiver may proceed */
     
     /* Statistics */
-    size_t total_messages;       /**< Total messages processed through this mailbox */
-    size_t peak_size;            /**< Peak mailbox size reached */
-    size_t overflow_events;      /**< Number of overflow events (ring buffer full) */
+    volatile size_t peak_size;       /**< Peak mailbox size reached */
+    volatile size_t overflow_events; /**< Sends rejected because the mailbox was full */
+    volatile size_t priority_sent;   /**< Messages sent on the priority lane */
 } actor_mailbox_t;
 
 /**
@@ -150,6 +262,10 @@ struct ol_actor {
     /* Supervisor integration */
     ol_supervisor_t* supervisor;     /**< Parent supervisor (optional) */
     
+    /* M:N scheduling (pooled actors only) */
+    ol_parallel_pool_t* pool;        /**< Pool running the actor, NULL = own process */
+    volatile uint64_t sched;         /**< Pending wake-ups; non-zero while queued/running */
+    
     /* State management */
     volatile uint32_t state;         /**< Actor state flags (bitmask) */
     int exit_code;                   /**< Exit code if actor terminated */
@@ -159,15 +275,30 @@ struct ol_actor {
     uint64_t processing_time_ns;     /**< Total processing time in nanoseconds */
     uint64_t avg_latency_ns;         /**< Average latency per message in nanoseconds */
     
-    /* Ask/Reply tracking */
-    ol_hashmap_t* pending_asks;      /**< Hashmap of pending ask requests */
-    ol_mutex_t ask_mutex;            /**< Mutex for synchronizing ask map access */
+    /* Ask/Reply */
+    actor_ask_t* ask_pool;           /**< Free ask records */
+    size_t ask_pool_size;            /**< Records on the free list */
+    ol_mutex_t ask_mutex;            /**< Protects the free list */
+    volatile size_t ask_refs;        /**< 1 for the actor + records in use */
+    volatile uint64_t next_ask_id;   /**< Source of ask identifiers */
+    ol_ask_envelope_t* current_ask;  /**< Unanswered ask the behavior is handling */
     
     /* Batched processing */
-    void* batch_buffer[ACTOR_BATCH_SIZE]; /**< Buffer for batch message processing */
+    actor_msg_t batch_buffer[ACTOR_BATCH_SIZE]; /**< Buffer for batch message processing */
     size_t batch_count;                   /**< Current number of messages in batch buffer */
 };
 
+/**
+ * @brief Actor group: a member list for broadcast fan-out
+ */
+struct ol_actor_group {
+    ol_actor_t** members;            /**< Member actors */
+    size_t count;                    /**< Number of members */
+    size_t capacity;                 /**< Allocated member slots */
+    void** wake;                     /**< Scratch list of pooled members to schedule */
+    ol_mutex_t mutex;                /**< Serializes membership and broadcasts */
+};
+
 /* Thread-local current actor pointer for ol_actor_self() */
 #if defined(_WIN32)
     static __declspec(thread) ol_actor_t* g_current_actor = NULL;
@@ -175,59 +306,78 @@ struct ol_actor {
     static __thread ol_actor_t* g_current_actor = NULL;
 #endif
 
+/* ==================== State Helpers ==================== */
+
+/*
+ * State is changed from other threads (stop, close, destroy) while the
+ * actor runs, so every access goes through these atomics.
+ */
+
+static inline uint32_t actor_state(const ol_actor_t* actor) {
+    return __atomic_load_n(&actor->state, __ATOMIC_ACQUIRE);
+}
+
+static inline void actor_set_state(ol_actor_t* actor, uint32_t state) {
+    __atomic_store_n(&actor->state, state, __ATOMIC_RELEASE);
+}
+
+static inline uint32_t actor_add_state(ol_actor_t* actor, uint32_t flags) {
+    return __atomic_fetch_or(&actor->state, flags, __ATOMIC_ACQ_REL);
+}
+
+static inline void actor_clear_state(ol_actor_t* actor, uint32_t flags) {
+    __atomic_fetch_and(&actor->state, ~flags, __ATOMIC_ACQ_REL);
+}
+
 /* ==================== Mailbox Implementation ==================== */
 
 /**
- * @brief Create and initialize an optimized mailbox
+ * @brief Create and initialize a mailbox
  * 
  * @param capacity Mailbox capacity (number of messages)
- * @param dtor Message destructor function (can be NULL)
  * @return actor_mailbox_t* Pointer to newly created mailbox, NULL on failure
  * 
- * @note If capacity is 0, a default capacity will be used.
- *       The mailbox includes both a lock-free ring buffer and
- *       an overflow list for handling high contention.
+ * @note No storage is reserved up front: an empty mailbox is one dummy
+ *       node per lane, whatever its capacity.
  */
-static actor_mailbox_t* actor_mailbox_create(size_t capacity, 
-                                            ol_actor_msg_destructor dtor) {
+static actor_mailbox_t* actor_mailbox_create(size_t capacity) {
     actor_mailbox_t* mb = (actor_mailbox_t*)calloc(1, sizeof(actor_mailbox_t));
     if (!mb) return NULL;
     
-    (void)dtor; /* Mark as unused for now */
-    
-    /* Allocate ring buffer */
-    mb->capacity = capacity;
-    mb->ring_buffer = (void**)calloc(capacity, sizeof(void*));
-    if (!mb->ring_buffer) {
+    actor_msg_node_t* dummy = (actor_msg_node_t*)calloc(1, sizeof(actor_msg_node_t));
+    actor_msg_node_t* prio_dummy = (actor_msg_node_t*)calloc(1, sizeof(actor_msg_node_t));
+    if (!dummy || !prio_dummy) {
+        free(dummy);
+        free(prio_dummy);
         free(mb);
         return NULL;
     }
     
-    /* Allocate overflow list */
-    mb->overflow_list = (void**)calloc(capacity, sizeof(void*));
-    if (!mb->overflow_list) {
-        free(mb->ring_buffer);
+    /* Initialize synchronization primitives */
+    if (ol_mutex_init(&mb->mutex) != OL_SUCCESS) {
+        free(dummy);
+        free(prio_dummy);
         free(mb);
         return NULL;
     }
-    
-    /* Initialize synchronization primitives */
-    if (ol_mutex_init(&mb->mutex) != OL_SUCCESS ||
-        ol_cond_init(&mb->not_empty) != OL_SUCCESS ||
-        ol_cond_init(&mb->not_full) != OL_SUCCESS) {
-        free(mb->overflow_list);
-        free(mb->ring_buffer);
+    if (ol_cond_init(&mb->not_empty) != OL_SUCCESS) {
+        ol_mutex_destroy(&mb->mutex);
+        free(dummy);
+        free(prio_dummy);
         free(mb);
         return NULL;
     }
     
-    /* Initialize counters */
-    mb->head = 0;
-    mb->tail = 0;
-    mb->overflow_count = 0;
-    mb->total_messages = 0;
+    mb->normal.head = dummy;
+    mb->normal.tail = dummy;
+    mb->priority.head = prio_dummy;
+    mb->priority.tail = prio_dummy;
+    mb->capacity = capacity;
+    mb->size = 0;
+    mb->waiters = 0;
     mb->peak_size = 0;
     mb->overflow_events = 0;
+    mb->priority_sent = 0;
     
     return mb;
 }
@@ -237,67 +387,152 @@ static actor_mailbox_t* actor_mailbox_create(size_t capacity,
  * 
  * @param mb Mailbox to destroy (can be NULL)
  * 
- * @note This function does NOT call message destructors for any
- *       remaining messages in the mailbox. The caller is responsible
- *       for ensuring all messages are processed or destroyed.
+ * @note Messages still queued are not destroyed; the owner drains them
+ *       first (see ol_actor_destroy()).
  */
 static void actor_mailbox_destroy(actor_mailbox_t* mb) {
     if (!mb) return;
     
-    /* Note: We don't call destructors here because the owner
-       (actor) should have already processed or cleaned up messages */
-    
-    /* Free overflow list */
-    for (size_t i = 0; i < mb->overflow_count; i++) {
-        if (mb->overflow_list[i]) {
-            /* Destructor should be called by owner */
+    actor_msg_queue_t* lanes[2] = { &mb->normal, &mb->priority };
+    for (int i = 0; i < 2; i++) {
+        actor_msg_node_t* node = lanes[i]->head;
+        while (node) {
+            actor_msg_node_t* next = node->next;
+            free(node);
+            node = next;
         }
     }
     
     /* Cleanup synchronization primitives */
-    ol_cond_destroy(&mb->not_full);
     ol_cond_destroy(&mb->not_empty);
     ol_mutex_destroy(&mb->mutex);
     
-    /* Free allocated memory */
-    free(mb->overflow_list);
-    free(mb->ring_buffer);
     free(mb);
 }
 
 /**
- * @brief Fast-path non-blocking send to ring buffer
+ * @brief Number of queued messages
  * 
- * @param mb Mailbox to send to
- * @param msg Message to send (ownership transferred)
- * @return bool true if message was successfully sent, false if buffer full
+ * @param mb Mailbox to inspect
+ * @return size_t Messages sent and not yet received
+ */
+static size_t actor_mailbox_length(const actor_mailbox_t* mb) {
+    return __atomic_load_n(&mb->size, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Link a node at the tail of a lane (any thread)
  * 
- * @note This is the lock-free fast path for single-producer scenarios.
- *       It uses atomic operations to update the tail pointer without locking.
- *       Returns false immediately if the ring buffer is full.
+ * @details One exchange on tail, then the link store. Between the two the
+ * node is not yet reachable; the consumer sees the lane as empty until the
+ * link lands.
  */
-static bool actor_mailbox_try_send_fast(actor_mailbox_t* mb, void* msg) {
-    size_t current_tail = mb->tail;
-    size_t next_tail = (current_tail + 1) % mb->capacity;
-    
-    /* Check if buffer has space (lock-free read of head) */
-    if (next_tail == mb->head) {
+static void actor_msg_queue_link(actor_msg_queue_t* q, actor_msg_node_t* node) {
+    node->next = NULL;
+    actor_msg_node_t* prev = __atomic_exchange_n(&q->tail, node, __ATOMIC_ACQ_REL);
+    __atomic_store_n(&prev->next, node, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Unlink the oldest node of a lane (consumer only)
+ * 
+ * @return bool true if a message was taken
+ */
+static bool actor_msg_queue_take(actor_msg_queue_t* q, actor_msg_t* out_msg) {
+    actor_msg_node_t* head = q->head;
+    actor_msg_node_t* next = __atomic_load_n(&head->next, __ATOMIC_ACQUIRE);
+    if (next == NULL) {
         return false;
     }
     
-    /* Store message in ring buffer */
-    mb->ring_buffer[current_tail] = msg;
+    /* next becomes the new dummy */
+    *out_msg = next->item;
+    next->item.msg = NULL;
+    q->head = next;
+    free(head);
+    return true;
+}
+
+/**
+ * @brief Lock-free send
+ * 
+ * @param mb Mailbox to send to
+ * @param msg Message to send
+ * @param kind Message kind, handed back by actor_mailbox_pop()
+ * @param priority Queue on the priority lane (never rejected as full)
+ * @return int 1 if queued, 0 if the mailbox is full, -1 if out of memory
+ * 
+ * @details A data message reserves a slot in size before linking, so the
+ * capacity bound holds under concurrent senders. A priority message only
+ * counts itself in size: control traffic must get through precisely when
+ * the data lane is saturated.
+ */
+static int actor_mailbox_push(actor_mailbox_t* mb, void* msg,
+                              actor_msg_kind_t kind, bool priority) {
+    size_t size;
+    if (priority) {
+        size = __atomic_fetch_add(&mb->size, 1, __ATOMIC_RELAXED);
+    } else {
+        size = __atomic_load_n(&mb->size, __ATOMIC_RELAXED);
+        do {
+            if (size >= mb->capacity) {
+                __atomic_fetch_add(&mb->overflow_events, 1, __ATOMIC_RELAXED);
+                return 0;
+            }
+        } while (!__atomic_compare_exchange_n(&mb->size, &size, size + 1, true,
+                                              __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    }
     
-    /* Atomic update of tail (release semantics for visibility) */
-    __atomic_store_n(&mb->tail, next_tail, __ATOMIC_RELEASE);
+    actor_msg_node_t* node = (actor_msg_node_t*)malloc(sizeof(actor_msg_node_t));
+    if (!node) {
+        __atomic_fetch_sub(&mb->size, 1, __ATOMIC_RELAXED);
+        return -1;
+    }
+    node->item.msg = msg;
+    node->item.kind = kind;
+    
+    if (priority) {
+        actor_msg_queue_link(&mb->priority, node);
+        __atomic_fetch_add(&mb->priority_sent, 1, __ATOMIC_RELAXED);
+    } else {
+        actor_msg_queue_link(&mb->normal, node);
+    }
     
     /* Update statistics */
-    mb->total_messages++;
-    size_t size = (next_tail > mb->head) ? 
-                 (next_tail - mb->head) : 
-                 (mb->capacity - mb->head + next_tail);
-    if (size > mb->peak_size) mb->peak_size = size;
+    size_t peak = __atomic_load_n(&mb->peak_size, __ATOMIC_RELAXED);
+    while (size + 1 > peak &&
+           !__atomic_compare_exchange_n(&mb->peak_size, &peak, size + 1, true,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
     
+    /* Wake a parked receiver: pairs with the waiter's increment-then-recheck */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (__atomic_load_n(&mb->waiters, __ATOMIC_RELAXED) > 0) {
+        ol_mutex_lock(&mb->mutex);
+        ol_cond_signal(&mb->not_empty);
+        ol_mutex_unlock(&mb->mutex);
+    }
+    
+    return 1;
+}
+
+/**
+ * @brief Take the next message (consumer only)
+ * 
+ * @param mb Mailbox to receive from
+ * @param out_msg Receives the message and its kind
+ * @return bool true if a message was taken
+ * 
+ * @note The priority lane is checked before every data message, so a
+ *       control message waits at most for the batch already taken.
+ */
+static bool actor_mailbox_pop(actor_mailbox_t* mb, actor_msg_t* out_msg) {
+    if (!actor_msg_queue_take(&mb->priority, out_msg) &&
+        !actor_msg_queue_take(&mb->normal, out_msg)) {
+        return false;
+    }
+    
+    __atomic_fetch_sub(&mb->size, 1, __ATOMIC_RELEASE);
     return true;
 }
 
@@ -310,65 +545,410 @@ static bool actor_mailbox_try_send_fast(actor_mailbox_t* mb, void* msg) {
  * @param timeout_ms Timeout in milliseconds (0 = non-blocking, -1 = infinite)
  * @return size_t Number of messages actually received
  * 
- * @note This function tries to receive multiple messages at once to
- *       reduce synchronization overhead. It first tries the lock-free
- *       ring buffer, then falls back to the overflow list.
+ * @note Takes whatever is queued without locking. Only when nothing is
+ *       and a timeout is given does the receiver park; it returns after
+ *       the first wake-up (message, ol_actor_stop() or timeout) so the
+ *       caller can re-check the actor state.
  */
-static size_t actor_mailbox_batch_recv(actor_mailbox_t* mb, void** buffer,
-                                      size_t capacity, int timeout_ms) {
+static size_t actor_mailbox_batch_recv(actor_mailbox_t* mb, actor_msg_t* buffer,
+                                       size_t capacity, int timeout_ms) {
     if (!mb || !buffer || capacity == 0) return 0;
     
     size_t count = 0;
+    while (count < capacity && actor_mailbox_pop(mb, &buffer[count])) {
+        count++;
+    }
+    
+    if (count > 0 || timeout_ms == 0) {
+        return count;
+    }
+    
     ol_deadline_t deadline = ol_deadline_from_ms(timeout_ms);
     
-    while (count < capacity) {
-        /* Try fast path first (lock-free ring buffer) */
-        size_t current_head = mb->head;
-        if (current_head != mb->tail) {
-            /* Messages available in ring buffer */
-            buffer[count++] = mb->ring_buffer[current_head];
-            mb->ring_buffer[current_head] = NULL;
-            
-            /* Update head atomically (release semantics) */
-            size_t next_head = (current_head + 1) % mb->capacity;
-            __atomic_store_n(&mb->head, next_head, __ATOMIC_RELEASE);
+    ol_mutex_lock(&mb->mutex);
+    __atomic_fetch_add(&mb->waiters, 1, __ATOMIC_SEQ_CST);
+    
+    /* Re-check after registering: a sender either sees us or we see it */
+    while (count < capacity && actor_mailbox_pop(mb, &buffer[count])) {
+        count++;
+    }
+    if (count == 0) {
+        (void)ol_cond_wait_until(&mb->not_empty, &mb->mutex, deadline.when_ns);
+        while (count < capacity && actor_mailbox_pop(mb, &buffer[count])) {
+            count++;
+        }
+    }
+    
+    __atomic_fetch_sub(&mb->waiters, 1, __ATOMIC_RELAXED);
+    ol_mutex_unlock(&mb->mutex);
+    
+    return count;
+}
+
+/* ==================== Ask Records ==================== */
+
+/**
+ * @brief Free an ask record's memory
+ */
+static void actor_ask_free(actor_ask_t* ask) {
+    ol_cond_destroy(&ask->done);
+    ol_mutex_destroy(&ask->mutex);
+    free(ask);
+}
+
+/**
+ * @brief Drop a reference to the actor's ask state
+ * 
+ * @param actor Actor owning the free list
+ * 
+ * @details ol_actor_destroy() holds one reference and every record taken
+ * from the pool holds another, so a caller whose ol_actor_call() was
+ * answered (or cancelled) by the teardown can still hand its record back.
+ * The last reference frees the free list and the actor structure itself.
+ */
+static void actor_ask_unref(ol_actor_t* actor) {
+    if (__atomic_sub_fetch(&actor->ask_refs, 1, __ATOMIC_ACQ_REL) != 0) {
+        return;
+    }
+    
+    while (actor->ask_pool) {
+        actor_ask_t* ask = actor->ask_pool;
+        actor->ask_pool = ask->next_free;
+        actor_ask_free(ask);
+    }
+    ol_mutex_destroy(&actor->ask_mutex);
+    free(actor);
+}
+
+/**
+ * @brief Take an ask record from the actor's free list (or allocate one)
+ * 
+ * @param actor Actor the ask is sent to
+ * @return actor_ask_t* Reset record, NULL on allocation failure
+ */
+static actor_ask_t* actor_ask_acquire(ol_actor_t* actor) {
+    __atomic_add_fetch(&actor->ask_refs, 1, __ATOMIC_RELAXED);
+    
+    ol_mutex_lock(&actor->ask_mutex);
+    actor_ask_t* ask = actor->ask_pool;
+    if (ask) {
+        actor->ask_pool = ask->next_free;
+        actor->ask_pool_size--;
+    }
+    ol_mutex_unlock(&actor->ask_mutex);
+    
+    if (ask == NULL) {
+        ask = (actor_ask_t*)calloc(1, sizeof(actor_ask_t));
+        if (ask == NULL) {
+            actor_ask_unref(actor);
+            return NULL;
+        }
+        if (ol_mutex_init(&ask->mutex) != OL_SUCCESS) {
+            free(ask);
+            actor_ask_unref(actor);
+            return NULL;
+        }
+        if (ol_cond_init(&ask->done) != OL_SUCCESS) {
+            ol_mutex_destroy(&ask->mutex);
+            free(ask);
+            actor_ask_unref(actor);
+            return NULL;
+        }
+        ask->owner = actor;
+    }
+    
+    ask->env.payload = NULL;
+    ask->env.reply = NULL;
+    ask->env.sender = ol_actor_self();
+    ask->env.ask_id = __atomic_add_fetch(&actor->next_ask_id, 1, __ATOMIC_RELAXED);
+    ask->next_free = NULL;
+    ask->slot = ACTOR_ASK_PENDING;
+    ask->value = NULL;
+    ask->dtor = NULL;
+    ask->error = 0;
+    ask->cancelled = false;
+    return ask;
+}
+
+/**
+ * @brief Return an ask record to its owner's free list
+ * 
+ * @param ask Record no longer referenced by a caller or the mailbox
+ * 
+ * @details Drops the record's reference to the owner, which may free it.
+ */
+static void actor_ask_release(actor_ask_t* ask) {
+    ol_actor_t* actor = ask->owner;
+    
+    ol_mutex_lock(&actor->ask_mutex);
+    if (actor->ask_pool_size < ACTOR_ASK_POOL_MAX) {
+        ask->next_free = actor->ask_pool;
+        actor->ask_pool = ask;
+        actor->ask_pool_size++;
+        ask = NULL;
+    }
+    ol_mutex_unlock(&actor->ask_mutex);
+    
+    if (ask) {
+        actor_ask_free(ask);
+    }
+    actor_ask_unref(actor);
+}
+
+/**
+ * @brief Deliver the outcome of an ask and give up the record
+ * 
+ * @param ask Record taken from the mailbox
+ * @param value Reply value (ok only)
+ * @param dtor Reply value destructor (ok only)
+ * @param error Error code (error only)
+ * @param cancelled Request dropped without a reply
+ * 
+ * @details A promise-backed ask resolves its promise. A call stores the reply
+ * in the record and wakes the caller, who then owns the record; the slot is
+ * set under the record's mutex so the caller cannot recycle the record
+ * before the signal is sent. If the caller already gave up, the reply is
+ * destroyed and the record goes back to the pool here.
+ */
+static void actor_ask_complete(actor_ask_t* ask, void* value,
+                               ol_actor_value_destructor dtor,
+                               int error, bool cancelled) {
+    if (ask->owner->current_ask == &ask->env) {
+        ask->owner->current_ask = NULL;
+    }
+    
+    if (ask->env.reply != NULL) {
+        if (cancelled) {
+            ol_promise_cancel(ask->env.reply);
+        } else if (error != 0) {
+            ol_promise_reject(ask->env.reply, error);
+        } else {
+            ol_promise_fulfill(ask->env.reply, value, dtor);
+        }
+        ol_promise_destroy(ask->env.reply);
+        ask->env.reply = NULL;
+        actor_ask_release(ask);
+        return;
+    }
+    
+    ol_mutex_lock(&ask->mutex);
+    bool abandoned = __atomic_load_n(&ask->slot, __ATOMIC_RELAXED) == ACTOR_ASK_ABANDONED;
+    if (!abandoned) {
+        ask->value = value;
+        ask->dtor = dtor;
+        ask->error = error;
+        ask->cancelled = cancelled;
+        __atomic_store_n(&ask->slot, ACTOR_ASK_REPLIED, __ATOMIC_RELEASE);
+        ol_cond_signal(&ask->done);
+    }
+    ol_mutex_unlock(&ask->mutex);
+    
+    if (abandoned) {
+        /* Caller timed out: nobody will read the reply */
+        if (value && dtor) {
+            dtor(value);
+        }
+        actor_ask_release(ask);
+    }
+}
+
+/**
+ * @brief Reply-slot polls worth doing before parking
+ * 
+ * @return int ACTOR_CALL_SPIN, or 0 on a single CPU where polling only
+ *         delays the replier
+ */
+static int actor_call_spin_limit(void) {
+    static volatile int limit = -1;
+    int cached = __atomic_load_n(&limit, __ATOMIC_RELAXED);
+    if (cached >= 0) {
+        return cached;
+    }
+    
+#if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    long cpus = (long)info.dwNumberOfProcessors;
+#else
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    cached = cpus > 1 ? ACTOR_CALL_SPIN : 0;
+    __atomic_store_n(&limit, cached, __ATOMIC_RELAXED);
+    return cached;
+}
+
+/**
+ * @brief Wait for the reply to an ol_actor_call()
+ * 
+ * @param ask Record sent with the call
+ * @param timeout_ms Timeout in milliseconds (0 = infinite)
+ * @return bool true if the slot was filled, false if the caller gave up
+ * 
+ * @details On a multi-CPU machine the slot is polled briefly first, since
+ * a reply from a running actor usually lands within a few hundred
+ * nanoseconds; then the caller parks. Taking the
+ * mutex at the end also waits for the replier to leave the record.
+ */
+static bool actor_ask_wait(actor_ask_t* ask, uint32_t timeout_ms) {
+    int spins = actor_call_spin_limit();
+    for (int spin = 0; spin < spins; spin++) {
+        if (__atomic_load_n(&ask->slot, __ATOMIC_ACQUIRE) != ACTOR_ASK_PENDING) {
+            break;
+        }
+        OL_PAUSE();
+    }
+    
+    ol_deadline_t deadline = ol_deadline_from_ms(timeout_ms);
+    int64_t when_ns = timeout_ms == 0 ? 0 : deadline.when_ns;
+    
+    ol_mutex_lock(&ask->mutex);
+    while (__atomic_load_n(&ask->slot, __ATOMIC_RELAXED) == ACTOR_ASK_PENDING) {
+        if (timeout_ms != 0 && ol_deadline_expired(deadline)) {
+            __atomic_store_n(&ask->slot, ACTOR_ASK_ABANDONED, __ATOMIC_RELAXED);
+            break;
+        }
+        (void)ol_cond_wait_until(&ask->done, &ask->mutex, when_ns);
+    }
+    bool replied = __atomic_load_n(&ask->slot, __ATOMIC_RELAXED) == ACTOR_ASK_REPLIED;
+    ol_mutex_unlock(&ask->mutex);
+    
+    return replied;
+}
+
+/* ==================== Message Dispatch ==================== */
+
+/**
+ * @brief Drop one mailbox's reference to a broadcast message
+ */
+static void actor_shared_release(actor_shared_msg_t* shared) {
+    if (__atomic_sub_fetch(&shared->refs, 1, __ATOMIC_ACQ_REL) != 0) {
+        return;
+    }
+    
+    if (shared->payload && shared->dtor) {
+        shared->dtor(shared->payload);
+    }
+    free(shared);
+}
+
+/**
+ * @brief Release a message that will not reach the behavior
+ * 
+ * @param actor Actor owning the message
+ * @param item Message and kind
+ */
+static void actor_drop_message(ol_actor_t* actor, const actor_msg_t* item) {
+    if (item->kind == ACTOR_MSG_ASK) {
+        actor_ask_t* ask = (actor_ask_t*)item->msg;
+        if (ask->env.payload && actor->msg_dtor) {
+            actor->msg_dtor(ask->env.payload);
+        }
+        actor_ask_complete(ask, NULL, NULL, 0, true);
+    } else if (item->kind == ACTOR_MSG_SHARED) {
+        actor_shared_release((actor_shared_msg_t*)item->msg);
+    } else if (item->msg && actor->msg_dtor) {
+        actor->msg_dtor(item->msg);
+    }
+}
+
+/**
+ * @brief Run the behavior over a batch of received messages
+ * 
+ * @param actor Actor instance
+ * @param batch Received messages
+ * @param batch_size Number of messages in batch
+ * 
+ * @details Shared by the process loop and the pool scheduler. Stops at the
+ * first message whose behavior requests a stop (>0) or fails (<0); the rest
+ * of the batch is released without being handled. An ask is recognized by
+ * the kind recorded at send time, never by inspecting the payload; the
+ * behavior receives its ol_ask_envelope_t, and an ask left unanswered is
+ * cancelled once the behavior returns. A broadcast message is shown to
+ * the behavior and then released by reference, never with msg_dtor.
+ */
+static void actor_dispatch_batch(ol_actor_t* actor, actor_msg_t* batch, size_t batch_size) {
+    /* Process batch with timing for performance metrics */
+    uint64_t start_time = ol_monotonic_now_ns();
+    
+    size_t i = 0;
+    for (; i < batch_size; i++) {
+        void* msg = batch[i].msg;
+        if (!msg) continue;
+        
+        bool is_ask = batch[i].kind == ACTOR_MSG_ASK;
+        actor->current_ask = is_ask ? (ol_ask_envelope_t*)msg : NULL;
+        
+        /* A broadcast message is shared: the behavior sees the payload and
+         * the reference is dropped afterwards, whatever the outcome */
+        actor_shared_msg_t* shared = NULL;
+        if (batch[i].kind == ACTOR_MSG_SHARED) {
+            shared = (actor_shared_msg_t*)msg;
+            msg = shared->payload;
+        }
+        
+        bool stop = false;
+        
+        /* Execute behavior if defined */
+        if (actor->behavior) {
+            int result = actor->behavior(actor, msg);
             
-            /* Signal not_full if needed (buffer now has space) */
-            if ((next_head + 1) % mb->capacity == mb->tail) {
-                ol_cond_signal(&mb->not_full);
+            /* Handle behavior result */
+            if (result > 0) {
+                /* Behavior requested graceful stop */
+                actor_set_state(actor, ACTOR_STATE_STOPPING);
+                stop = true;
+            } else if (result < 0) {
+                /* Behavior reported error - treat as crash */
+                actor_set_state(actor, ACTOR_STATE_CRASHED);
+                actor->exit_code = result;
+                
+                /* Notify supervisor if one exists */
+                if (actor->supervisor) {
+                    /* TODO: Send error notification to supervisor */
+                }
+                stop = true;
             }
             
-            continue;
+            /* Clean up non-ask messages (asks are cleaned by reply functions) */
+            if (!stop && !is_ask && !shared && actor->msg_dtor) {
+                actor->msg_dtor(msg);
+            }
+        } else if (!is_ask && !shared && actor->msg_dtor) {
+            /* No behavior defined - just clean up message */
+            actor->msg_dtor(msg);
         }
         
-        /* Check overflow list (requires mutex) */
-        ol_mutex_lock(&mb->mutex);
-        if (mb->overflow_count > 0) {
-            buffer[count++] = mb->overflow_list[--mb->overflow_count];
-            ol_mutex_unlock(&mb->mutex);
-            continue;
+        if (shared) {
+            actor_shared_release(shared);
         }
-        ol_mutex_unlock(&mb->mutex);
         
-        /* No messages available */
-        if (count > 0 || timeout_ms == 0) {
-            break;
+        /* Ask the behavior did not reply to: the asker must not hang */
+        if (actor->current_ask) {
+            actor_ask_complete((actor_ask_t*)actor->current_ask, NULL, NULL, 0, true);
         }
         
-        /* Wait for messages with timeout */
-        ol_mutex_lock(&mb->mutex);
-        if (mb->overflow_count == 0) {
-            int result = ol_cond_wait_until(&mb->not_empty, &mb->mutex,
-                                           deadline.when_ns);
-            if (result <= 0) {
-                ol_mutex_unlock(&mb->mutex);
-                break; /* Timeout or error */
-            }
+        actor->processed_messages++;
+        
+        if (stop) {
+            i++;
+            break;
         }
-        ol_mutex_unlock(&mb->mutex);
     }
     
-    return count;
+    /* Messages after a stop or crash are never handled */
+    for (; i < batch_size; i++) {
+        actor_drop_message(actor, &batch[i]);
+    }
+    
+    /* Update performance metrics */
+    uint64_t end_time = ol_monotonic_now_ns();
+    actor->processing_time_ns += (end_time - start_time);
+    
+    if (batch_size > 0) {
+        /* Update exponential moving average of latency */
+        actor->avg_latency_ns = (actor->avg_latency_ns * 7 + 
+                                (end_time - start_time) / batch_size) / 8;
+    }
 }
 
 /* ==================== Process Entry Functions ==================== */
@@ -391,6 +971,7 @@ static size_t actor_mailbox_batch_recv(actor_mailbox_t* mb, void** buffer,
  *       so ol_actor_self() works within actor behaviors.
  */
 static void ol_actor_process_entry(ol_process_t* process, void* arg) {
+    (void)process;
     ol_actor_t* actor = (ol_actor_t*)arg;
     if (!actor) return;
     
@@ -398,99 +979,182 @@ static void ol_actor_process_entry(ol_process_t* process, void* arg) {
     g_current_actor = actor;
     
     /* Update actor state to running */
-    actor->state = ACTOR_STATE_RUNNING;
+    actor_set_state(actor, ACTOR_STATE_RUNNING);
     
     /* Main actor processing loop */
-    void* batch[ACTOR_BATCH_SIZE];
+    actor_msg_t batch[ACTOR_BATCH_SIZE];
     
-    while (actor->state & ACTOR_STATE_RUNNING) {
+    while (actor_state(actor) & ACTOR_STATE_RUNNING) {
         /* Batch receive messages for efficiency */
         size_t batch_size = actor_mailbox_batch_recv(
             actor->mailbox, batch, ACTOR_BATCH_SIZE, 1000);
         
         if (batch_size == 0) {
             /* Check for stop signal when no messages */
-            if (actor->state & ACTOR_STATE_STOPPING) {
+            if (actor_state(actor) & ACTOR_STATE_STOPPING) {
                 break;
             }
             continue;
         }
         
-        /* Process batch with timing for performance metrics */
-        uint64_t start_time = ol_monotonic_now_ns();
+        actor_dispatch_batch(actor, batch, batch_size);
         
-        for (size_t i = 0; i < batch_size; i++) {
-            if (!batch[i]) continue;
-            
-            /* Check if this is an ask envelope */
-            bool is_ask = false;
-            ol_ask_envelope_t* ask_env = NULL;
-            
-            /* Simple type detection - look for ask envelope signature */
-            ask_env = (ol_ask_envelope_t*)batch[i];
-            if (ask_env && ask_env->reply != NULL) {
-                is_ask = true;
-            }
-            
-            /* Execute behavior if defined */
-            if (actor->behavior) {
-                int result = actor->behavior(actor, batch[i]);
-                
-                /* Handle behavior result */
-                if (result > 0) {
-                    /* Behavior requested graceful stop */
-                    actor->state = ACTOR_STATE_STOPPING;
-                    break;
-                } else if (result < 0) {
-                    /* Behavior reported error - treat as crash */
-                    actor->state = ACTOR_STATE_CRASHED;
-                    actor->exit_code = result;
-                    
-                    /* Notify supervisor if one exists */
-                    if (actor->supervisor) {
-                        /* TODO: Send error notification to supervisor */
-                    }
-                    break;
-                }
-                
-                /* Clean up non-ask messages (asks are cleaned by reply functions) */
-                if (!is_ask && actor->msg_dtor) {
-                    actor->msg_dtor(batch[i]);
-                }
-            } else {
-                /* No behavior defined - just clean up message */
-                if (actor->msg_dtor) {
-                    actor->msg_dtor(batch[i]);
-                }
-            }
-            
-            /* Handle unconsumed ask envelope (actor didn't reply) */
-            if (is_ask && ask_env && ask_env->reply != NULL) {
-                ol_actor_reply_cancel(ask_env);
-            }
-            
-            actor->processed_messages++;
+        /* Check for state changes that should terminate the loop */
+        if (actor_state(actor) & (ACTOR_STATE_STOPPING | ACTOR_STATE_CRASHED)) {
+            break;
+        }
+    }
+    
+    /* Cleanup before exit */
+    actor_set_state(actor, ACTOR_STATE_CLOSED);
+    g_current_actor = NULL;
+}
+
+/* ==================== Pool Scheduling ==================== */
+
+/**
+ * @brief Whether a pooled actor in this state should (keep) running
+ */
+static inline bool actor_runnable(uint32_t state) {
+    return (state & ACTOR_STATE_RUNNING) &&
+           !(state & (ACTOR_STATE_CRASHED | ACTOR_STATE_CLOSED));
+}
+
+static void actor_run_slice(void* arg);
+
+/**
+ * @brief Queue a pooled actor for a run unless it is already queued
+ * 
+ * @param actor Pooled actor
+ * 
+ * @details sched counts wake-ups since the actor was last idle; only the
+ * wake-up that moves it off zero submits a run, so any number of senders
+ * cost one pool task. ACTOR_SCHED_DEAD keeps it non-zero for good. The run
+ * is kept across a cancelling pool shutdown: a dropped run would leave
+ * sched set and hang ol_actor_destroy().
+ */
+static void actor_schedule(ol_actor_t* actor) {
+    if (__atomic_fetch_add(&actor->sched, 1, __ATOMIC_ACQ_REL) != 0) {
+        return; /* Queued or running: that run will see the new work */
+    }
+    
+    if (ol_parallel_submit_kept(actor->pool, actor_run_slice, actor) != 0) {
+        /* Pool shutting down: nothing will run the actor again */
+        __atomic_store_n(&actor->sched, 0, __ATOMIC_RELEASE);
+    }
+}
+
+/**
+ * @brief Record a wake-up; true if the caller must submit the actor's run
+ * 
+ * @param actor Pooled actor that received a message
+ * @return bool true if the actor was idle (the caller submits it, e.g. in
+ *         a batch), false if a queued or running slice will see the work
+ * 
+ * @note Same protocol as actor_notify(), split so a broadcast can wake many
+ *       actors with one ol_parallel_submit_batch_kept().
+ */
+static bool actor_wake_claim(ol_actor_t* actor) {
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (!actor_runnable(actor_state(actor))) {
+        return false;
+    }
+    return __atomic_fetch_add(&actor->sched, 1, __ATOMIC_ACQ_REL) == 0;
+}
+
+/**
+ * @brief Wake a pooled actor after a message was enqueued
+ * 
+ * @param actor Actor that received a message
+ * 
+ * @note Pairs with the fence in ol_actor_start(): either start sees the
+ *       message or we see the running flag.
+ */
+static void actor_notify(ol_actor_t* actor) {
+    if (actor->pool == NULL) {
+        return; /* Process-backed actor waits on the mailbox itself */
+    }
+    
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (actor_runnable(actor_state(actor))) {
+        actor_schedule(actor);
+    }
+}
+
+/**
+ * @brief Pool task: run a pooled actor for up to ACTOR_SCHED_BUDGET messages
+ * 
+ * @param arg Actor instance
+ * 
+ * @details Holds no context between runs: an actor whose mailbox is empty
+ * returns its thread to the pool. A busy actor is requeued behind other
+ * ready actors when its budget is spent. The final write to sched is the
+ * last access to the actor, so ol_actor_destroy() may free it right after.
+ */
+static void actor_run_slice(void* arg) {
+    ol_actor_t* actor = (ol_actor_t*)arg;
+    ol_actor_t* prev_actor = g_current_actor;
+    g_current_actor = actor;
+    
+    actor_msg_t batch[ACTOR_BATCH_SIZE];
+    size_t budget = ACTOR_SCHED_BUDGET;
+    bool finished = false;
+    
+    while (budget > 0) {
+        if (!actor_runnable(actor_state(actor))) {
+            finished = true;
+            break;
+        }
+        
+        size_t want = budget < ACTOR_BATCH_SIZE ? budget : ACTOR_BATCH_SIZE;
+        size_t batch_size = actor_mailbox_batch_recv(actor->mailbox, batch, want, 0);
+        if (batch_size == 0) {
+            /* Graceful stop completes once the mailbox is drained */
+            finished = (actor_state(actor) & ACTOR_STATE_STOPPING) != 0;
+            break;
+        }
+        
+        budget -= batch_size;
+        actor_dispatch_batch(actor, batch, batch_size);
+    }
+    
+    if (!actor_runnable(actor_state(actor))) {
+        finished = true;
+    }
+    
+    g_current_actor = prev_actor;
+    
+    if (finished) {
+        actor_set_state(actor, ACTOR_STATE_CLOSED);
+        __atomic_store_n(&actor->sched, 0, __ATOMIC_RELEASE);
+        return;
+    }
+    
+    if (budget == 0) {
+        /* Still busy: requeue behind other ready actors, stay scheduled */
+        if (ol_parallel_submit_kept(actor->pool, actor_run_slice, actor) != 0) {
+            __atomic_store_n(&actor->sched, 0, __ATOMIC_RELEASE);
         }
-        
-        /* Update performance metrics */
-        uint64_t end_time = ol_monotonic_now_ns();
-        actor->processing_time_ns += (end_time - start_time);
-        
-        if (batch_size > 0) {
-            /* Update exponential moving average of latency */
-            actor->avg_latency_ns = (actor->avg_latency_ns * 7 + 
-                                    (end_time - start_time) / batch_size) / 8;
+        return;
+    }
+    
+    /* Go idle unless a wake-up arrived while we were running: a sender
+     * enqueues before bumping sched, so if the CAS succeeds any message it
+     * pushed was visible to the emptiness check above */
+    uint64_t seen = __atomic_load_n(&actor->sched, __ATOMIC_ACQUIRE);
+    for (;;) {
+        if (ol_actor_mailbox_length(actor) > 0 ||
+            (actor_state(actor) & ACTOR_STATE_STOPPING)) {
+            if (ol_parallel_submit_kept(actor->pool, actor_run_slice, actor) != 0) {
+                __atomic_store_n(&actor->sched, 0, __ATOMIC_RELEASE);
+            }
+            return;
         }
-        
-        /* Check for state changes that should terminate the loop */
-        if (actor->state & (ACTOR_STATE_STOPPING | ACTOR_STATE_CRASHED)) {
-            break;
+        if (__atomic_compare_exchange_n(&actor->sched, &seen, 0, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            return;
         }
     }
-    
-    /* Cleanup before exit */
-    actor->state = ACTOR_STATE_CLOSED;
-    g_current_actor = NULL;
 }
 
 /* ==================== Public API Implementation ==================== */
@@ -498,7 +1162,7 @@ static void ol_actor_process_entry(ol_process_t* process, void* arg) {
 /**
  * @brief Create a new actor instance
  * 
- * @param pool Parallel pool for execution (deprecated, kept for API compatibility)
+ * @param pool Pool that runs the actor (NULL = dedicated process)
  * @param capacity Mailbox capacity (0 = unbounded, uses default)
  * @param dtor Message destructor function (can be NULL)
  * @param initial Initial behavior function (must not be NULL)
@@ -506,10 +1170,13 @@ static void ol_actor_process_entry(ol_process_t* process, void* arg) {
  * @return ol_actor_t* New actor instance, NULL on failure
  * 
  * @details Creates a fully isolated actor with:
- * - Private memory arena (2MB default)
+ * - Private memory arena (2MB default, created on first use)
  * - Optimized mailbox with specified capacity
- * - Isolated process for execution
- * - Ask/reply tracking hashmap
+ * - Isolated process for execution, or M:N scheduling on pool
+ * - Ask record free list
+ * 
+ * A pooled actor holds no process, stack or thread while its mailbox is
+ * empty; a send that finds it idle queues it on the pool.
  * 
  * @note The actor is created in a stopped state. Call ol_actor_start() to begin execution.
  * @warning The initial behavior function must not be NULL.
@@ -519,9 +1186,6 @@ ol_actor_t* ol_actor_create(ol_parallel_pool_t* pool,
                             ol_actor_msg_destructor dtor,
                             ol_actor_behavior initial,
                             void* user_ctx) {
-    /* Note: pool parameter is deprecated but kept for API compatibility */
-    (void)pool;
-    
     /* Validate parameters */
     if (initial == NULL) {
         return NULL;
@@ -533,18 +1197,14 @@ ol_actor_t* ol_actor_create(ol_parallel_pool_t* pool,
         return NULL;
     }
     
-    /* Create private memory arena for isolation */
-    actor->private_arena = ol_arena_create(ACTOR_DEFAULT_ARENA_SIZE, false);
-    if (actor->private_arena == NULL) {
-        free(actor);
-        return NULL;
-    }
+    /* Private arena is mapped lazily by ol_actor_get_arena(): one mapping
+     * per actor would exhaust the map count long before a million actors */
+    actor->private_arena = NULL;
     
     /* Initialize mailbox with specified capacity */
     actor->mailbox = actor_mailbox_create(
-        capacity > 0 ? capacity : ACTOR_MAILBOX_CAPACITY, dtor);
+        capacity > 0 ? capacity : ACTOR_MAILBOX_CAPACITY);
     if (actor->mailbox == NULL) {
-        ol_arena_destroy(actor->private_arena);
         free(actor);
         return NULL;
     }
@@ -554,39 +1214,37 @@ ol_actor_t* ol_actor_create(ol_parallel_pool_t* pool,
     actor->user_context = user_ctx;
     actor->msg_dtor = dtor;
     actor->supervisor = NULL;
-    actor->state = 0;
+    actor->pool = pool;
+    actor->sched = 0;
+    actor_set_state(actor, 0);
     actor->exit_code = 0;
     actor->processed_messages = 0;
     actor->processing_time_ns = 0;
     actor->avg_latency_ns = 0;
     actor->batch_count = 0;
+    actor->ask_pool = NULL;
+    actor->ask_pool_size = 0;
+    actor->ask_refs = 1;
+    actor->next_ask_id = 0;
+    actor->current_ask = NULL;
     
-    /* Create hashmap for tracking pending ask requests */
-    actor->pending_asks = ol_hashmap_create(16, NULL);
-    if (actor->pending_asks == NULL) {
+    /* Initialize mutex for the ask record free list */
+    if (ol_mutex_init(&actor->ask_mutex) != OL_SUCCESS) {
         actor_mailbox_destroy(actor->mailbox);
-        ol_arena_destroy(actor->private_arena);
         free(actor);
         return NULL;
     }
     
-    /* Initialize mutex for ask hashmap synchronization */
-    if (ol_mutex_init(&actor->ask_mutex) != OL_SUCCESS) {
-        ol_hashmap_destroy(actor->pending_asks);
-        actor_mailbox_destroy(actor->mailbox);
-        ol_arena_destroy(actor->private_arena);
-        free(actor);
-        return NULL;
+    /* Pooled actors are run by the pool; others get an isolated process */
+    if (pool != NULL) {
+        return actor;
     }
     
-    /* Create isolated process for actor execution */
     actor->process = ol_process_create(ol_actor_process_entry, actor,
                                       NULL, 0, ACTOR_DEFAULT_ARENA_SIZE);
     if (actor->process == NULL) {
         ol_mutex_destroy(&actor->ask_mutex);
-        ol_hashmap_destroy(actor->pending_asks);
         actor_mailbox_destroy(actor->mailbox);
-        ol_arena_destroy(actor->private_arena);
         free(actor);
         return NULL;
     }
@@ -612,17 +1270,25 @@ int ol_actor_start(ol_actor_t* actor) {
     }
     
     /* Check if already running */
-    if (actor->state & ACTOR_STATE_RUNNING) {
+    if (actor_state(actor) & ACTOR_STATE_RUNNING) {
         return 0;
     }
     
     /* Start the process if not already alive */
-    if (!ol_process_is_alive(actor->process)) {
+    if (actor->process && !ol_process_is_alive(actor->process)) {
         /* Note: In new architecture, processes auto-start on creation */
         /* This check is for future compatibility */
     }
     
-    actor->state = ACTOR_STATE_RUNNING;
+    actor_set_state(actor, ACTOR_STATE_RUNNING);
+    
+    /* Messages sent before start were not scheduled (see actor_notify()) */
+    if (actor->pool) {
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (ol_actor_mailbox_length(actor) > 0) {
+            actor_schedule(actor);
+        }
+    }
     return 0;
 }
 
@@ -645,11 +1311,23 @@ int ol_actor_stop(ol_actor_t* actor) {
     }
     
     /* Set stopping flag to request graceful shutdown */
-    actor->state |= ACTOR_STATE_STOPPING;
+    actor_add_state(actor, ACTOR_STATE_STOPPING);
+    
+    /* A pooled actor drains and closes on its next run */
+    if (actor->pool) {
+        if (actor_state(actor) & ACTOR_STATE_RUNNING) {
+            actor_schedule(actor);
+        } else {
+            actor_set_state(actor, ACTOR_STATE_CLOSED);
+        }
+        return 0;
+    }
     
     /* Wake up mailbox waiters so they can see the stop request */
     if (actor->mailbox) {
+        ol_mutex_lock(&actor->mailbox->mutex);
         ol_cond_signal(&actor->mailbox->not_empty);
+        ol_mutex_unlock(&actor->mailbox->mutex);
     }
     
     return 0;
@@ -673,7 +1351,7 @@ int ol_actor_close(ol_actor_t* actor) {
     }
     
     /* Mark as closed */
-    actor->state |= ACTOR_STATE_CLOSED;
+    actor_add_state(actor, ACTOR_STATE_CLOSED);
     
     /* Destroy the isolated process */
     if (actor->process) {
@@ -697,38 +1375,67 @@ int ol_actor_close(ol_actor_t* actor) {
  * 
  * @note If actor is NULL, this function does nothing (safe to call).
  *       The function handles partial initialization states gracefully.
+ *       A pooled actor must not destroy itself from its own behavior.
+ *       Called on a worker of the actor's pool, it runs queued pool tasks
+ *       while waiting for the actor's pending run. Runs queued before
+ *       ol_parallel_shutdown(pool, false) still execute (one budget at
+ *       most), so the wait always ends while the pool has workers; after
+ *       the pool is shut down the actor is idle and destroy returns at once.
+ *       Sends must not overlap the call: nothing waits for a sender still
+ *       inside actor_mailbox_push() before the mailbox is freed.
  */
 void ol_actor_destroy(ol_actor_t* actor) {
     if (actor == NULL) {
         return;
     }
     
-    /* Stop actor if running */
-    if (actor->state & ACTOR_STATE_RUNNING) {
-        ol_actor_close(actor);
-    }
-    
-    /* Wait for graceful shutdown with timeout */
-    ol_deadline_t deadline = ol_deadline_from_ms(ACTOR_TIMEOUT_MS);
-    while (actor->state != ACTOR_STATE_CLOSED) {
-        if (ol_deadline_expired(deadline)) {
-            break;
+    if (actor->pool) {
+        /* Close, then wait for the in-flight run (bounded by its budget)
+         * and claim sched so no sender can queue the actor again */
+        actor_add_state(actor, ACTOR_STATE_CLOSED);
+        uint64_t idle = 0;
+        while (!__atomic_compare_exchange_n(&actor->sched, &idle, ACTOR_SCHED_DEAD,
+                                            false, __ATOMIC_ACQ_REL,
+                                            __ATOMIC_ACQUIRE)) {
+            idle = 0;
+            /* On one of the pool's workers the queued run may sit in our
+             * own queue: run it (or whatever is next) instead of waiting */
+            if (ol_parallel_help(actor->pool)) {
+                continue;
+            }
+#if defined(_WIN32)
+            Sleep(0);
+#else
+            sched_yield(); /* A run lasts at most one budget */
+#endif
         }
+    } else {
+        /* Stop actor if running */
+        if (actor_state(actor) & ACTOR_STATE_RUNNING) {
+            ol_actor_close(actor);
+        }
+        
+        /* Wait for graceful shutdown with timeout */
+        ol_deadline_t deadline = ol_deadline_from_ms(ACTOR_TIMEOUT_MS);
+        while (actor_state(actor) != ACTOR_STATE_CLOSED) {
+            if (ol_deadline_expired(deadline)) {
+                break;
+            }
 #if defined(_WIN32)
-        Sleep(10);
+            Sleep(10);
 #else
-        usleep(10000);
+            usleep(10000);
 #endif
+        }
     }
     
     /* Clean up resources in reverse creation order */
-    ol_mutex_destroy(&actor->ask_mutex);
-    
-    if (actor->pending_asks) {
-        ol_hashmap_destroy(actor->pending_asks);
-    }
-    
     if (actor->mailbox) {
+        /* Release undelivered messages (cancels pending asks) */
+        actor_msg_t item;
+        while (actor_mailbox_pop(actor->mailbox, &item)) {
+            actor_drop_message(actor, &item);
+        }
         actor_mailbox_destroy(actor->mailbox);
     }
     
@@ -736,73 +1443,83 @@ void ol_actor_destroy(ol_actor_t* actor) {
         ol_arena_destroy(actor->private_arena);
     }
     
-    free(actor);
+    /* Freed here unless a caller still holds an ask record */
+    actor_ask_unref(actor);
+}
+
+/**
+ * @brief Queue a message of the given kind and wake the actor
+ * 
+ * @return int 1 if queued, 0 if the mailbox is full, -1 on error; the
+ *         caller keeps the message unless 1 is returned
+ */
+static int actor_enqueue(ol_actor_t* actor, void* msg,
+                         actor_msg_kind_t kind, bool priority) {
+    if (actor_state(actor) & (ACTOR_STATE_CLOSED | ACTOR_STATE_CRASHED)) {
+        return -1;
+    }
+    
+    int result = actor_mailbox_push(actor->mailbox, msg, kind, priority);
+    if (result == 1) {
+        actor_notify(actor);
+    }
+    return result;
 }
 
 /**
- * @brief Send message to actor (blocking)
+ * @brief Send message to actor (never blocks)
  * 
  * @param actor Actor instance to receive message
  * @param msg Message to send (ownership transferred)
  * @return int 0 on success, -1 on error
  * 
- * @details Attempts to send a message to the actor's mailbox.
- * If the mailbox is full (bounded case), this function blocks
- * until space is available.
+ * @details Queues msg in the actor's mailbox. If the mailbox is full
+ * (bounded case) or the actor is closed, the message is rejected: msg is
+ * destroyed with msg_dtor and -1 is returned.
  * 
- * @note For non-blocking send, use ol_actor_try_send().
- *       For timeout-based send, use ol_actor_send_timeout().
+ * @note To wait for space, use ol_actor_send_timeout().
+ *       To keep the message on a full mailbox, use ol_actor_try_send().
  */
 int ol_actor_send(ol_actor_t* actor, void* msg) {
     if (actor == NULL) {
         return -1;
     }
     
-    /* Check if actor can receive messages */
-    if (actor->state & (ACTOR_STATE_CLOSED | ACTOR_STATE_CRASHED)) {
+    /* Lock-free enqueue; a closed actor or full mailbox rejects the message */
+    if (actor_enqueue(actor, msg, ACTOR_MSG_USER, false) != 1) {
         if (actor->msg_dtor) {
             actor->msg_dtor(msg);
         }
         return -1;
     }
     
-    /* Try fast path first (lock-free ring buffer) */
-    if (actor_mailbox_try_send_fast(actor->mailbox, msg)) {
-        return 0;
+    return 0;
+}
+
+/**
+ * @brief Send a control message ahead of queued user messages
+ * 
+ * @param actor Actor instance to receive message
+ * @param msg Message to send (ownership transferred)
+ * @return int 0 on success, -1 on error
+ * 
+ * @details Queues msg on the mailbox's priority lane. The actor drains that
+ * lane before any data message, so the message is handled after at most
+ * the batch already in progress, however deep the data backlog. The
+ * priority lane is not bounded by the mailbox capacity.
+ */
+int ol_actor_send_priority(ol_actor_t* actor, void* msg) {
+    if (actor == NULL) {
+        return -1;
     }
     
-    /* Fall back to overflow list (requires mutex) */
-    ol_mutex_lock(&actor->mailbox->mutex);
-    
-    /* Check capacity of overflow list */
-    if (actor->mailbox->overflow_count >= actor->mailbox->capacity) {
-        ol_mutex_unlock(&actor->mailbox->mutex);
+    if (actor_enqueue(actor, msg, ACTOR_MSG_USER, true) != 1) {
         if (actor->msg_dtor) {
             actor->msg_dtor(msg);
         }
         return -1;
     }
     
-    /* Add to overflow list */
-    actor->mailbox->overflow_list[actor->mailbox->overflow_count++] = msg;
-    actor->mailbox->overflow_events++;
-    actor->mailbox->total_messages++;
-    
-    /* Update peak size calculation */
-    size_t total_size = (actor->mailbox->tail > actor->mailbox->head ?
-                        actor->mailbox->tail - actor->mailbox->head :
-                        actor->mailbox->capacity - actor->mailbox->head + 
-                        actor->mailbox->tail) + actor->mailbox->overflow_count;
-    
-    if (total_size > actor->mailbox->peak_size) {
-        actor->mailbox->peak_size = total_size;
-    }
-    
-    /* Signal waiting receivers that a message is available */
-    ol_cond_signal(&actor->mailbox->not_empty);
-    
-    ol_mutex_unlock(&actor->mailbox->mutex);
-    
     return 0;
 }
 
@@ -872,25 +1589,13 @@ int ol_actor_try_send(ol_actor_t* actor, void* msg) {
         return -1;
     }
     
-    /* Check actor state */
-    if (actor->state & (ACTOR_STATE_CLOSED | ACTOR_STATE_CRASHED)) {
-        if (actor->msg_dtor) {
-            actor->msg_dtor(msg);
-        }
-        return -1;
-    }
-    
-    /* Try fast path (lock-free ring buffer) */
-    if (actor_mailbox_try_send_fast(actor->mailbox, msg)) {
-        return 1;
+    /* Lock-free enqueue; on a full mailbox the caller keeps the message */
+    int result = actor_enqueue(actor, msg, ACTOR_MSG_USER, false);
+    if (result < 0 && actor->msg_dtor) {
+        actor->msg_dtor(msg);
     }
     
-    /* Check overflow capacity without blocking */
-    ol_mutex_lock(&actor->mailbox->mutex);
-    bool has_space = (actor->mailbox->overflow_count < actor->mailbox->capacity);
-    ol_mutex_unlock(&actor->mailbox->mutex);
-    
-    return has_space ? 0 : -1; /* 0 = would block, -1 = error */
+    return result; /* 1 = sent, 0 = would block, -1 = error */
 }
 
 /**
@@ -902,8 +1607,8 @@ int ol_actor_try_send(ol_actor_t* actor, void* msg) {
  * 
  * @details Implements the ask pattern:
  * 1. Creates a promise/future pair
- * 2. Wraps message in ask envelope with promise
- * 3. Sends envelope to actor
+ * 2. Wraps message in a pooled ask record with the promise
+ * 3. Sends the record to the actor, tagged as an ask
  * 4. Returns future that will be resolved with reply
  * 
  * @note The actor must explicitly reply using ol_actor_reply_ok()
@@ -929,42 +1634,94 @@ ol_future_t* ol_actor_ask(ol_actor_t* actor, void* msg) {
         return NULL;
     }
     
-    /* Create ask envelope */
-    ol_ask_envelope_t* envelope = (ol_ask_envelope_t*)calloc(1, sizeof(ol_ask_envelope_t));
-    if (envelope == NULL) {
+    actor_ask_t* ask = actor_ask_acquire(actor);
+    if (ask == NULL) {
         ol_future_destroy(future);
         ol_promise_destroy(promise);
         return NULL;
     }
     
-    envelope->payload = msg;
-    envelope->reply = promise;
-    envelope->sender = ol_actor_self();
-    envelope->ask_id = ol_monotonic_now_ns();
-    
-    /* Store in pending asks for timeout handling (future enhancement) */
-    ol_mutex_lock(&actor->ask_mutex);
-    ol_hashmap_put(actor->pending_asks, &envelope->ask_id, 
-                  sizeof(uint64_t), envelope);
-    ol_mutex_unlock(&actor->ask_mutex);
+    ask->env.payload = msg;
+    ask->env.reply = promise;
     
-    /* Send envelope to actor */
-    int send_result = ol_actor_send(actor, envelope);
-    if (send_result != 0) {
+    if (actor_enqueue(actor, ask, ACTOR_MSG_ASK, false) != 1) {
         /* Failed to send - clean up */
-        ol_mutex_lock(&actor->ask_mutex);
-        ol_hashmap_remove(actor->pending_asks, &envelope->ask_id, 
-                         sizeof(uint64_t));
-        ol_mutex_unlock(&actor->ask_mutex);
-        
-        ol_actor_reply_cancel(envelope);
+        ask->env.reply = NULL;
+        actor_ask_release(ask);
+        ol_promise_destroy(promise);
         ol_future_destroy(future);
+        if (msg && actor->msg_dtor) {
+            actor->msg_dtor(msg);
+        }
         return NULL;
     }
     
     return future;
 }
 
+/**
+ * @brief Send a request and wait for the reply (synchronous ask)
+ * 
+ * @param actor Actor instance to send request to
+ * @param msg Request message (ownership transferred)
+ * @param out_reply Receives the value passed to ol_actor_reply_ok() (may be NULL)
+ * @param out_error Receives the code passed to ol_actor_reply_error() (may be NULL)
+ * @param timeout_ms Timeout in milliseconds (0 = infinite)
+ * @return int 0 on reply, -1 if not sent or not answered, -2 on error reply,
+ *         -3 on timeout
+ * 
+ * @details The request travels in a pooled ask record with no promise; the
+ * behavior's reply is written into the record and the caller, polling
+ * then parked on it, takes it from there. No promise, future or other
+ * allocation is involved once the target's record pool is warm.
+ */
+int ol_actor_call(ol_actor_t* actor, void* msg, void** out_reply,
+                  int* out_error, uint32_t timeout_ms) {
+    if (out_reply) *out_reply = NULL;
+    if (out_error) *out_error = 0;
+    
+    if (actor == NULL) {
+        return -1;
+    }
+    
+    actor_ask_t* ask = actor_ask_acquire(actor);
+    if (ask == NULL) {
+        if (msg && actor->msg_dtor) {
+            actor->msg_dtor(msg);
+        }
+        return -1;
+    }
+    
+    ask->env.payload = msg;
+    
+    if (actor_enqueue(actor, ask, ACTOR_MSG_ASK, false) != 1) {
+        actor_ask_release(ask);
+        if (msg && actor->msg_dtor) {
+            actor->msg_dtor(msg);
+        }
+        return -1;
+    }
+    
+    if (!actor_ask_wait(ask, timeout_ms)) {
+        return -3; /* The replier releases the abandoned record */
+    }
+    
+    int result = 0;
+    if (ask->cancelled) {
+        result = -1;
+    } else if (ask->error != 0) {
+        if (out_error) *out_error = ask->error;
+        result = -2;
+    } else if (out_reply) {
+        *out_reply = ask->value;
+    } else if (ask->value && ask->dtor) {
+        ask->dtor(ask->value);
+    }
+    
+    actor_ask_release(ask);
+    return result;
+}
+
 /**
  * @brief Change actor behavior function
  * 
@@ -1023,42 +1780,37 @@ void ol_actor_set_context(ol_actor_t* actor, void* context) {
  * @param value Reply value (ownership transferred to promise)
  * @param dtor Value destructor function (can be NULL)
  * 
- * @details Fulfills the promise in the ask envelope with the
- * provided value, then frees the envelope.
+ * @details Fulfills the promise in the ask envelope, or hands the value
+ * straight to the waiting ol_actor_call(), then recycles the envelope.
  * 
  * @note This function must be called from within the actor's
  * behavior function that received the ask envelope.
  */
 void ol_actor_reply_ok(ol_ask_envelope_t* envelope, void* value, 
                       ol_actor_value_destructor dtor) {
-    if (envelope == NULL || envelope->reply == NULL) {
+    if (envelope == NULL) {
         return;
     }
     
-    ol_promise_fulfill(envelope->reply, value, dtor);
-    
-    /* Clean up envelope (payload was already consumed by actor) */
-    free(envelope);
+    actor_ask_complete((actor_ask_t*)envelope, value, dtor, 0, false);
 }
 
 /**
  * @brief Reply to ask envelope with error
  * 
  * @param envelope Ask envelope to reply to
- * @param error_code Error code to report
+ * @param error_code Error code to report (non-zero)
  * 
- * @details Rejects the promise in the ask envelope with the
- * provided error code, then frees the envelope.
+ * @details Rejects the promise in the ask envelope, or fails the waiting
+ * ol_actor_call(), then recycles the envelope.
  */
 void ol_actor_reply_error(ol_ask_envelope_t* envelope, int error_code) {
-    if (envelope == NULL || envelope->reply == NULL) {
+    if (envelope == NULL) {
         return;
     }
     
-    ol_promise_reject(envelope->reply, error_code);
-    
-    /* Clean up envelope */
-    free(envelope);
+    actor_ask_complete((actor_ask_t*)envelope, NULL, NULL,
+                       error_code != 0 ? error_code : -1, false);
 }
 
 /**
@@ -1066,17 +1818,30 @@ void ol_actor_reply_error(ol_ask_envelope_t* envelope, int error_code) {
  * 
  * @param envelope Ask envelope to cancel
  * 
- * @details Cancels the promise in the ask envelope, indicating
- * that no reply will be sent. Useful for cleanup.
+ * @details Cancels the promise in the ask envelope, or fails the waiting
+ * ol_actor_call(), indicating that no reply will be sent.
  */
 void ol_actor_reply_cancel(ol_ask_envelope_t* envelope) {
-    if (envelope == NULL || envelope->reply == NULL) {
+    if (envelope == NULL) {
         return;
     }
     
-    ol_promise_cancel(envelope->reply);
-    ol_promise_destroy(envelope->reply);
-    free(envelope);
+    actor_ask_complete((actor_ask_t*)envelope, NULL, NULL, 0, true);
+}
+
+/**
+ * @brief Ask envelope of the message being handled
+ * 
+ * @param actor Actor instance (normally the behavior's own)
+ * @return ol_ask_envelope_t* Envelope if the current message is an
+ *         unanswered ask, NULL otherwise
+ */
+ol_ask_envelope_t* ol_actor_current_ask(const ol_actor_t* actor) {
+    if (actor == NULL) {
+        return NULL;
+    }
+    
+    return actor->current_ask;
 }
 
 /**
@@ -1090,7 +1855,7 @@ bool ol_actor_is_running(const ol_actor_t* actor) {
         return false;
     }
     
-    return (actor->state & ACTOR_STATE_RUNNING) != 0;
+    return (actor_state(actor) & ACTOR_STATE_RUNNING) != 0;
 }
 
 /**
@@ -1099,24 +1864,14 @@ bool ol_actor_is_running(const ol_actor_t* actor) {
  * @param actor Actor instance
  * @return size_t Number of pending messages in mailbox
  * 
- * @note Includes messages in both ring buffer and overflow list.
+ * @note Counts messages whose send has completed or is completing.
  */
 size_t ol_actor_mailbox_length(const ol_actor_t* actor) {
     if (actor == NULL || actor->mailbox == NULL) {
         return 0;
     }
     
-    size_t ring_size = (actor->mailbox->tail > actor->mailbox->head ?
-                       actor->mailbox->tail - actor->mailbox->head :
-                       actor->mailbox->capacity - actor->mailbox->head + 
-                       actor->mailbox->tail);
-    
-    size_t overflow_size;
-    ol_mutex_lock((ol_mutex_t*)&actor->mailbox->mutex);
-    overflow_size = actor->mailbox->overflow_count;
-    ol_mutex_unlock((ol_mutex_t*)&actor->mailbox->mutex);
-    
-    return ring_size + overflow_size;
+    return actor_mailbox_length(actor->mailbox);
 }
 
 /**
@@ -1150,7 +1905,7 @@ ol_actor_t* ol_actor_self(void) {
  * @brief Get actor's isolated process
  * 
  * @param actor Actor instance
- * @return ol_process_t* Actor's isolated process, NULL if actor is NULL
+ * @return ol_process_t* Actor's isolated process, NULL if actor is NULL or pooled
  */
 ol_process_t* ol_actor_get_process(const ol_actor_t* actor) {
     return actor ? actor->process : NULL;
@@ -1163,7 +1918,29 @@ ol_process_t* ol_actor_get_process(const ol_actor_t* actor) {
  * @return ol_arena_t* Actor's private memory arena, NULL if actor is NULL
  */
 ol_arena_t* ol_actor_get_arena(const ol_actor_t* actor) {
-    return actor ? actor->private_arena : NULL;
+    if (actor == NULL) {
+        return NULL;
+    }
+    
+    ol_actor_t* self = (ol_actor_t*)actor;
+    ol_arena_t* arena = __atomic_load_n(&self->private_arena, __ATOMIC_ACQUIRE);
+    if (arena != NULL) {
+        return arena;
+    }
+    
+    /* First use: map the arena, racing callers keep the first one */
+    arena = ol_arena_create(ACTOR_DEFAULT_ARENA_SIZE, false);
+    if (arena == NULL) {
+        return NULL;
+    }
+    
+    ol_arena_t* expected = NULL;
+    if (!__atomic_compare_exchange_n(&self->private_arena, &expected, arena, false,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+        ol_arena_destroy(arena);
+        arena = expected;
+    }
+    return arena;
 }
 
 /**
@@ -1231,8 +2008,11 @@ int ol_actor_get_stats(const ol_actor_t* actor, ol_actor_stats_t* stats) {
     stats->avg_latency_ns = actor->avg_latency_ns;
     stats->mailbox_size = ol_actor_mailbox_length(actor);
     stats->mailbox_capacity = actor->mailbox->capacity;
-    stats->mailbox_peak = actor->mailbox->peak_size;
-    stats->overflow_events = actor->mailbox->overflow_events;
+    stats->mailbox_peak = __atomic_load_n(&actor->mailbox->peak_size, __ATOMIC_RELAXED);
+    stats->overflow_events = __atomic_load_n(&actor->mailbox->overflow_events,
+                                             __ATOMIC_RELAXED);
+    stats->priority_messages = __atomic_load_n(&actor->mailbox->priority_sent,
+                                               __ATOMIC_RELAXED);
     
     return OL_SUCCESS;
 }
@@ -1269,24 +2049,242 @@ size_t ol_actor_process_batch(ol_actor_t* actor, size_t max_batch_size) {
     }
     
     /* Enable batch mode flag */
-    uint32_t old_state = actor->state;
-    actor->state |= ACTOR_STATE_BATCH_MODE;
+    uint32_t old_state = actor_add_state(actor, ACTOR_STATE_BATCH_MODE);
     
-    /* Process batch with timing */
-    uint64_t start_time = ol_monotonic_now_ns();
+    /* Same handling as the actor's own loop, asks included */
+    actor_dispatch_batch(actor, actor->batch_buffer, batch_size);
     
-    for (size_t i = 0; i < batch_size; i++) {
-        if (actor->behavior) {
-            actor->behavior(actor, actor->batch_buffer[i]);
+    /* Restore original state (other flags may have changed meanwhile) */
+    if (!(old_state & ACTOR_STATE_BATCH_MODE)) {
+        actor_clear_state(actor, ACTOR_STATE_BATCH_MODE);
+    }
+    
+    return batch_size;
+}
+
+/* ==================== Actor Groups ==================== */
+
+/**
+ * @brief Create an empty actor group
+ * 
+ * @return ol_actor_group_t* New group or NULL on allocation failure
+ */
+ol_actor_group_t* ol_actor_group_create(void) {
+    ol_actor_group_t* group = (ol_actor_group_t*)calloc(1, sizeof(ol_actor_group_t));
+    if (!group) {
+        return NULL;
+    }
+    
+    if (ol_mutex_init(&group->mutex) != OL_SUCCESS) {
+        free(group);
+        return NULL;
+    }
+    
+    return group;
+}
+
+/**
+ * @brief Destroy a group (members are not affected)
+ * 
+ * @param group Group to destroy (may be NULL)
+ */
+void ol_actor_group_destroy(ol_actor_group_t* group) {
+    if (!group) {
+        return;
+    }
+    
+    ol_mutex_destroy(&group->mutex);
+    free(group->members);
+    free(group->wake);
+    free(group);
+}
+
+/**
+ * @brief Add an actor to a group
+ * 
+ * @param group Group to join
+ * @param actor Actor to add
+ * @return int 0 on success (or already a member), -1 on error
+ */
+int ol_actor_group_join(ol_actor_group_t* group, ol_actor_t* actor) {
+    if (!group || !actor) {
+        return -1;
+    }
+    
+    ol_mutex_lock(&group->mutex);
+    
+    for (size_t i = 0; i < group->count; i++) {
+        if (group->members[i] == actor) {
+            ol_mutex_unlock(&group->mutex);
+            return 0;
         }
-        actor->processed_messages++;
     }
     
-    uint64_t end_time = ol_monotonic_now_ns();
-    actor->processing_time_ns += (end_time - start_time);
+    if (group->count == group->capacity) {
+        size_t capacity = group->capacity ? group->capacity * 2 : 8;
+        ol_actor_t** members = (ol_actor_t**)realloc(
+            group->members, capacity * sizeof(ol_actor_t*));
+        if (!members) {
+            ol_mutex_unlock(&group->mutex);
+            return -1;
+        }
+        group->members = members;
+        
+        /* Wake scratch grows with the member list so broadcast never allocates */
+        void** wake = (void**)realloc(group->wake, capacity * sizeof(void*));
+        if (!wake) {
+            ol_mutex_unlock(&group->mutex);
+            return -1;
+        }
+        group->wake = wake;
+        group->capacity = capacity;
+    }
     
-    /* Restore original state */
-    actor->state = old_state;
+    group->members[group->count++] = actor;
     
-    return batch_size;
+    ol_mutex_unlock(&group->mutex);
+    return 0;
+}
+
+/**
+ * @brief Remove an actor from a group
+ * 
+ * @param group Group to leave
+ * @param actor Actor to remove
+ * @return int 0 on success, -1 if the actor is not a member
+ */
+int ol_actor_group_leave(ol_actor_group_t* group, ol_actor_t* actor) {
+    if (!group || !actor) {
+        return -1;
+    }
+    
+    ol_mutex_lock(&group->mutex);
+    
+    for (size_t i = 0; i < group->count; i++) {
+        if (group->members[i] == actor) {
+            /* Order is irrelevant: move the last member into the hole */
+            group->members[i] = group->members[--group->count];
+            ol_mutex_unlock(&group->mutex);
+            return 0;
+        }
+    }
+    
+    ol_mutex_unlock(&group->mutex);
+    return -1;
+}
+
+/**
+ * @brief Get the number of actors in a group
+ * 
+ * @param group Group instance
+ * @return size_t Member count (0 if group is NULL)
+ */
+size_t ol_actor_group_size(ol_actor_group_t* group) {
+    if (!group) {
+        return 0;
+    }
+    
+    ol_mutex_lock(&group->mutex);
+    size_t count = group->count;
+    ol_mutex_unlock(&group->mutex);
+    
+    return count;
+}
+
+/**
+ * @brief Submit the collected pooled wake-ups, one batch per pool
+ * 
+ * @param wake Actors claimed with actor_wake_claim() (reordered in place)
+ * @param count Number of actors in wake
+ * 
+ * @details Each distinct pool gets one ol_parallel_submit_batch_kept(): from
+ * one of its workers the runs land in that worker's local queue (others
+ * steal them), from any other thread they cost one injection-queue lock.
+ */
+static void actor_group_wake(void** wake, size_t count) {
+    size_t start = 0;
+    while (start < count) {
+        /* Partition the remaining actors: same pool as wake[start] first */
+        ol_parallel_pool_t* pool = ((ol_actor_t*)wake[start])->pool;
+        size_t end = start + 1;
+        for (size_t i = end; i < count; i++) {
+            if (((ol_actor_t*)wake[i])->pool == pool) {
+                void* tmp = wake[end];
+                wake[end++] = wake[i];
+                wake[i] = tmp;
+            }
+        }
+        
+        int queued = ol_parallel_submit_batch_kept(pool, actor_run_slice,
+                                                   wake + start, end - start);
+        
+        /* Pool shutting down: nothing will run the rest again */
+        for (size_t i = start + (queued > 0 ? (size_t)queued : 0); i < end; i++) {
+            __atomic_store_n(&((ol_actor_t*)wake[i])->sched, 0, __ATOMIC_RELEASE);
+        }
+        
+        start = end;
+    }
+}
+
+/**
+ * @brief Send one message to every member of a group
+ * 
+ * @param group Group to broadcast to
+ * @param msg Message shared by all members (ownership transferred)
+ * @param dtor Destructor for msg (may be NULL)
+ * @return int Number of members the message was queued to, or -1 on error
+ * 
+ * @details The message is wrapped once in a refcounted actor_shared_msg_t
+ * and the same wrapper is linked into every mailbox. The broadcaster holds
+ * one extra reference while it fans out, so a fast member cannot free the
+ * message before the last push.
+ */
+int ol_actor_group_broadcast(ol_actor_group_t* group, void* msg,
+                             ol_actor_msg_destructor dtor) {
+    if (!group) {
+        if (msg && dtor) {
+            dtor(msg);
+        }
+        return -1;
+    }
+    
+    actor_shared_msg_t* shared = (actor_shared_msg_t*)malloc(sizeof(actor_shared_msg_t));
+    if (!shared) {
+        if (msg && dtor) {
+            dtor(msg);
+        }
+        return -1;
+    }
+    shared->payload = msg;
+    shared->dtor = dtor;
+    
+    ol_mutex_lock(&group->mutex);
+    
+    __atomic_store_n(&shared->refs, group->count + 1, __ATOMIC_RELAXED);
+    
+    size_t delivered = 0;
+    size_t nwake = 0;
+    for (size_t i = 0; i < group->count; i++) {
+        ol_actor_t* actor = group->members[i];
+        
+        if ((actor_state(actor) & (ACTOR_STATE_CLOSED | ACTOR_STATE_CRASHED)) ||
+            actor_mailbox_push(actor->mailbox, shared, ACTOR_MSG_SHARED, false) != 1) {
+            __atomic_fetch_sub(&shared->refs, 1, __ATOMIC_RELAXED);
+            continue;
+        }
+        delivered++;
+        
+        /* Process-backed members were woken by the push itself */
+        if (actor->pool && actor_wake_claim(actor)) {
+            group->wake[nwake++] = actor;
+        }
+    }
+    
+    actor_group_wake(group->wake, nwake);
+    
+    ol_mutex_unlock(&group->mutex);
+    
+    actor_shared_release(shared);
+    return (int)delivered;
 }
@@ -0,0 +1,231 @@
+/**
+ * @file ol_actor_hashmap.c
+ * @brief Simple hash map for internal use in the actor system
+ * @version 1.3.0
+ *
+ * Separate chaining over a power-of-two bucket array. Keys are copied
+ * into their entry (byte-wise compared), values are stored as given.
+ * Not thread-safe: callers hold their own lock.
+ */
+
+#include "ol_actor_hashmap.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* --------------------------------------------------------------------------
+ * Internal structures
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @brief One key-value pair; the key bytes follow the struct
+ */
+typedef struct ol_hashmap_entry {
+    struct ol_hashmap_entry *next;  /**< Next entry in the same bucket */
+    uint64_t hash;                  /**< Full hash of the key */
+    size_t key_size;                /**< Key length in bytes */
+    void *value;                    /**< Stored value */
+    unsigned char key[];            /**< Copy of the key */
+} ol_hashmap_entry_t;
+
+struct ol_hashmap {
+    ol_hashmap_entry_t **buckets;   /**< Bucket heads */
+    size_t capacity;                /**< Number of buckets (power of two) */
+    size_t size;                    /**< Number of entries */
+    void (*value_destructor)(void*); /**< Called on removed values (may be NULL) */
+};
+
+/* --------------------------------------------------------------------------
+ * Helpers
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @brief FNV-1a hash of a byte string
+ */
+static uint64_t ol_hashmap_hash(const void *key, size_t key_size) {
+    const unsigned char *p = (const unsigned char*)key;
+    uint64_t h = 14695981039346656037ull;
+    
+    for (size_t i = 0; i < key_size; i++) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    
+    return h;
+}
+
+/**
+ * @brief Find the link that points at key's entry (or the bucket's tail link)
+ */
+static ol_hashmap_entry_t** ol_hashmap_find(const ol_hashmap_t *map, const void *key,
+                                            size_t key_size, uint64_t hash) {
+    ol_hashmap_entry_t **link = &map->buckets[hash & (map->capacity - 1)];
+    
+    while (*link) {
+        ol_hashmap_entry_t *e = *link;
+        if (e->hash == hash && e->key_size == key_size &&
+            memcmp(e->key, key, key_size) == 0) {
+            break;
+        }
+        link = &e->next;
+    }
+    
+    return link;
+}
+
+/**
+ * @brief Double the bucket array (keeps the old one if allocation fails)
+ */
+static void ol_hashmap_grow(ol_hashmap_t *map) {
+    size_t capacity = map->capacity * 2;
+    ol_hashmap_entry_t **buckets = (ol_hashmap_entry_t**)calloc(capacity, sizeof(*buckets));
+    if (!buckets) {
+        return;
+    }
+    
+    for (size_t i = 0; i < map->capacity; i++) {
+        ol_hashmap_entry_t *e = map->buckets[i];
+        while (e) {
+            ol_hashmap_entry_t *next = e->next;
+            size_t idx = e->hash & (capacity - 1);
+            e->next = buckets[idx];
+            buckets[idx] = e;
+            e = next;
+        }
+    }
+    
+    free(map->buckets);
+    map->buckets = buckets;
+    map->capacity = capacity;
+}
+
+/* --------------------------------------------------------------------------
+ * Public API implementation
+ * -------------------------------------------------------------------------- */
+
+ol_hashmap_t* ol_hashmap_create(size_t capacity, void (*value_destructor)(void*)) {
+    size_t cap = 8;
+    while (cap < capacity) {
+        cap *= 2;
+    }
+    
+    ol_hashmap_t *map = (ol_hashmap_t*)calloc(1, sizeof(ol_hashmap_t));
+    if (!map) {
+        return NULL;
+    }
+    
+    map->buckets = (ol_hashmap_entry_t**)calloc(cap, sizeof(ol_hashmap_entry_t*));
+    if (!map->buckets) {
+        free(map);
+        return NULL;
+    }
+    
+    map->capacity = cap;
+    map->value_destructor = value_destructor;
+    return map;
+}
+
+void ol_hashmap_destroy(ol_hashmap_t *map) {
+    if (!map) {
+        return;
+    }
+    
+    ol_hashmap_clear(map);
+    free(map->buckets);
+    free(map);
+}
+
+bool ol_hashmap_put(ol_hashmap_t *map, const void *key, size_t key_size, void *value) {
+    if (!map || !key) {
+        return false;
+    }
+    
+    uint64_t hash = ol_hashmap_hash(key, key_size);
+    ol_hashmap_entry_t **link = ol_hashmap_find(map, key, key_size, hash);
+    
+    if (*link) {
+        /* Replace the value of an existing key */
+        void *old = (*link)->value;
+        (*link)->value = value;
+        if (map->value_destructor && old && old != value) {
+            map->value_destructor(old);
+        }
+        return true;
+    }
+    
+    ol_hashmap_entry_t *e = (ol_hashmap_entry_t*)malloc(sizeof(ol_hashmap_entry_t) + key_size);
+    if (!e) {
+        return false;
+    }
+    
+    e->next = NULL;
+    e->hash = hash;
+    e->key_size = key_size;
+    e->value = value;
+    memcpy(e->key, key, key_size);
+    *link = e;
+    
+    /* Keep chains short: grow past a load factor of 3/4 */
+    if (++map->size > map->capacity - map->capacity / 4) {
+        ol_hashmap_grow(map);
+    }
+    
+    return true;
+}
+
+void* ol_hashmap_get(const ol_hashmap_t *map, const void *key, size_t key_size) {
+    if (!map || !key) {
+        return NULL;
+    }
+    
+    ol_hashmap_entry_t *e = *ol_hashmap_find(map, key, key_size,
+                                             ol_hashmap_hash(key, key_size));
+    return e ? e->value : NULL;
+}
+
+bool ol_hashmap_remove(ol_hashmap_t *map, const void *key, size_t key_size) {
+    if (!map || !key) {
+        return false;
+    }
+    
+    ol_hashmap_entry_t **link = ol_hashmap_find(map, key, key_size,
+                                                ol_hashmap_hash(key, key_size));
+    ol_hashmap_entry_t *e = *link;
+    if (!e) {
+        return false;
+    }
+    
+    *link = e->next;
+    map->size--;
+    
+    if (map->value_destructor && e->value) {
+        map->value_destructor(e->value);
+    }
+    free(e);
+    return true;
+}
+
+size_t ol_hashmap_size(const ol_hashmap_t *map) {
+    return map ? map->size : 0;
+}
+
+void ol_hashmap_clear(ol_hashmap_t *map) {
+    if (!map) {
+        return;
+    }
+    
+    for (size_t i = 0; i < map->capacity; i++) {
+        ol_hashmap_entry_t *e = map->buckets[i];
+        while (e) {
+            ol_hashmap_entry_t *next = e->next;
+            if (map->value_destructor && e->value) {
+                map->value_destructor(e->value);
+            }
+            free(e);
+            e = next;
+        }
+        map->buckets[i] = NULL;
+    }
+    
+    map->size = 0;
+}
@@ -90,14 +90,22 @@
 /**
  * @brief Mailbox entry for process messages
  * 
- * @details Messages in the mailbox are stored as serialized messages
- * with sender information and timestamp.
+ * @details Messages in the mailbox are held as plain payload buffers that
+ * are handed to the receiver as is, with sender information and
+ * timestamp. The list is doubly linked so
+ * selective receive can take a message from the middle in O(1); entries
+ * sent with a reference are also on the mailbox's ref list.
  */
 typedef struct mailbox_entry {
-    ol_serialized_msg_t* msg;    /**< Serialized message */
+    void* data;                  /**< Payload, owned by the entry until received */
+    size_t size;                 /**< Payload size */
     ol_pid_t sender;             /**< Sender process ID */
+    uint64_t ref;                /**< Reply reference (0 = untagged) */
     uint64_t timestamp;          /**< Message arrival timestamp */
     struct mailbox_entry* next;  /**< Next entry in linked list */
+    struct mailbox_entry* prev;  /**< Previous entry in linked list */
+    struct mailbox_entry* ref_next; /**< Next entry on the ref list */
+    struct mailbox_entry* ref_prev; /**< Previous entry on the ref list */
 } mailbox_entry_t;
 
 /**
@@ -151,6 +159,9 @@ struct ol_process {
     mailbox_entry_t* mailbox_head;      /**< Mailbox linked list head */
     mailbox_entry_t* mailbox_tail;      /**< Mailbox linked list tail */
     size_t mailbox_size;                /**< Number of messages in mailbox */
+    mailbox_entry_t* ref_head;          /**< Oldest entry sent with a reference */
+    mailbox_entry_t* ref_tail;          /**< Newest entry sent with a reference */
+    mailbox_entry_t* save;              /**< Save-queue cursor of the running recv_match */
     ol_mutex_t mailbox_mutex;           /**< Mailbox synchronization */
     ol_cond_t mailbox_cond;             /**< Condition for message arrival */
     
@@ -655,6 +666,132 @@ static int ol_process_remove_monitor(ol_process_t* process, uint64_t ref) {
     return OL_ERROR;  /* Monitor not found */
 }
 
+/**
+ * @brief Free a mailbox entry and everything it owns
+ */
+static void mailbox_entry_free(mailbox_entry_t* entry) {
+    free(entry->data);
+    free(entry);
+}
+
+/**
+ * @brief Append an entry to the mailbox (mailbox_mutex held)
+ */
+static void mailbox_append(ol_process_t* process, mailbox_entry_t* entry) {
+    entry->next = NULL;
+    entry->prev = process->mailbox_tail;
+    if (process->mailbox_tail) {
+        process->mailbox_tail->next = entry;
+    } else {
+        process->mailbox_head = entry;
+    }
+    process->mailbox_tail = entry;
+    
+    entry->ref_next = NULL;
+    entry->ref_prev = NULL;
+    if (entry->ref != 0) {
+        entry->ref_prev = process->ref_tail;
+        if (process->ref_tail) {
+            process->ref_tail->ref_next = entry;
+        } else {
+            process->ref_head = entry;
+        }
+        process->ref_tail = entry;
+    }
+    
+    process->mailbox_size++;
+}
+
+/**
+ * @brief Remove an entry from anywhere in the mailbox (mailbox_mutex held)
+ * 
+ * @note Everything before a removed save cursor was rejected as well, so
+ *       the cursor steps back to the previous entry instead of resetting.
+ */
+static void mailbox_unlink(ol_process_t* process, mailbox_entry_t* entry) {
+    if (process->save == entry) {
+        process->save = entry->prev;
+    }
+    
+    if (entry->prev) {
+        entry->prev->next = entry->next;
+    } else {
+        process->mailbox_head = entry->next;
+    }
+    if (entry->next) {
+        entry->next->prev = entry->prev;
+    } else {
+        process->mailbox_tail = entry->prev;
+    }
+    
+    if (entry->ref != 0) {
+        if (entry->ref_prev) {
+            entry->ref_prev->ref_next = entry->ref_next;
+        } else {
+            process->ref_head = entry->ref_next;
+        }
+        if (entry->ref_next) {
+            entry->ref_next->ref_prev = entry->ref_prev;
+        } else {
+            process->ref_tail = entry->ref_prev;
+        }
+    }
+    
+    process->mailbox_size--;
+}
+
+/**
+ * @brief Hand an unlinked entry's payload to the receiver and free the entry
+ * 
+ * @return int 1 (message received)
+ */
+static int mailbox_entry_take(mailbox_entry_t* entry, void** out_data,
+                              size_t* out_size, ol_pid_t* out_sender) {
+    *out_data = entry->data;
+    *out_size = entry->size;
+    if (out_sender) {
+        *out_sender = entry->sender;
+    }
+    
+    entry->data = NULL;
+    mailbox_entry_free(entry);
+    return 1;
+}
+
+/**
+ * @brief Wait for a new message to arrive (mailbox_mutex held)
+ * 
+ * @param process Receiving process
+ * @param deadline Absolute deadline (when_ns == 0 = infinite)
+ * @param timeout_ms Caller's timeout (0 = do not wait)
+ * @return int 1 if woken (rescan), 0 on timeout, -1 if the process is dead
+ */
+static int mailbox_wait(ol_process_t* process, ol_deadline_t deadline,
+                        int timeout_ms) {
+    /* Check if process is still alive */
+    ol_mutex_lock(&process->state_mutex);
+    bool is_alive = (process->state == OL_PROCESS_RUNNING ||
+                    process->state == OL_PROCESS_SUSPENDED);
+    ol_mutex_unlock(&process->state_mutex);
+    
+    if (!is_alive) {
+        return -1;
+    }
+    
+    /* Non-blocking mode */
+    if (timeout_ms == 0) {
+        return 0;
+    }
+    
+    int wait_result = ol_cond_wait_until(&process->mailbox_cond,
+                                        &process->mailbox_mutex,
+                                        deadline.when_ns);
+    if (wait_result < 0) {
+        return -1;
+    }
+    return wait_result == 0 ? 0 : 1;
+}
+
 /**
  * @brief Clean up process resources
  * 
@@ -670,15 +807,15 @@ static void ol_process_cleanup(ol_process_t* process) {
     mailbox_entry_t* entry = process->mailbox_head;
     while (entry) {
         mailbox_entry_t* next = entry->next;
-        if (entry->msg) {
-            ol_serialize_free(entry->msg);
-        }
-        free(entry);
+        mailbox_entry_free(entry);
         entry = next;
     }
     process->mailbox_head = NULL;
     process->mailbox_tail = NULL;
     process->mailbox_size = 0;
+    process->ref_head = NULL;
+    process->ref_tail = NULL;
+    process->save = NULL;
     ol_mutex_unlock(&process->mailbox_mutex);
     
     /* Destroy synchronization primitives */
@@ -1009,80 +1146,37 @@ int ol_process_unlink(ol_process_t* process1, ol_process_t* process2) {
 }
 
 /**
- * @brief Send a message to process
+ * @brief Queue a prepared entry on a process mailbox
  * 
  * @param process Target process
- * @param data Message data
- * @param size Message size
- * @param sender_pid Sender PID (0 for anonymous)
- * @return int OL_SUCCESS on success, OL_ERROR on error
- * 
- * @details Serializes message and adds to target's mailbox.
- * Wakes up receiving process if it's waiting.
+ * @param entry Entry carrying the payload (freed on failure)
+ * @return int OL_SUCCESS on success, OL_ERROR if the process cannot receive
  */
-int ol_process_send(ol_process_t* process, const void* data, size_t size,
-                   ol_pid_t sender_pid) {
-    if (!process || !data || size == 0) {
-        return OL_ERROR;
-    }
-    
+static int ol_process_deliver(ol_process_t* process, mailbox_entry_t* entry) {
     /* Check if process can receive messages */
     ol_mutex_lock(&process->state_mutex);
     if (process->state != OL_PROCESS_RUNNING &&
         process->state != OL_PROCESS_SUSPENDED &&
         process->state != OL_PROCESS_READY) {
         ol_mutex_unlock(&process->state_mutex);
+        mailbox_entry_free(entry);
         return OL_ERROR;
     }
     ol_mutex_unlock(&process->state_mutex);
     
-    /* Create mailbox entry */
-    mailbox_entry_t* entry = (mailbox_entry_t*)malloc(sizeof(mailbox_entry_t));
-    if (!entry) {
-        return OL_ERROR;
-    }
-    
-    /* Serialize message for inter-process transfer */
-    entry->msg = ol_serialize(data, size, OL_SERIALIZE_BINARY, 0,
-                             sender_pid, process->pid);
-    if (!entry->msg) {
-        free(entry);
-        return OL_ERROR;
-    }
-    
-    entry->sender = sender_pid;
     entry->timestamp = ol_monotonic_now_ns();
-    entry->next = NULL;
     
     /* Add to mailbox */
     ol_mutex_lock(&process->mailbox_mutex);
     
     /* Handle mailbox overflow (drop oldest message) */
-    if (process->mailbox_size >= MAILBOX_CAPACITY) {
+    if (process->mailbox_size >= MAILBOX_CAPACITY && process->mailbox_head) {
         mailbox_entry_t* oldest = process->mailbox_head;
-        if (oldest) {
-            process->mailbox_head = oldest->next;
-            if (!process->mailbox_head) {
-                process->mailbox_tail = NULL;
-            }
-            
-            if (oldest->msg) {
-                ol_serialize_free(oldest->msg);
-            }
-            free(oldest);
-            process->mailbox_size--;
-        }
+        mailbox_unlink(process, oldest);
+        mailbox_entry_free(oldest);
     }
     
-    /* Add new entry to tail of linked list */
-    if (process->mailbox_tail) {
-        process->mailbox_tail->next = entry;
-        process->mailbox_tail = entry;
-    } else {
-        process->mailbox_head = process->mailbox_tail = entry;
-    }
-    
-    process->mailbox_size++;
+    mailbox_append(process, entry);
     process->message_count++;
     
     /* Update peak size */
@@ -1098,6 +1192,97 @@ int ol_process_send(ol_process_t* process, const void* data, size_t size,
     return OL_SUCCESS;
 }
 
+/**
+ * @brief Send a message to process
+ * 
+ * @param process Target process
+ * @param data Message data
+ * @param size Message size
+ * @param sender_pid Sender PID (0 for anonymous)
+ * @return int OL_SUCCESS on success, OL_ERROR on error
+ * 
+ * @details Copies the message into the target's mailbox.
+ * Wakes up receiving process if it's waiting.
+ */
+int ol_process_send(ol_process_t* process, const void* data, size_t size,
+                   ol_pid_t sender_pid) {
+    return ol_process_send_ref(process, data, size, sender_pid, 0);
+}
+
+/**
+ * @brief Send a message tagged with a reply reference
+ * 
+ * @param process Target process
+ * @param data Message data
+ * @param size Message size
+ * @param sender_pid Sender PID (0 for anonymous)
+ * @param ref Reference from ol_process_make_ref() (0 = untagged)
+ * @return int OL_SUCCESS on success, OL_ERROR on error
+ * 
+ * @details A tagged message is also linked on the mailbox's ref list,
+ * where ol_process_recv_ref() finds it without scanning other traffic.
+ * Processes share an address space, so the payload is copied once into
+ * the buffer the receiver will own; serialization and checksums are left
+ * to transports that cross a process or node boundary.
+ */
+int ol_process_send_ref(ol_process_t* process, const void* data, size_t size,
+                        ol_pid_t sender_pid, uint64_t ref) {
+    if (!process || !data || size == 0) {
+        return OL_ERROR;
+    }
+    
+    /* Create mailbox entry */
+    mailbox_entry_t* entry = (mailbox_entry_t*)calloc(1, sizeof(mailbox_entry_t));
+    if (!entry) {
+        return OL_ERROR;
+    }
+    
+    entry->data = malloc(size);
+    if (!entry->data) {
+        free(entry);
+        return OL_ERROR;
+    }
+    memcpy(entry->data, data, size);
+    
+    entry->size = size;
+    entry->sender = sender_pid;
+    entry->ref = ref;
+    
+    return ol_process_deliver(process, entry);
+}
+
+/**
+ * @brief Send a message by transferring ownership of its buffer (zero-copy)
+ * 
+ * @param process Target process
+ * @param data Heap buffer holding the message (ownership transferred)
+ * @param size Message size
+ * @param sender_pid Sender PID (0 for anonymous)
+ * @return int OL_SUCCESS on success, OL_ERROR on error (buffer freed)
+ * 
+ * @details The receiver gets this very pointer from ol_process_recv() and
+ * friends: nothing is copied, serialized or checksummed.
+ */
+int ol_process_send_owned(ol_process_t* process, void* data, size_t size,
+                          ol_pid_t sender_pid) {
+    if (!process || !data || size == 0) {
+        free(data);
+        return OL_ERROR;
+    }
+    
+    mailbox_entry_t* entry = (mailbox_entry_t*)calloc(1, sizeof(mailbox_entry_t));
+    if (!entry) {
+        free(data);
+        return OL_ERROR;
+    }
+    
+    entry->data = data;
+    entry->size = size;
+    entry->sender = sender_pid;
+    
+    return ol_process_deliver(process, entry);
+}
+
 /**
  * @brief Receive a message with timeout
  * 
@@ -1127,82 +1312,148 @@ int ol_process_recv(ol_process_t* process, void** out_data, size_t* out_size,
     ol_mutex_lock(&process->mailbox_mutex);
     
     /* Wait for messages */
-    while (process->mailbox_size == 0) {
-        /* Check if process is still alive */
-        ol_mutex_lock(&process->state_mutex);
-        bool is_alive = (process->state == OL_PROCESS_RUNNING ||
-                        process->state == OL_PROCESS_SUSPENDED);
-        ol_mutex_unlock(&process->state_mutex);
-        
-        if (!is_alive) {
-            ol_mutex_unlock(&process->mailbox_mutex);
-            return -1;
-        }
-        
-        /* Non-blocking mode */
-        if (timeout_ms == 0) {
-            ol_mutex_unlock(&process->mailbox_mutex);
-            return 0;
-        }
-        
-        /* Wait with timeout */
-        int wait_result = ol_cond_wait_until(&process->mailbox_cond,
-                                            &process->mailbox_mutex,
-                                            deadline.when_ns);
-        if (wait_result == 0) {
-            /* Timeout */
+    while (process->mailbox_head == NULL) {
+        int wait_result = mailbox_wait(process, deadline, timeout_ms);
+        if (wait_result <= 0) {
             ol_mutex_unlock(&process->mailbox_mutex);
-            return 0;
-        } else if (wait_result < 0) {
-            /* Error */
-            ol_mutex_unlock(&process->mailbox_mutex);
-            return -1;
+            return wait_result;
         }
     }
     
-    /* Get first message from mailbox */
+    /* Remove first message from mailbox */
     mailbox_entry_t* entry = process->mailbox_head;
-    if (!entry) {
-        ol_mutex_unlock(&process->mailbox_mutex);
-        return 0;
+    mailbox_unlink(process, entry);
+    
+    ol_mutex_unlock(&process->mailbox_mutex);
+    
+    return mailbox_entry_take(entry, out_data, out_size, out_sender);
+}
+
+/**
+ * @brief Receive the first message accepted by a matcher (selective receive)
+ * 
+ * @param process Process to receive for
+ * @param match Matcher called with each candidate message, oldest first
+ * @param ctx Context passed to the matcher
+ * @param out_data Output data pointer
+ * @param out_size Output size pointer
+ * @param out_sender Output sender PID (can be NULL)
+ * @param timeout_ms Timeout in milliseconds (0 = poll, -1 = infinite)
+ * @return int 1 on success, 0 on timeout, -1 on error
+ * 
+ * @details Messages the matcher rejects stay queued in order. The save
+ * cursor remembers the last rejected entry, so after a wait only messages
+ * that arrived since are examined. It lasts for this call only: the next
+ * call starts again from the head, since the matcher or its ctx may have
+ * changed in between even when the pointers are the same.
+ */
+int ol_process_recv_match(ol_process_t* process, ol_process_match_fn match,
+                          void* ctx, void** out_data, size_t* out_size,
+                          ol_pid_t* out_sender, int timeout_ms) {
+    if (!process || !match || !out_data || !out_size) {
+        return OL_ERROR;
     }
     
-    /* Remove from mailbox */
-    process->mailbox_head = entry->next;
-    if (!process->mailbox_head) {
-        process->mailbox_tail = NULL;
+    ol_deadline_t deadline = {0};
+    if (timeout_ms > 0) {
+        deadline = ol_deadline_from_ms(timeout_ms);
     }
-    process->mailbox_size--;
     
-    ol_mutex_unlock(&process->mailbox_mutex);
+    ol_mutex_lock(&process->mailbox_mutex);
     
-    /* Deserialize message */
-    void* data = NULL;
-    size_t size = 0;
+    process->save = NULL;
     
-    if (ol_deserialize(entry->msg, &data, &size) != OL_SUCCESS) {
-        if (entry->msg) {
-            ol_serialize_free(entry->msg);
+    mailbox_entry_t* found = NULL;
+    for (;;) {
+        mailbox_entry_t* entry = process->save ? process->save->next
+                                               : process->mailbox_head;
+        for (; entry; entry = entry->next) {
+            if (match(entry->data, entry->size, entry->sender, ctx)) {
+                found = entry;
+                break;
+            }
+            process->save = entry;
+        }
+        if (found) {
+            break;
+        }
+        
+        int wait_result = mailbox_wait(process, deadline, timeout_ms);
+        if (wait_result <= 0) {
+            ol_mutex_unlock(&process->mailbox_mutex);
+            return wait_result;
         }
-        free(entry);
-        return -1;
     }
     
-    /* Return results */
-    *out_data = data;
-    *out_size = size;
+    mailbox_unlink(process, found);
     
-    if (out_sender) {
-        *out_sender = entry->sender;
+    ol_mutex_unlock(&process->mailbox_mutex);
+    
+    return mailbox_entry_take(found, out_data, out_size, out_sender);
+}
+
+/**
+ * @brief Create a reference for tagging a reply
+ * 
+ * @return uint64_t New non-zero reference, unique within the runtime
+ */
+uint64_t ol_process_make_ref(void) {
+    return ol_process_generate_monitor_ref();
+}
+
+/**
+ * @brief Receive the message sent with a given reference
+ * 
+ * @param process Process to receive for
+ * @param ref Reference passed to ol_process_send_ref()
+ * @param out_data Output data pointer
+ * @param out_size Output size pointer
+ * @param out_sender Output sender PID (can be NULL)
+ * @param timeout_ms Timeout in milliseconds (0 = poll, -1 = infinite)
+ * @return int 1 on success, 0 on timeout, -1 on error
+ * 
+ * @details Walks only the ref list (tagged messages not yet received),
+ * not the whole mailbox, and compares references only; with one
+ * outstanding call per process the reply is found in O(1) however much
+ * other traffic is queued.
+ */
+int ol_process_recv_ref(ol_process_t* process, uint64_t ref, void** out_data,
+                        size_t* out_size, ol_pid_t* out_sender, int timeout_ms) {
+    if (!process || ref == 0 || !out_data || !out_size) {
+        return OL_ERROR;
     }
     
-    /* Clean up entry */
-    if (entry->msg) {
-        ol_serialize_free(entry->msg);
+    ol_deadline_t deadline = {0};
+    if (timeout_ms > 0) {
+        deadline = ol_deadline_from_ms(timeout_ms);
     }
-    free(entry);
     
-    return 1;
+    ol_mutex_lock(&process->mailbox_mutex);
+    
+    mailbox_entry_t* found = NULL;
+    for (;;) {
+        for (mailbox_entry_t* entry = process->ref_head; entry; entry = entry->ref_next) {
+            if (entry->ref == ref) {
+                found = entry;
+                break;
+            }
+        }
+        if (found) {
+            break;
+        }
+        
+        int wait_result = mailbox_wait(process, deadline, timeout_ms);
+        if (wait_result <= 0) {
+            ol_mutex_unlock(&process->mailbox_mutex);
+            return wait_result;
+        }
+    }
+    
+    mailbox_unlink(process, found);
+    
+    ol_mutex_unlock(&process->mailbox_mutex);
+    
+    return mailbox_entry_take(found, out_data, out_size, out_sender);
 }
 
 /**
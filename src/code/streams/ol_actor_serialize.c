@@ -531,8 +531,9 @@ ol_serialized_msg_t* ol_serialize(const void* data, size_t size,
         }
     }
     
-    /* Calculate checksum for data integrity validation */
-    header.checksum = ol_serialize_crc64(processed_data, processed_size);
+    /* Checksum only when asked: a message that stays in memory needs none */
+    header.checksum = (flags & OL_SERIALIZE_VALIDATE)
+                    ? ol_serialize_crc64(processed_data, processed_size) : 0;
     
     /* Allocate serialized message structure */
     size_t total_size = sizeof(serialize_header_t) + processed_size;
@@ -667,9 +668,8 @@ int ol_deserialize(const ol_serialized_msg_t* msg, void** out_data,
     }
     
     /* Validate checksum if validation flag is set */
-    uint64_t calculated_checksum = ol_serialize_crc64(processed_data, processed_size);
     if (msg->flags & OL_SERIALIZE_VALIDATE && 
-        calculated_checksum != header->checksum) {
+        ol_serialize_crc64(processed_data, processed_size) != header->checksum) {
         if (temp_buffer) {
             free(temp_buffer);
         }
@@ -67,28 +67,24 @@ static void ol_pool_task_wrapper(void *arg) {
  * @brief Loop task context
  */
 typedef struct {
+    ol_event_loop_t *loop;      /**< Loop the task runs on */
     ol_promise_t *promise;      /**< Promise to fulfill */
     ol_async_loop_fn loop_fn;   /**< User loop function */
     void *arg;                  /**< Function argument */
     ol_value_destructor dtor;   /**< Result destructor */
-    uint64_t timer_id;          /**< Timer registration ID */
 } ol_loop_task_ctx_t;
 
 /**
  * @brief Loop task trampoline (executed on event loop thread)
  */
-static void ol_loop_task_trampoline(ol_event_loop_t *loop,
-                                    ol_ev_type_t type,
-                                    int fd,
-                                    void *arg) {
-    (void)type;
-    (void)fd;
-    
+static void ol_loop_task_trampoline(void *arg) {
     ol_loop_task_ctx_t *ctx = (ol_loop_task_ctx_t*)arg;
     if (!ctx) {
         return;
     }
     
+    ol_event_loop_t *loop = ctx->loop;
+    
     /* Execute user callback */
     void *result = NULL;
     if (ctx->loop_fn) {
@@ -106,11 +102,6 @@ static void ol_loop_task_trampoline(ol_event_loop_t *loop,
     }
     /* Otherwise, callback is responsible for resolving promise */
     
-    /* Unregister timer */
-    if (ctx->timer_id != 0) {
-        ol_event_loop_unregister(loop, ctx->timer_id);
-    }
-    
     /* Cleanup */
     ol_promise_destroy(ctx->promise);
     free(ctx);
@@ -194,25 +185,22 @@ ol_future_t* ol_async_run_on_loop(ol_event_loop_t *loop,
         return NULL;
     }
     
+    ctx->loop = loop;
     ctx->promise = promise;
     ctx->loop_fn = cb;
     ctx->arg = arg;
     ctx->dtor = dtor;
-    ctx->timer_id = 0;
-    
-    /* Schedule on event loop with immediate timer */
-    ol_deadline_t deadline = ol_deadline_from_ns(1); /* As soon as possible */
-    uint64_t timer_id = ol_event_loop_register_timer(loop, deadline, 0,
-                                                    ol_loop_task_trampoline,
-                                                    ctx);
-    if (timer_id == 0) {
-        /* Registration failed */
+    
+    /* Hand over to the loop thread through its lock-free post queue */
+    int rc = ol_event_loop_post(loop, ol_loop_task_trampoline, ctx);
+    if (rc == OL_NOMEM) {
+        /* Not queued */
         free(ctx);
         ol_future_destroy(future);
         ol_promise_destroy(promise);
         return NULL;
     }
     
-    ctx->timer_id = timer_id;
+    /* Any other failure is a missed wake; the task is queued and will run */
     return future;
 }
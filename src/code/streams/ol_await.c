@@ -16,39 +16,48 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <stdatomic.h>
 
-#if defined(OL_PLATFORM_WINDOWS)
-    #include <windows.h>
-#else
-    #include <time.h>
-    #include <unistd.h>
-    #include <errno.h>
-#endif
+/* --------------------------------------------------------------------------
+ * Internal structures
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @brief Completion flag shared by the awaiter and its continuation
+ *
+ * Heap-allocated and refcounted: the continuation can fire after the awaiter
+ * has timed out and returned, so neither side may own it alone.
+ */
+typedef struct {
+    atomic_bool done;           /**< Future has settled */
+    atomic_int refs;            /**< Awaiter + pending continuation */
+    ol_event_loop_t *loop;      /**< Loop to wake on settlement */
+} ol_await_waiter_t;
 
 /* --------------------------------------------------------------------------
  * Internal helper functions
  * -------------------------------------------------------------------------- */
 
+static void ol_await_waiter_unref(ol_await_waiter_t *w) {
+    if (atomic_fetch_sub_explicit(&w->refs, 1, memory_order_acq_rel) == 1) {
+        free(w);
+    }
+}
+
 /**
- * @brief Sleep for a short duration (milliseconds)
+ * @brief Continuation: flag completion and wake the awaiting loop
  */
-static void ol_small_sleep_ms(long ms) {
-    if (ms <= 0) {
-        return;
-    }
+static void ol_await_on_settled(ol_event_loop_t *loop,
+                                ol_promise_state_t state,
+                                const void *value,
+                                int error_code,
+                                void *user_data) {
+    (void)loop; (void)state; (void)value; (void)error_code;
     
-#if defined(OL_PLATFORM_WINDOWS)
-    Sleep((DWORD)ms);
-#else
-    struct timespec req, rem;
-    req.tv_sec = ms / 1000;
-    req.tv_nsec = (ms % 1000) * 1000000L;
-    
-    /* Handle interruption by signals */
-    while (nanosleep(&req, &rem) == -1 && errno == EINTR) {
-        req = rem;
-    }
-#endif
+    ol_await_waiter_t *w = (ol_await_waiter_t*)user_data;
+    atomic_store_explicit(&w->done, true, memory_order_release);
+    ol_event_loop_wake(w->loop);
+    ol_await_waiter_unref(w);
 }
 
 /* --------------------------------------------------------------------------
@@ -71,62 +80,51 @@ int ol_await_future_with_loop(ol_event_loop_t *loop,
         return OL_ERROR;
     }
     
-    const long POLL_SLICE_MS = 10; /* 10ms polling slice */
-    int64_t start_ns = ol_monotonic_now_ns();
-    bool has_deadline = (deadline_ns > 0);
+    if (deadline_ns > 0 && ol_monotonic_now_ns() >= deadline_ns) {
+        return OL_TIMEOUT;
+    }
     
-    /* Calculate relative deadline from absolute if provided */
-    int64_t relative_deadline_ns = 0;
-    if (has_deadline) {
-        relative_deadline_ns = deadline_ns - start_ns;
-        if (relative_deadline_ns <= 0) {
-            return OL_TIMEOUT;
-        }
+    /* Without a loop there is nothing to keep responsive: block directly */
+    if (!loop) {
+        return ol_future_await(f, deadline_ns);
     }
     
-    while (1) {
-        /* Calculate next slice deadline */
-        int64_t slice_deadline_ns = 0;
-        if (has_deadline) {
-            int64_t elapsed = ol_monotonic_now_ns() - start_ns;
-            int64_t remaining = relative_deadline_ns - elapsed;
-            
-            if (remaining <= 0) {
-                return OL_TIMEOUT;
-            }
-            
-            /* Use smaller of remaining time or slice size */
-            int64_t slice_ns = POLL_SLICE_MS * 1000000LL;
-            slice_deadline_ns = (remaining < slice_ns) ? remaining : slice_ns;
-        } else {
-            slice_deadline_ns = POLL_SLICE_MS * 1000000LL;
-        }
-        
-        /* Try to await with short timeout */
-        int r = ol_future_await(f, ol_monotonic_now_ns() + slice_deadline_ns);
-        
-        if (r != 0) {
-            /* Completed, timed out, or error */
-            return r;
-        }
-        
-        /* Not ready yet: yield to event loop */
-        if (loop) {
-            ol_event_loop_wake(loop);
+    ol_await_waiter_t *w = (ol_await_waiter_t*)malloc(sizeof(ol_await_waiter_t));
+    if (!w) {
+        return OL_ERROR;
+    }
+    
+    atomic_init(&w->done, false);
+    atomic_init(&w->refs, 2);
+    w->loop = loop;
+    
+    /* Settlement wakes the loop, so each iteration blocks in the poller */
+    if (ol_future_then(f, ol_await_on_settled, w) != OL_SUCCESS) {
+        free(w);
+        return OL_ERROR;
+    }
+    
+    int rc = 1;
+    /* The state check covers a continuation queued on a different loop */
+    while (!atomic_load_explicit(&w->done, memory_order_acquire) &&
+           ol_future_state(f) == OL_PROMISE_PENDING) {
+        if (deadline_ns > 0 && ol_monotonic_now_ns() >= deadline_ns) {
+            rc = OL_TIMEOUT;
+            break;
         }
         
-        /* Sleep briefly to allow other tasks to run */
-        ol_small_sleep_ms(POLL_SLICE_MS);
-        
-        /* Check if overall deadline expired */
-        if (has_deadline) {
-            int64_t now = ol_monotonic_now_ns();
-            if (now >= deadline_ns) {
-                return OL_TIMEOUT;
-            }
+        if (ol_event_loop_run_once(loop, deadline_ns) != OL_SUCCESS) {
+            rc = OL_ERROR;
+            break;
         }
     }
     
-    /* Unreachable */
-    return OL_ERROR;
+    /* Still registered after a timeout: the promise may be destroyed
+     * without ever settling, so take the continuation's reference back */
+    if (rc != 1 && ol_future_remove_then(f, ol_await_on_settled, w) == OL_SUCCESS) {
+        ol_await_waiter_unref(w);
+    }
+    
+    ol_await_waiter_unref(w);
+    return rc;
 }
@@ -2,10 +2,20 @@
  * @file ol_channel.c
  * @brief Thread-safe channel implementation for OLSRT
  * @version 1.2.0
- * 
+ *
  * This module implements a FIFO channel with optional bounded capacity
  * and item destructor support. Channels are thread-safe and support
  * blocking/non-blocking operations with deadlines.
+ *
+ * Bounded channels use a lock-free MPMC array ring (Vyukov): each cell
+ * carries a sequence number that tells producers and consumers whether it
+ * is free or filled for the current lap, so send/recv are one CAS plus one
+ * store with no allocation. The mutex and condition variables are only used
+ * as an eventcount for threads that must block on an empty or full ring;
+ * the fast path checks a waiter counter and skips them entirely, and a
+ * blocked operation yields a few times before it registers as a waiter.
+ *
+ * Unbounded channels keep the mutex-protected linked list.
  */
 
 #include "ol_channel.h"
@@ -14,24 +24,82 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+#include <stdatomic.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <sched.h>
+#endif
 
 /* --------------------------------------------------------------------------
  * Internal structures
  * -------------------------------------------------------------------------- */
 
+/** @brief Assumed cache line size for padding hot ring counters */
+#define OL_CHAN_CACHE_LINE 64
+
+/**
+ * @brief Yields a blocked ring operation makes before parking
+ *
+ * A parked thread stays registered until it is scheduled again, and while
+ * it is registered every operation on the other end takes the mutex to
+ * signal it. Yielding first lets the other end make room without ever
+ * seeing a waiter.
+ */
+#define OL_RING_YIELDS 4
+
 /**
- * @brief Channel node (linked list)
+ * @brief Channel node (linked list, unbounded channels)
  */
 typedef struct ol_chan_node {
     void *item;                 /**< Item payload */
     struct ol_chan_node *next;  /**< Next node in queue */
 } ol_chan_node_t;
 
+/**
+ * @brief Ring cell (bounded channels)
+ *
+ * seq == 2 * pos: free for the producer claiming pos.
+ * seq == 2 * pos + 1: filled, ready for the consumer claiming pos.
+ *
+ * Doubling keeps the two states distinct even for a single-cell ring, where
+ * the classic pos / pos + 1 encoding cannot tell "filled at pos" from
+ * "free at pos + 1".
+ */
+typedef struct {
+    atomic_size_t seq;          /**< Cell sequence number */
+    void *item;                 /**< Item payload */
+} ol_chan_cell_t;
+
+/**
+ * @brief Registered interest in a channel becoming ready (select, readiness)
+ *
+ * Linked into the channel's recv or send watcher list under the channel
+ * mutex; notify runs with that mutex held and must not block.
+ */
+typedef struct ol_chan_waiter {
+    struct ol_chan_waiter *prev;    /**< Previous watcher */
+    struct ol_chan_waiter *next;    /**< Next watcher */
+    void (*notify)(void *ctx);      /**< Wake callback */
+    void *ctx;                      /**< Callback context */
+} ol_chan_waiter_t;
+
 /**
  * @brief Channel internal state
  */
 struct ol_channel {
-    /* Queue state */
+    /* Bounded ring; producer and consumer cursors on separate cache lines */
+    atomic_size_t enqueue_pos;  /**< Next position to fill */
+    char pad0[OL_CHAN_CACHE_LINE - sizeof(atomic_size_t)];
+    atomic_size_t dequeue_pos;  /**< Next position to drain */
+    char pad1[OL_CHAN_CACHE_LINE - sizeof(atomic_size_t)];
+    ol_chan_cell_t *cells;      /**< Ring storage (NULL for unbounded) */
+    size_t ring_mask;           /**< capacity - 1 if capacity is a power of two */
+    bool ring_pow2;             /**< Whether ring_mask can replace modulo */
+    
+    /* Unbounded queue state */
     ol_chan_node_t *head;       /**< First node in queue */
     ol_chan_node_t *tail;       /**< Last node in queue */
     size_t size;                /**< Current queue size */
@@ -40,13 +108,20 @@ struct ol_channel {
     /* Item management */
     ol_chan_item_destructor dtor; /**< Item destructor (optional) */
     
-    /* Synchronization */
-    ol_mutex_t mutex;           /**< Protects queue state */
+    /* Synchronization (whole queue for unbounded, blocking only for bounded) */
+    ol_mutex_t mutex;           /**< Protects queue state / waiter handoff */
     ol_cond_t not_empty;        /**< Signaled when queue becomes non-empty */
     ol_cond_t not_full;         /**< Signaled when queue has space (bounded) */
+    atomic_size_t recv_waiters; /**< Receivers blocked on an empty ring */
+    atomic_size_t send_waiters; /**< Senders blocked on a full ring */
+    ol_chan_waiter_t *recv_watchers; /**< Woken when items arrive */
+    ol_chan_waiter_t *send_watchers; /**< Woken when space frees up */
+    ol_chan_ready_fn ready_fn;  /**< Readiness hook (under mutex) */
+    void *ready_ctx;            /**< Readiness hook context */
+    atomic_uint ready_armed;    /**< OL_CHAN_EV_* the hook is armed for */
     
     /* State flags */
-    bool closed;                /**< Whether channel is closed */
+    atomic_bool closed;         /**< Whether channel is closed */
     bool destroyed;             /**< Whether channel is being destroyed */
 };
 
@@ -54,6 +129,540 @@ struct ol_channel {
  * Internal helper functions
  * -------------------------------------------------------------------------- */
 
+static inline bool ol_chan_is_closed(const ol_channel_t *ch) {
+    return atomic_load_explicit(&((ol_channel_t*)ch)->closed, memory_order_acquire);
+}
+
+/* ---- bounded ring ---- */
+
+static inline ol_chan_cell_t* ol_ring_cell(ol_channel_t *ch, size_t pos) {
+    return &ch->cells[ch->ring_pow2 ? (pos & ch->ring_mask) : (pos % ch->capacity)];
+}
+
+/**
+ * @brief Lock-free enqueue
+ *
+ * @return true if stored, false if the ring is full
+ */
+static bool ol_ring_try_push(ol_channel_t *ch, void *item) {
+    size_t pos = atomic_load_explicit(&ch->enqueue_pos, memory_order_relaxed);
+    
+    for (;;) {
+        ol_chan_cell_t *cell = ol_ring_cell(ch, pos);
+        size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(2 * pos);
+        
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&ch->enqueue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                cell->item = item;
+                atomic_store_explicit(&cell->seq, 2 * pos + 1, memory_order_release);
+                return true;
+            }
+            /* CAS failure reloaded pos */
+        } else if (diff < 0) {
+            return false; /* Cell still holds last lap's item: full */
+        } else {
+            pos = atomic_load_explicit(&ch->enqueue_pos, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Lock-free dequeue
+ *
+ * @return true if an item was taken, false if the ring is empty
+ */
+static bool ol_ring_try_pop(ol_channel_t *ch, void **out_item) {
+    size_t pos = atomic_load_explicit(&ch->dequeue_pos, memory_order_relaxed);
+    
+    for (;;) {
+        ol_chan_cell_t *cell = ol_ring_cell(ch, pos);
+        size_t seq = atomic_load_explicit(&cell->seq, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(2 * pos + 1);
+        
+        if (diff == 0) {
+            if (atomic_compare_exchange_weak_explicit(&ch->dequeue_pos, &pos, pos + 1,
+                                                      memory_order_relaxed,
+                                                      memory_order_relaxed)) {
+                *out_item = cell->item;
+                atomic_store_explicit(&cell->seq, 2 * (pos + ch->capacity),
+                                      memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            return false; /* Not yet filled: empty */
+        } else {
+            pos = atomic_load_explicit(&ch->dequeue_pos, memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief Lock-free batch enqueue: claims a run of free cells with one CAS
+ *
+ * A free cell can only be filled by the producer that owns its position,
+ * so once the CAS publishes pos + k every cell in the run is ours.
+ *
+ * @return Number of items stored (0 if the ring is full)
+ */
+static size_t ol_ring_try_push_many(ol_channel_t *ch, void *const *items, size_t n) {
+    size_t pos = atomic_load_explicit(&ch->enqueue_pos, memory_order_relaxed);
+    
+    for (;;) {
+        size_t k = 0;
+        while (k < n &&
+               atomic_load_explicit(&ol_ring_cell(ch, pos + k)->seq,
+                                    memory_order_acquire) == 2 * (pos + k)) {
+            k++;
+        }
+        
+        if (k == 0) {
+            size_t seq = atomic_load_explicit(&ol_ring_cell(ch, pos)->seq,
+                                              memory_order_acquire);
+            if ((intptr_t)seq - (intptr_t)(2 * pos) < 0) {
+                return 0; /* Full */
+            }
+            pos = atomic_load_explicit(&ch->enqueue_pos, memory_order_relaxed);
+            continue;
+        }
+        
+        if (atomic_compare_exchange_weak_explicit(&ch->enqueue_pos, &pos, pos + k,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+            for (size_t j = 0; j < k; j++) {
+                ol_chan_cell_t *cell = ol_ring_cell(ch, pos + j);
+                cell->item = items[j];
+                atomic_store_explicit(&cell->seq, 2 * (pos + j) + 1, memory_order_release);
+            }
+            return k;
+        }
+    }
+}
+
+/**
+ * @brief Lock-free batch dequeue: claims a run of filled cells with one CAS
+ *
+ * @return Number of items taken (0 if the ring is empty)
+ */
+static size_t ol_ring_try_pop_many(ol_channel_t *ch, void **out, size_t max) {
+    size_t pos = atomic_load_explicit(&ch->dequeue_pos, memory_order_relaxed);
+    
+    for (;;) {
+        size_t k = 0;
+        while (k < max &&
+               atomic_load_explicit(&ol_ring_cell(ch, pos + k)->seq,
+                                    memory_order_acquire) == 2 * (pos + k) + 1) {
+            k++;
+        }
+        
+        if (k == 0) {
+            size_t seq = atomic_load_explicit(&ol_ring_cell(ch, pos)->seq,
+                                              memory_order_acquire);
+            if ((intptr_t)seq - (intptr_t)(2 * pos + 1) < 0) {
+                return 0; /* Empty */
+            }
+            pos = atomic_load_explicit(&ch->dequeue_pos, memory_order_relaxed);
+            continue;
+        }
+        
+        if (atomic_compare_exchange_weak_explicit(&ch->dequeue_pos, &pos, pos + k,
+                                                  memory_order_relaxed,
+                                                  memory_order_relaxed)) {
+            for (size_t j = 0; j < k; j++) {
+                ol_chan_cell_t *cell = ol_ring_cell(ch, pos + j);
+                out[j] = cell->item;
+                atomic_store_explicit(&cell->seq, 2 * (pos + j + ch->capacity),
+                                      memory_order_release);
+            }
+            return k;
+        }
+    }
+}
+
+static void ol_ring_yield(void) {
+#if defined(_WIN32)
+    SwitchToThread();
+#else
+    (void)sched_yield();
+#endif
+}
+
+/**
+ * @brief Fire the readiness hook for armed events in mask (caller holds mutex)
+ */
+static void ol_chan_fire_ready(ol_channel_t *ch, uint32_t mask) {
+    uint32_t fire = atomic_fetch_and_explicit(&ch->ready_armed, ~mask,
+                                              memory_order_acq_rel) & mask;
+    if (fire && ch->ready_fn) {
+        ch->ready_fn(ch, fire, ch->ready_ctx);
+    }
+}
+
+/**
+ * @brief Wake receivers (readers) or senders (caller holds mutex)
+ *
+ * Signals the condition variable used by blocking calls, notifies every
+ * registered watcher of the same direction and fires an armed readiness
+ * hook.
+ */
+static void ol_chan_wake(ol_channel_t *ch, bool readers, bool all) {
+    ol_cond_t *cond = readers ? &ch->not_empty : &ch->not_full;
+    if (all) {
+        ol_cond_broadcast(cond);
+    } else {
+        ol_cond_signal(cond);
+    }
+    
+    for (ol_chan_waiter_t *w = readers ? ch->recv_watchers : ch->send_watchers;
+         w; w = w->next) {
+        w->notify(w->ctx);
+    }
+    
+    ol_chan_fire_ready(ch, readers ? OL_CHAN_EV_READ : OL_CHAN_EV_WRITE);
+}
+
+/**
+ * @brief Wake blocked threads if any are registered on the counter
+ *
+ * Pairs with the waiter's increment-then-recheck: either the waiter sees
+ * our ring update, or we see its registration and signal under the mutex.
+ * A batch of several items wakes every waiter at once.
+ */
+static void ol_ring_notify(ol_channel_t *ch, bool readers, bool all) {
+    atomic_size_t *waiters = readers ? &ch->recv_waiters : &ch->send_waiters;
+    
+    uint32_t ev = readers ? OL_CHAN_EV_READ : OL_CHAN_EV_WRITE;
+    
+    atomic_thread_fence(memory_order_seq_cst);
+    if (atomic_load_explicit(waiters, memory_order_relaxed) == 0 &&
+        (atomic_load_explicit(&ch->ready_armed, memory_order_relaxed) & ev) == 0) {
+        return;
+    }
+    
+    ol_mutex_lock(&ch->mutex);
+    ol_chan_wake(ch, readers, all);
+    ol_mutex_unlock(&ch->mutex);
+}
+
+/**
+ * @brief Bounded send: lock-free fast path, eventcount wait when full
+ */
+static int ol_ring_send(ol_channel_t *ch, void *item, int64_t deadline_ns) {
+    if (ol_chan_is_closed(ch)) {
+        if (item && ch->dtor) {
+            ch->dtor(item);
+        }
+        return OL_CLOSED;
+    }
+    
+    bool pushed = ol_ring_try_push(ch, item);
+    for (int i = 0; !pushed && i < OL_RING_YIELDS; i++) {
+        ol_ring_yield();
+        pushed = ol_ring_try_push(ch, item);
+    }
+    
+    if (!pushed) {
+        int r = OL_SUCCESS;
+        
+        ol_mutex_lock(&ch->mutex);
+        atomic_fetch_add_explicit(&ch->send_waiters, 1, memory_order_seq_cst);
+        atomic_thread_fence(memory_order_seq_cst);
+        
+        while (!ol_chan_is_closed(ch) && !(pushed = ol_ring_try_push(ch, item))) {
+            int w = ol_cond_wait_until(&ch->not_full, &ch->mutex, deadline_ns);
+            if (w == 0) {
+                r = OL_TIMEOUT;
+                break;
+            } else if (w < 0) {
+                r = OL_ERROR;
+                break;
+            }
+        }
+        
+        atomic_fetch_sub_explicit(&ch->send_waiters, 1, memory_order_relaxed);
+        ol_mutex_unlock(&ch->mutex);
+        
+        if (!pushed) {
+            if (r != OL_SUCCESS) {
+                return r; /* Wait failed: caller still owns item */
+            }
+            if (item && ch->dtor) {
+                ch->dtor(item);
+            }
+            return OL_CLOSED;
+        }
+    }
+    
+    ol_ring_notify(ch, true, false);
+    return OL_SUCCESS;
+}
+
+/**
+ * @brief Bounded receive: drains remaining items after close
+ */
+static int ol_ring_recv(ol_channel_t *ch, void **out_item, int64_t deadline_ns) {
+    bool popped = ol_ring_try_pop(ch, out_item);
+    for (int i = 0; !popped && i < OL_RING_YIELDS && !ol_chan_is_closed(ch); i++) {
+        ol_ring_yield();
+        popped = ol_ring_try_pop(ch, out_item);
+    }
+    
+    if (!popped) {
+        int r = OL_SUCCESS;
+        
+        ol_mutex_lock(&ch->mutex);
+        atomic_fetch_add_explicit(&ch->recv_waiters, 1, memory_order_seq_cst);
+        atomic_thread_fence(memory_order_seq_cst);
+        
+        for (;;) {
+            if ((popped = ol_ring_try_pop(ch, out_item))) {
+                break;
+            }
+            if (ol_chan_is_closed(ch)) {
+                /* A send racing with close may land after our check */
+                popped = ol_ring_try_pop(ch, out_item);
+                break;
+            }
+            int w = ol_cond_wait_until(&ch->not_empty, &ch->mutex, deadline_ns);
+            if (w == 0) {
+                r = OL_TIMEOUT;
+                break;
+            } else if (w < 0) {
+                r = OL_ERROR;
+                break;
+            }
+        }
+        
+        atomic_fetch_sub_explicit(&ch->recv_waiters, 1, memory_order_relaxed);
+        ol_mutex_unlock(&ch->mutex);
+        
+        if (!popped) {
+            *out_item = NULL;
+            return (r != OL_SUCCESS) ? r : 0; /* 0: closed and empty */
+        }
+    }
+    
+    ol_ring_notify(ch, false, false);
+    return 1;
+}
+
+/**
+ * @brief Bounded batch send: one CAS and one wakeup per contiguous run
+ *
+ * @return Items sent, or OL_CLOSED/OL_TIMEOUT/OL_ERROR if none were
+ */
+static int ol_ring_send_many(ol_channel_t *ch, void *const *items, size_t n,
+                             int64_t deadline_ns) {
+    size_t sent = 0;
+    int r = OL_SUCCESS;
+    
+    while (sent < n) {
+        if (ol_chan_is_closed(ch)) {
+            r = OL_CLOSED;
+            break;
+        }
+        
+        size_t k = ol_ring_try_push_many(ch, items + sent, n - sent);
+        if (k == 0) {
+            ol_mutex_lock(&ch->mutex);
+            atomic_fetch_add_explicit(&ch->send_waiters, 1, memory_order_seq_cst);
+            atomic_thread_fence(memory_order_seq_cst);
+            
+            while (!ol_chan_is_closed(ch) &&
+                   (k = ol_ring_try_push_many(ch, items + sent, n - sent)) == 0) {
+                int w = ol_cond_wait_until(&ch->not_full, &ch->mutex, deadline_ns);
+                if (w == 0) {
+                    r = OL_TIMEOUT;
+                    break;
+                } else if (w < 0) {
+                    r = OL_ERROR;
+                    break;
+                }
+            }
+            
+            atomic_fetch_sub_explicit(&ch->send_waiters, 1, memory_order_relaxed);
+            ol_mutex_unlock(&ch->mutex);
+            
+            if (k == 0) {
+                if (r == OL_SUCCESS) {
+                    r = OL_CLOSED;
+                }
+                break;
+            }
+        }
+        
+        sent += k;
+        ol_ring_notify(ch, true, k > 1);
+    }
+    
+    return (sent > 0) ? (int)sent : r;
+}
+
+/**
+ * @brief Bounded batch receive: waits for the first item only
+ */
+static int ol_ring_recv_many(ol_channel_t *ch, void **out, size_t max,
+                             int64_t deadline_ns) {
+    size_t k = ol_ring_try_pop_many(ch, out, max);
+    
+    if (k == 0) {
+        int r = OL_SUCCESS;
+        
+        ol_mutex_lock(&ch->mutex);
+        atomic_fetch_add_explicit(&ch->recv_waiters, 1, memory_order_seq_cst);
+        atomic_thread_fence(memory_order_seq_cst);
+        
+        for (;;) {
+            if ((k = ol_ring_try_pop_many(ch, out, max)) > 0) {
+                break;
+            }
+            if (ol_chan_is_closed(ch)) {
+                k = ol_ring_try_pop_many(ch, out, max);
+                break;
+            }
+            int w = ol_cond_wait_until(&ch->not_empty, &ch->mutex, deadline_ns);
+            if (w == 0) {
+                r = OL_TIMEOUT;
+                break;
+            } else if (w < 0) {
+                r = OL_ERROR;
+                break;
+            }
+        }
+        
+        atomic_fetch_sub_explicit(&ch->recv_waiters, 1, memory_order_relaxed);
+        ol_mutex_unlock(&ch->mutex);
+        
+        if (k == 0) {
+            return (r != OL_SUCCESS) ? r : 0; /* 0: closed and empty */
+        }
+    }
+    
+    ol_ring_notify(ch, false, k > 1);
+    return (int)k;
+}
+
+/* ---- watchers ---- */
+
+/**
+ * @brief Register a watcher for readable (readers) or writable transitions
+ *
+ * Counts as a blocked waiter so the lock-free ring path does not skip the
+ * wakeup; the caller must re-check the channel after registering.
+ */
+static void ol_chan_watch(ol_channel_t *ch, ol_chan_waiter_t *w, bool readers) {
+    ol_mutex_lock(&ch->mutex);
+    
+    ol_chan_waiter_t **head = readers ? &ch->recv_watchers : &ch->send_watchers;
+    w->prev = NULL;
+    w->next = *head;
+    if (*head) {
+        (*head)->prev = w;
+    }
+    *head = w;
+    atomic_fetch_add_explicit(readers ? &ch->recv_waiters : &ch->send_waiters, 1,
+                              memory_order_seq_cst);
+    
+    ol_mutex_unlock(&ch->mutex);
+}
+
+static void ol_chan_unwatch(ol_channel_t *ch, ol_chan_waiter_t *w, bool readers) {
+    ol_mutex_lock(&ch->mutex);
+    
+    if (w->prev) {
+        w->prev->next = w->next;
+    } else if (readers) {
+        ch->recv_watchers = w->next;
+    } else {
+        ch->send_watchers = w->next;
+    }
+    if (w->next) {
+        w->next->prev = w->prev;
+    }
+    atomic_fetch_sub_explicit(readers ? &ch->recv_waiters : &ch->send_waiters, 1,
+                              memory_order_relaxed);
+    
+    ol_mutex_unlock(&ch->mutex);
+}
+
+/* ---- select ---- */
+
+/** @brief Cases whose waiter nodes live on the stack */
+#define OL_CHAN_SELECT_STACK_CASES 8
+
+/**
+ * @brief Single wait point shared by all cases of one select call
+ */
+typedef struct {
+    ol_mutex_t mu;              /**< Protects signaled */
+    ol_cond_t cv;               /**< Signaled by any case's channel */
+    bool signaled;              /**< Some channel changed since last poll */
+} ol_chan_selector_t;
+
+/** @brief Rotating start case so no case starves under steady load */
+static OL_THREAD_LOCAL size_t tl_select_rr = 0;
+
+static void ol_chan_selector_notify(void *ctx) {
+    ol_chan_selector_t *sel = (ol_chan_selector_t*)ctx;
+    
+    ol_mutex_lock(&sel->mu);
+    sel->signaled = true;
+    ol_cond_signal(&sel->cv);
+    ol_mutex_unlock(&sel->mu);
+}
+
+/**
+ * @brief Attempt one case without blocking
+ *
+ * @return true if the case completed (result and item filled in)
+ */
+static bool ol_chan_try_case(ol_chan_case_t *c) {
+    if (!c->ch) {
+        return false; /* NULL channel: never ready */
+    }
+    
+    if (c->op == OL_CHAN_SELECT_RECV) {
+        int r = ol_channel_try_recv(c->ch, &c->item);
+        if (r == 1) {
+            c->result = 1;
+            return true;
+        }
+        if (r == 0 && ol_channel_is_closed(c->ch)) {
+            /* Closed: deliver a late item if one slipped in, else report closed */
+            c->result = (ol_channel_try_recv(c->ch, &c->item) == 1) ? 1 : 0;
+            return true;
+        }
+        return false;
+    }
+    
+    int r = ol_channel_try_send(c->ch, c->item);
+    if (r == 1 || r == OL_CLOSED) {
+        c->result = (r == 1) ? OL_SUCCESS : OL_CLOSED;
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Poll all cases once, starting at a rotating index
+ *
+ * @return Index of the completed case, or -1 if none is ready
+ */
+static int ol_chan_select_poll(ol_chan_case_t *cases, size_t n, size_t start) {
+    for (size_t k = 0; k < n; k++) {
+        size_t i = (start + k) % n;
+        if (ol_chan_try_case(&cases[i])) {
+            return (int)i;
+        }
+    }
+    
+    return -1;
+}
+
+/* ---- unbounded list ---- */
+
 /**
  * @brief Queue push operation (caller must hold mutex)
  */
@@ -106,6 +715,16 @@ static int ol_chan_pop(ol_channel_t *ch, void **out_item) {
  * @brief Clear queue and free all items
  */
 static void ol_chan_clear(ol_channel_t *ch) {
+    if (ch->cells) {
+        void *item;
+        while (ol_ring_try_pop(ch, &item)) {
+            if (ch->dtor && item) {
+                ch->dtor(item);
+            }
+        }
+        return;
+    }
+    
     while (ch->head) {
         ol_chan_node_t *node = ch->head;
         ch->head = node->next;
@@ -121,28 +740,11 @@ static void ol_chan_clear(ol_channel_t *ch) {
     ch->size = 0;
 }
 
-/**
- * @brief Wait for space in bounded channel
- */
-static int ol_chan_wait_for_space(ol_channel_t *ch, int64_t deadline_ns) {
-    while (ch->capacity > 0 && ch->size >= ch->capacity && !ch->closed) {
-        int r = ol_cond_wait_until(&ch->not_full, &ch->mutex, deadline_ns);
-        if (r == 0) {
-            return OL_TIMEOUT;
-        } else if (r < 0) {
-            return OL_ERROR;
-        }
-        /* Signaled, continue loop */
-    }
-    
-    return OL_SUCCESS;
-}
-
 /**
  * @brief Wait for item in channel
  */
 static int ol_chan_wait_for_item(ol_channel_t *ch, int64_t deadline_ns) {
-    while (ch->size == 0 && !ch->closed) {
+    while (ch->size == 0 && !ol_chan_is_closed(ch)) {
         int r = ol_cond_wait_until(&ch->not_empty, &ch->mutex, deadline_ns);
         if (r == 0) {
             return OL_TIMEOUT;
@@ -171,17 +773,40 @@ ol_channel_t* ol_channel_create(size_t capacity,
     ch->size = 0;
     ch->capacity = capacity;
     ch->dtor = dtor;
-    ch->closed = false;
     ch->destroyed = false;
+    atomic_init(&ch->closed, false);
+    atomic_init(&ch->recv_waiters, 0);
+    atomic_init(&ch->send_waiters, 0);
+    atomic_init(&ch->enqueue_pos, 0);
+    atomic_init(&ch->dequeue_pos, 0);
+    atomic_init(&ch->ready_armed, 0);
+    ch->ready_fn = NULL;
+    ch->ready_ctx = NULL;
+    
+    if (capacity > 0) {
+        ch->cells = (ol_chan_cell_t*)malloc(capacity * sizeof(ol_chan_cell_t));
+        if (!ch->cells) {
+            free(ch);
+            return NULL;
+        }
+        for (size_t i = 0; i < capacity; i++) {
+            atomic_init(&ch->cells[i].seq, 2 * i);
+            ch->cells[i].item = NULL;
+        }
+        ch->ring_pow2 = (capacity & (capacity - 1)) == 0;
+        ch->ring_mask = capacity - 1;
+    }
     
     /* Initialize synchronization primitives */
     if (ol_mutex_init(&ch->mutex) != OL_SUCCESS) {
+        free(ch->cells);
         free(ch);
         return NULL;
     }
     
     if (ol_cond_init(&ch->not_empty) != OL_SUCCESS) {
         ol_mutex_destroy(&ch->mutex);
+        free(ch->cells);
         free(ch);
         return NULL;
     }
@@ -189,6 +814,7 @@ ol_channel_t* ol_channel_create(size_t capacity,
     if (ol_cond_init(&ch->not_full) != OL_SUCCESS) {
         ol_cond_destroy(&ch->not_empty);
         ol_mutex_destroy(&ch->mutex);
+        free(ch->cells);
         free(ch);
         return NULL;
     }
@@ -209,11 +835,11 @@ void ol_channel_destroy(ol_channel_t *ch) {
     }
     
     ch->destroyed = true;
-    ch->closed = true;
+    atomic_store(&ch->closed, true);
     
     /* Wake all waiters */
-    ol_cond_broadcast(&ch->not_empty);
-    ol_cond_broadcast(&ch->not_full);
+    ol_chan_wake(ch, true, true);
+    ol_chan_wake(ch, false, true);
     
     /* Clear queue */
     ol_chan_clear(ch);
@@ -226,6 +852,7 @@ void ol_channel_destroy(ol_channel_t *ch) {
     ol_mutex_destroy(&ch->mutex);
     
     /* Free channel structure */
+    free(ch->cells);
     free(ch);
 }
 
@@ -236,16 +863,16 @@ int ol_channel_close(ol_channel_t *ch) {
     
     ol_mutex_lock(&ch->mutex);
     
-    if (ch->closed) {
+    if (ol_chan_is_closed(ch)) {
         ol_mutex_unlock(&ch->mutex);
         return OL_SUCCESS; /* Already closed */
     }
     
-    ch->closed = true;
+    atomic_store(&ch->closed, true);
     
     /* Wake all waiters */
-    ol_cond_broadcast(&ch->not_empty);
-    ol_cond_broadcast(&ch->not_full);
+    ol_chan_wake(ch, true, true);
+    ol_chan_wake(ch, false, true);
     
     ol_mutex_unlock(&ch->mutex);
     
@@ -260,47 +887,30 @@ int ol_channel_send_deadline(ol_channel_t *ch,
                              void *item,
                              int64_t deadline_ns) {
     if (!ch) {
-        if (item) {
-            /* Caller still owns item */
-        }
+        /* Caller still owns item */
         return OL_ERROR;
     }
     
-    ol_mutex_lock(&ch->mutex);
-    
-    if (ch->closed) {
-        ol_mutex_unlock(&ch->mutex);
-        /* Channel closed: destroy item */
-        if (item && ch->dtor) {
-            ch->dtor(item);
-        }
-        return OL_CLOSED;
+    if (ch->cells) {
+        return ol_ring_send(ch, item, deadline_ns);
     }
     
-    /* Wait for space if bounded */
-    if (ch->capacity > 0) {
-        int r = ol_chan_wait_for_space(ch, deadline_ns);
-        if (r != OL_SUCCESS) {
-            ol_mutex_unlock(&ch->mutex);
-            /* Wait failed: caller still owns item */
-            return r;
-        }
-    }
+    ol_mutex_lock(&ch->mutex);
     
-    /* Check if closed while waiting */
-    if (ch->closed) {
+    if (ol_chan_is_closed(ch)) {
         ol_mutex_unlock(&ch->mutex);
+        /* Channel closed: destroy item */
         if (item && ch->dtor) {
             ch->dtor(item);
         }
         return OL_CLOSED;
     }
     
-    /* Enqueue item */
+    /* Enqueue item (unbounded: never waits for space) */
     ol_chan_push(ch, item);
     
     /* Signal receivers */
-    ol_cond_signal(&ch->not_empty);
+    ol_chan_wake(ch, true, false);
     
     ol_mutex_unlock(&ch->mutex);
     
@@ -312,27 +922,36 @@ int ol_channel_try_send(ol_channel_t *ch, void *item) {
         return OL_ERROR;
     }
     
-    ol_mutex_lock(&ch->mutex);
-    
-    if (ch->closed) {
-        ol_mutex_unlock(&ch->mutex);
+    if (ol_chan_is_closed(ch)) {
         if (item && ch->dtor) {
             ch->dtor(item);
         }
         return OL_CLOSED;
     }
     
-    /* Check if bounded and full */
-    if (ch->capacity > 0 && ch->size >= ch->capacity) {
+    if (ch->cells) {
+        if (!ol_ring_try_push(ch, item)) {
+            return 0; /* Would block */
+        }
+        ol_ring_notify(ch, true, false);
+        return 1;
+    }
+    
+    ol_mutex_lock(&ch->mutex);
+    
+    if (ol_chan_is_closed(ch)) {
         ol_mutex_unlock(&ch->mutex);
-        return 0; /* Would block */
+        if (item && ch->dtor) {
+            ch->dtor(item);
+        }
+        return OL_CLOSED;
     }
     
     /* Enqueue item */
     ol_chan_push(ch, item);
     
     /* Signal receivers */
-    ol_cond_signal(&ch->not_empty);
+    ol_chan_wake(ch, true, false);
     
     ol_mutex_unlock(&ch->mutex);
     
@@ -352,6 +971,10 @@ int ol_channel_recv_deadline(ol_channel_t *ch,
     
     *out_item = NULL;
     
+    if (ch->cells) {
+        return ol_ring_recv(ch, out_item, deadline_ns);
+    }
+    
     ol_mutex_lock(&ch->mutex);
     
     /* Wait for item */
@@ -362,7 +985,7 @@ int ol_channel_recv_deadline(ol_channel_t *ch,
     }
     
     /* Check state after wait */
-    if (ch->size == 0 && ch->closed) {
+    if (ch->size == 0 && ol_chan_is_closed(ch)) {
         /* Channel closed and empty */
         ol_mutex_unlock(&ch->mutex);
         *out_item = NULL;
@@ -374,11 +997,6 @@ int ol_channel_recv_deadline(ol_channel_t *ch,
     ol_chan_pop(ch, &item);
     *out_item = item;
     
-    /* Signal senders if bounded */
-    if (ch->capacity > 0) {
-        ol_cond_signal(&ch->not_full);
-    }
-    
     ol_mutex_unlock(&ch->mutex);
     
     return 1;
@@ -391,6 +1009,14 @@ int ol_channel_try_recv(ol_channel_t *ch, void **out_item) {
     
     *out_item = NULL;
     
+    if (ch->cells) {
+        if (!ol_ring_try_pop(ch, out_item)) {
+            return 0; /* Would block */
+        }
+        ol_ring_notify(ch, false, false);
+        return 1;
+    }
+    
     ol_mutex_lock(&ch->mutex);
     
     if (ch->size == 0) {
@@ -403,28 +1029,273 @@ int ol_channel_try_recv(ol_channel_t *ch, void **out_item) {
     ol_chan_pop(ch, &item);
     *out_item = item;
     
-    /* Signal senders if bounded */
-    if (ch->capacity > 0) {
-        ol_cond_signal(&ch->not_full);
+    ol_mutex_unlock(&ch->mutex);
+    
+    return 1;
+}
+
+int ol_channel_send_many(ol_channel_t *ch,
+                         void *const *items,
+                         size_t n,
+                         int64_t deadline_ns) {
+    if (!ch || (!items && n > 0) || n > (size_t)INT_MAX) {
+        return OL_ERROR;
+    }
+    
+    if (n == 0) {
+        return 0;
+    }
+    
+    if (ch->cells) {
+        return ol_ring_send_many(ch, items, n, deadline_ns);
+    }
+    
+    ol_mutex_lock(&ch->mutex);
+    
+    if (ol_chan_is_closed(ch)) {
+        ol_mutex_unlock(&ch->mutex);
+        return OL_CLOSED;
+    }
+    
+    for (size_t i = 0; i < n; i++) {
+        ol_chan_push(ch, items[i]);
     }
     
+    /* One wakeup for the whole batch */
+    ol_chan_wake(ch, true, n > 1);
+    
     ol_mutex_unlock(&ch->mutex);
     
-    return 1;
+    return (int)n;
 }
 
-bool ol_channel_is_closed(const ol_channel_t *ch) {
+int ol_channel_recv_many(ol_channel_t *ch,
+                         void **out,
+                         size_t max,
+                         int64_t deadline_ns) {
+    if (!ch || !out || max == 0 || max > (size_t)INT_MAX) {
+        return OL_ERROR;
+    }
+    
+    if (ch->cells) {
+        return ol_ring_recv_many(ch, out, max, deadline_ns);
+    }
+    
+    ol_mutex_lock(&ch->mutex);
+    
+    int r = ol_chan_wait_for_item(ch, deadline_ns);
+    if (r != OL_SUCCESS) {
+        ol_mutex_unlock(&ch->mutex);
+        return r;
+    }
+    
+    size_t k = 0;
+    while (k < max && ol_chan_pop(ch, &out[k])) {
+        k++;
+    }
+    
+    ol_mutex_unlock(&ch->mutex);
+    
+    return (int)k; /* 0: closed and empty */
+}
+
+int ol_channel_try_recv_many(ol_channel_t *ch,
+                             void **out,
+                             size_t max) {
+    if (!ch || !out || max > (size_t)INT_MAX) {
+        return OL_ERROR;
+    }
+    
+    if (max == 0) {
+        return 0;
+    }
+    
+    if (ch->cells) {
+        size_t k = ol_ring_try_pop_many(ch, out, max);
+        if (k > 0) {
+            ol_ring_notify(ch, false, k > 1);
+        }
+        return (int)k;
+    }
+    
+    ol_mutex_lock(&ch->mutex);
+    
+    size_t k = 0;
+    while (k < max && ol_chan_pop(ch, &out[k])) {
+        k++;
+    }
+    
+    ol_mutex_unlock(&ch->mutex);
+    
+    return (int)k;
+}
+
+int ol_channel_select(ol_chan_case_t *cases,
+                      size_t n,
+                      int64_t deadline_ns) {
+    if (!cases || n == 0 || n > (size_t)INT_MAX) {
+        return OL_ERROR;
+    }
+    
+    bool any = false;
+    for (size_t i = 0; i < n; i++) {
+        cases[i].result = 0;
+        any = any || cases[i].ch != NULL;
+    }
+    if (!any && deadline_ns <= 0) {
+        return OL_ERROR; /* Nothing could ever become ready */
+    }
+    
+    size_t start = tl_select_rr++ % n;
+    int idx = ol_chan_select_poll(cases, n, start);
+    if (idx >= 0) {
+        return idx;
+    }
+    
+    ol_chan_waiter_t stack_nodes[OL_CHAN_SELECT_STACK_CASES];
+    ol_chan_waiter_t *nodes = stack_nodes;
+    if (n > OL_CHAN_SELECT_STACK_CASES) {
+        nodes = (ol_chan_waiter_t*)malloc(n * sizeof(ol_chan_waiter_t));
+        if (!nodes) {
+            return OL_NOMEM;
+        }
+    }
+    
+    ol_chan_selector_t sel;
+    sel.signaled = false;
+    if (ol_mutex_init(&sel.mu) != OL_SUCCESS) {
+        if (nodes != stack_nodes) {
+            free(nodes);
+        }
+        return OL_ERROR;
+    }
+    if (ol_cond_init(&sel.cv) != OL_SUCCESS) {
+        ol_mutex_destroy(&sel.mu);
+        if (nodes != stack_nodes) {
+            free(nodes);
+        }
+        return OL_ERROR;
+    }
+    
+    /* One waiter for the whole select, registered on every channel */
+    for (size_t i = 0; i < n; i++) {
+        if (cases[i].ch) {
+            nodes[i].notify = ol_chan_selector_notify;
+            nodes[i].ctx = &sel;
+            ol_chan_watch(cases[i].ch, &nodes[i], cases[i].op == OL_CHAN_SELECT_RECV);
+        }
+    }
+    
+    for (;;) {
+        atomic_thread_fence(memory_order_seq_cst);
+        idx = ol_chan_select_poll(cases, n, start);
+        if (idx >= 0) {
+            break;
+        }
+        
+        ol_mutex_lock(&sel.mu);
+        int w = 1;
+        while (!sel.signaled && w > 0) {
+            w = ol_cond_wait_until(&sel.cv, &sel.mu, deadline_ns);
+        }
+        sel.signaled = false;
+        ol_mutex_unlock(&sel.mu);
+        
+        if (w == 0) {
+            /* Timed out: one last look so a wakeup racing the deadline is not lost */
+            idx = ol_chan_select_poll(cases, n, start);
+            if (idx < 0) {
+                idx = OL_TIMEOUT;
+            }
+            break;
+        } else if (w < 0) {
+            idx = OL_ERROR;
+            break;
+        }
+    }
+    
+    for (size_t i = 0; i < n; i++) {
+        if (cases[i].ch) {
+            ol_chan_unwatch(cases[i].ch, &nodes[i], cases[i].op == OL_CHAN_SELECT_RECV);
+        }
+    }
+    
+    ol_cond_destroy(&sel.cv);
+    ol_mutex_destroy(&sel.mu);
+    if (nodes != stack_nodes) {
+        free(nodes);
+    }
+    
+    return idx;
+}
+
+int ol_channel_set_ready_hook(ol_channel_t *ch,
+                              ol_chan_ready_fn fn,
+                              void *ctx) {
     if (!ch) {
-        return true;
+        return OL_ERROR;
     }
     
-    bool closed;
+    ol_mutex_lock(&ch->mutex);
     
-    ol_mutex_lock((ol_mutex_t*)&ch->mutex);
-    closed = ch->closed;
-    ol_mutex_unlock((ol_mutex_t*)&ch->mutex);
+    if (fn && ch->ready_fn && (ch->ready_fn != fn || ch->ready_ctx != ctx)) {
+        ol_mutex_unlock(&ch->mutex);
+        return OL_ERROR;
+    }
+    
+    ch->ready_fn = fn;
+    ch->ready_ctx = fn ? ctx : NULL;
+    if (!fn) {
+        atomic_store_explicit(&ch->ready_armed, 0, memory_order_relaxed);
+    }
+    
+    ol_mutex_unlock(&ch->mutex);
+    return OL_SUCCESS;
+}
+
+int ol_channel_arm_ready(ol_channel_t *ch, uint32_t events) {
+    if (!ch) {
+        return OL_ERROR;
+    }
     
-    return closed;
+    events &= OL_CHAN_EV_READ | OL_CHAN_EV_WRITE;
+    
+    ol_mutex_lock(&ch->mutex);
+    
+    if (!ch->ready_fn) {
+        ol_mutex_unlock(&ch->mutex);
+        return OL_ERROR;
+    }
+    
+    /* Publish the arm before sampling state: a producer that misses the
+     * armed bit has already made its change visible to the check below */
+    atomic_fetch_or_explicit(&ch->ready_armed, events, memory_order_seq_cst);
+    atomic_thread_fence(memory_order_seq_cst);
+    
+    uint32_t ready = 0;
+    bool closed = ol_chan_is_closed(ch);
+    size_t len = ch->cells ? ol_channel_len(ch) : ch->size; /* ring len is lock-free */
+    if ((events & OL_CHAN_EV_READ) && (closed || len > 0)) {
+        ready |= OL_CHAN_EV_READ;
+    }
+    if ((events & OL_CHAN_EV_WRITE) &&
+        (closed || ch->capacity == 0 || len < ch->capacity)) {
+        ready |= OL_CHAN_EV_WRITE;
+    }
+    if (ready) {
+        ol_chan_fire_ready(ch, ready);
+    }
+    
+    ol_mutex_unlock(&ch->mutex);
+    return OL_SUCCESS;
+}
+
+bool ol_channel_is_closed(const ol_channel_t *ch) {
+    if (!ch) {
+        return true;
+    }
+    
+    return ol_chan_is_closed(ch);
 }
 
 size_t ol_channel_len(const ol_channel_t *ch) {
@@ -432,6 +1303,15 @@ size_t ol_channel_len(const ol_channel_t *ch) {
         return 0;
     }
     
+    if (ch->cells) {
+        /* Snapshot; may be stale under concurrent traffic */
+        ol_channel_t *c = (ol_channel_t*)ch;
+        size_t tail = atomic_load_explicit(&c->enqueue_pos, memory_order_acquire);
+        size_t head = atomic_load_explicit(&c->dequeue_pos, memory_order_acquire);
+        size_t len = (tail > head) ? tail - head : 0;
+        return (len > ch->capacity) ? ch->capacity : len;
+    }
+    
     size_t len;
     
     ol_mutex_lock((ol_mutex_t*)&ch->mutex);
@@ -443,4 +1323,4 @@ size_t ol_channel_len(const ol_channel_t *ch) {
 
 size_t ol_channel_capacity(const ol_channel_t *ch) {
     return ch ? ch->capacity : 0;
-}
\ No newline at end of file
+}
@@ -13,6 +13,7 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <stddef.h>
 
 /* --------------------------------------------------------------------------
  * Coroutine state definitions
@@ -35,7 +36,12 @@ typedef enum {
  */
 struct ol_co {
     /* Green thread backend */
-    ol_gt_t *gt;                    /**< Underlying green thread */
+    ol_gt_t *gt;                    /**< Underlying green thread (NULL if stackless) */
+    
+    /* Stackless backend */
+    ol_co_step_fn step;             /**< Step function (NULL if stackful) */
+    void *frame;                    /**< Frame, allocated right after this struct */
+    int pc;                         /**< Resume point (0 = start) */
     
     /* User function and data */
     ol_co_entry_fn entry;           /**< User entry function */
@@ -47,7 +53,7 @@ struct ol_co {
     volatile int canceled;          /**< Cancellation requested flag */
     
     /* Payload exchange */
-    ol_mutex_t payload_mutex;       /**< Protects payload exchange */
+    ol_mutex_t payload_mutex;       /**< Protects payload exchange (stackful only) */
     void *resume_payload;           /**< Payload from resume() */
     void *yield_payload;            /**< Payload from yield() */
     void *result;                   /**< Final result from entry */
@@ -118,6 +124,38 @@ static void ol_co_trampoline(void *arg) {
     ol_gt_yield();
 }
 
+/**
+ * @brief Offset of a stackless coroutine's frame within its allocation
+ */
+#define OL_CO_FRAME_OFFSET \
+    ((sizeof(ol_co_t) + _Alignof(max_align_t) - 1) & ~(_Alignof(max_align_t) - 1))
+
+/**
+ * @brief Run a stackless coroutine to its next yield point or its end
+ */
+static int ol_co_stackless_step(ol_co_t *co, void *payload) {
+    if (co->canceled) {
+        co->state = CO_STATE_CANCELED;
+        return OL_ERROR;
+    }
+    
+    co->state = CO_STATE_RUNNING;
+    co->resume_count++;
+    
+    int step_result = co->step(co, co->frame, payload);
+    
+    /* The step may have canceled itself; that outranks where it stopped */
+    if (co->canceled) {
+        co->state = CO_STATE_CANCELED;
+    } else if (step_result == OL_CO_STEP_DONE) {
+        co->state = CO_STATE_DONE;
+    } else {
+        co->state = CO_STATE_SUSPENDED;
+    }
+    
+    return OL_SUCCESS;
+}
+
 /* --------------------------------------------------------------------------
  * Public API implementation
  * -------------------------------------------------------------------------- */
@@ -171,8 +209,31 @@ ol_co_t* ol_co_spawn(ol_co_entry_fn entry,
     return co;
 }
 
+ol_co_t* ol_co_stackless_spawn(ol_co_step_fn step,
+                               size_t frame_size,
+                               const void *frame_init) {
+    if (!step) {
+        return NULL;
+    }
+    
+    /* One allocation for the handle and its frame; no stack, no mutex */
+    ol_co_t *co = (ol_co_t*)calloc(1, OL_CO_FRAME_OFFSET + frame_size);
+    if (!co) {
+        return NULL;
+    }
+    
+    co->step = step;
+    co->frame = (char*)co + OL_CO_FRAME_OFFSET;
+    if (frame_init && frame_size > 0) {
+        memcpy(co->frame, frame_init, frame_size);
+    }
+    
+    co->state = CO_STATE_READY;
+    return co;
+}
+
 int ol_co_resume(ol_co_t *co, void *payload) {
-    if (!co || !co->gt) {
+    if (!co || (!co->gt && !co->step)) {
         return OL_ERROR;
     }
     
@@ -183,6 +244,11 @@ int ol_co_resume(ol_co_t *co, void *payload) {
         return OL_ERROR;
     }
     
+    /* Stackless: step synchronously on this stack */
+    if (co->step) {
+        return ol_co_stackless_step(co, payload);
+    }
+    
     /* Store resume payload */
     ol_mutex_lock(&co->payload_mutex);
     co->resume_payload = payload;
@@ -227,8 +293,24 @@ void* ol_co_yield(void *payload) {
     return resume_payload;
 }
 
+void* ol_co_yielded(const ol_co_t *co) {
+    if (!co) {
+        return NULL;
+    }
+    
+    if (co->step) {
+        return co->yield_payload;
+    }
+    
+    ol_co_t *mco = (ol_co_t*)co;
+    ol_mutex_lock(&mco->payload_mutex);
+    void *payload = mco->yield_payload;
+    ol_mutex_unlock(&mco->payload_mutex);
+    return payload;
+}
+
 void* ol_co_join(ol_co_t *co) {
-    if (!co || !co->gt) {
+    if (!co || (!co->gt && !co->step)) {
         return NULL;
     }
     
@@ -236,6 +318,17 @@ void* ol_co_join(ol_co_t *co) {
         return co->result;
     }
     
+    /* Stackless: drive it to the end */
+    if (co->step) {
+        while (co->state != CO_STATE_DONE) {
+            if (ol_co_stackless_step(co, NULL) != OL_SUCCESS) {
+                return NULL;
+            }
+        }
+        co->joined = true;
+        return co->result;
+    }
+    
     /* Join underlying green thread */
     if (ol_gt_join(co->gt) != OL_SUCCESS) {
         return NULL;
@@ -246,7 +339,7 @@ void* ol_co_join(ol_co_t *co) {
 }
 
 int ol_co_cancel(ol_co_t *co) {
-    if (!co || !co->gt) {
+    if (!co || (!co->gt && !co->step)) {
         return OL_ERROR;
     }
     
@@ -258,6 +351,12 @@ int ol_co_cancel(ol_co_t *co) {
     /* Request cancellation */
     co->canceled = 1;
     
+    /* Stackless: takes effect at once (from inside a step, once it returns) */
+    if (co->step) {
+        co->state = CO_STATE_CANCELED;
+        return OL_SUCCESS;
+    }
+    
     /* Cancel underlying green thread */
     if (ol_gt_cancel(co->gt) != OL_SUCCESS) {
         return OL_ERROR;
@@ -272,6 +371,12 @@ void ol_co_destroy(ol_co_t *co) {
         return;
     }
     
+    /* Stackless: the frame lives in the same allocation */
+    if (co->step) {
+        free(co);
+        return;
+    }
+    
     /* Cancel if still running */
     if (co->state != CO_STATE_DONE && 
         co->state != CO_STATE_CANCELED &&
@@ -307,4 +412,22 @@ bool ol_co_is_canceled(const ol_co_t *co) {
     }
     
     return (co->canceled != 0);
-}
\ No newline at end of file
+}
+
+/* --------------------------------------------------------------------------
+ * Stackless frame support (used by the OL_CO_* macros)
+ * -------------------------------------------------------------------------- */
+
+int ol_co_frame_pc(const ol_co_t *co) {
+    return co->pc;
+}
+
+void ol_co_frame_suspend(ol_co_t *co, int pc, void *payload) {
+    co->pc = pc;
+    co->yield_payload = payload;
+    co->yield_count++;
+}
+
+void ol_co_frame_finish(ol_co_t *co, void *result) {
+    co->result = result;
+}
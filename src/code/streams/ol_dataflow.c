@@ -17,8 +17,7 @@
  * Concurrency model
  * -----------------
  * - Graph->pool executes worker tasks; workers iterate nodes and try to pull items non-blocking.
- * - This simple model favors low-latency processing but may busy-wait if no work is present.
- * - For production, integrate a wake/cond mechanism to avoid spinning.
+ * - Idle workers block in ol_channel_select over all inboxes rather than busy-waiting.
  *
  * Testing and tooling
  * -------------------
@@ -29,12 +28,20 @@
  */
 
 #include "ol_dataflow.h"
+#include "ol_deadlines.h"
 
 #include <stdlib.h>
 #include <string.h>
 
 /* -------------------- Internal structures -------------------- */
 
+/* Items moved per channel operation by workers and batched emits */
+#define DF_BATCH        32
+/* Distinct edges a worker stages emits for before flushing */
+#define DF_STAGE_EDGES  8
+/* Longest an idle worker blocks before re-checking the running flag */
+#define DF_IDLE_WAIT_NS (50LL * 1000000LL)
+
 /**
  * @struct df_inbox
  * @brief Per-edge or per-node inbox wrapper.
@@ -82,6 +89,38 @@ struct ol_df_graph {
     size_t edge_count;
 };
 
+/**
+ * @struct df_stage
+ * @brief Emits buffered for one edge while a worker processes a batch.
+ */
+typedef struct df_stage {
+    ol_df_edge_t *edge;
+    size_t        n;
+    void         *items[DF_BATCH];
+} df_stage_t;
+
+/**
+ * @struct df_emit_batch
+ * @brief Per-worker emit staging, flushed with ol_channel_send_many.
+ */
+typedef struct df_emit_batch {
+    size_t     used;
+    df_stage_t slots[DF_STAGE_EDGES];
+} df_emit_batch_t;
+
+/**
+ * @struct df_wait_set
+ * @brief Per-worker select cases for idle waits, grown only when the graph grows.
+ */
+typedef struct df_wait_set {
+    ol_chan_case_t *cases;
+    ol_df_node_t  **targets;
+    size_t          cap;
+} df_wait_set_t;
+
+/* Set while a worker runs handlers; NULL means emit sends immediately */
+static OL_THREAD_LOCAL df_emit_batch_t *tl_emit_batch = NULL;
+
 /* -------------------- Utilities -------------------- */
 
 /**
@@ -151,6 +190,53 @@ static void graph_remove_node(ol_df_graph_t *g, ol_df_node_t *n) {
  * @param out_item Item to emit (ownership semantics follow ol_df_emit)
  * @return int status (0 on success)
  */
+/**
+ * @brief Send a run of items to an edge; items the channel refused are
+ *        released with the edge destructor (same policy as a single send).
+ */
+static void df_edge_send_many(ol_df_edge_t *e, void *const *items, size_t n) {
+    size_t done = 0;
+    while (done < n) {
+        int r = ol_channel_send_many(e->inbox.ch, items + done, n - done, 0);
+        if (r <= 0) break;
+        done += (size_t)r;
+    }
+    if (e->inbox.dtor) {
+        for (; done < n; done++) e->inbox.dtor(items[done]);
+    }
+}
+
+static void df_stage_flush(df_stage_t *st) {
+    if (st->n > 0) df_edge_send_many(st->edge, st->items, st->n);
+    st->n = 0;
+}
+
+static void df_emit_batch_flush(df_emit_batch_t *b) {
+    for (size_t i = 0; i < b->used; i++) {
+        df_stage_flush(&b->slots[i]);
+        b->slots[i].edge = NULL;
+    }
+    b->used = 0;
+}
+
+/**
+ * @brief Buffer one emitted item for an edge, flushing when a slot fills.
+ */
+static void df_emit_stage(df_emit_batch_t *b, ol_df_edge_t *e, void *item) {
+    df_stage_t *st = NULL;
+    for (size_t i = 0; i < b->used; i++) {
+        if (b->slots[i].edge == e) { st = &b->slots[i]; break; }
+    }
+    if (!st) {
+        if (b->used == DF_STAGE_EDGES) df_emit_batch_flush(b);
+        st = &b->slots[b->used++];
+        st->edge = e;
+        st->n = 0;
+    }
+    st->items[st->n++] = item;
+    if (st->n == DF_BATCH) df_stage_flush(st);
+}
+
 static int emit_impl(void *ctx, int port_index, void *out_item) {
     ol_df_node_t *from = (ol_df_node_t*)ctx;
     return ol_df_emit(from, port_index, out_item);
@@ -158,21 +244,92 @@ static int emit_impl(void *ctx, int port_index, void *out_item) {
 
 /* -------------------- Worker function -------------------- */
 
+/**
+ * @brief Run a node's handler over a batch of inbound items.
+ *
+ * Emits made by the handler are staged per edge and flushed once the batch
+ * is done, so each downstream channel sees one send_many per batch.
+ */
+static void df_run_batch(ol_df_node_t *n, void **items, int count) {
+    df_emit_batch_t batch;
+    batch.used = 0;
+
+    df_emit_batch_t *outer = tl_emit_batch;
+    tl_emit_batch = &batch;
+    for (int i = 0; i < count; i++) {
+        if (n->handler) {
+            (void)n->handler(n->user_ctx, items[i], emit_impl, n);
+        }
+        /* Responsibility for freeing/forwarding item is with handler or inbox destructor semantics */
+    }
+    tl_emit_batch = outer;
+
+    df_emit_batch_flush(&batch);
+}
+
+/**
+ * @brief Block an idle worker until any inbox has an item (or a short timeout).
+ *
+ * Uses ol_channel_select over every node and edge inbox; the item that wakes
+ * the worker is processed right away. The timeout bounds how long a stopped
+ * graph keeps this worker alive. The case arrays live in the worker's wait
+ * set so an idle pass does not allocate.
+ */
+static void df_wait_for_work(ol_df_graph_t *g, df_wait_set_t *ws) {
+    size_t count = 0;
+    for (ol_df_node_t *n = g->nodes_head; n; n = n->next) count++;
+    for (ol_df_edge_t *e = g->edges_head; e; e = e->next) count++;
+    if (count == 0) count = 1; /* still honour the timeout below */
+
+    if (count > ws->cap) {
+        ol_chan_case_t *cases = (ol_chan_case_t*)realloc(ws->cases, count * sizeof(ol_chan_case_t));
+        if (!cases) return;
+        ws->cases = cases;
+        ol_df_node_t **targets = (ol_df_node_t**)realloc(ws->targets, count * sizeof(ol_df_node_t*));
+        if (!targets) return;
+        ws->targets = targets;
+        ws->cap = count;
+    }
+
+    ol_chan_case_t *cases = ws->cases;
+    ol_df_node_t **targets = ws->targets;
+    memset(cases, 0, count * sizeof(ol_chan_case_t));
+
+    size_t i = 0;
+    for (ol_df_node_t *n = g->nodes_head; n && i < count; n = n->next, i++) {
+        cases[i].ch = n->self_inbox.ch;
+        cases[i].op = OL_CHAN_SELECT_RECV;
+        targets[i] = n;
+    }
+    for (ol_df_edge_t *e = g->edges_head; e && i < count; e = e->next, i++) {
+        cases[i].ch = e->inbox.ch;
+        cases[i].op = OL_CHAN_SELECT_RECV;
+        targets[i] = e->to;
+    }
+
+    int idx = ol_channel_select(cases, count, ol_monotonic_now_ns() + DF_IDLE_WAIT_NS);
+    if (idx >= 0 && cases[idx].result == 1) {
+        df_run_batch(targets[idx], &cases[idx].item, 1);
+    }
+}
+
 /**
  * @brief Worker loop executed on pool threads.
  *
  * Behavior:
- * - While graph running, iterate nodes and try to pull one item from each node's self_inbox.
- * - If an item is obtained, invoke node->handler(user_ctx, item, emit_impl, node).
- * - This simple implementation uses ol_channel_try_recv to avoid blocking a worker on one node.
+ * - While graph running, iterate nodes and pull up to DF_BATCH items from each node's self_inbox,
+ *   then do the same for each edge inbox on behalf of the edge's destination node.
+ * - Items are processed via node->handler(user_ctx, item, emit_impl, node).
+ * - This simple implementation uses ol_channel_try_recv_many to avoid blocking a worker on one node.
  *
  * Notes:
- * - For production, consider a more efficient scheduling/wakeup mechanism to avoid spinning.
+ * - When a full pass finds nothing, the worker sleeps in df_wait_for_work instead of spinning.
  *
  * @param arg ol_df_graph_t* pointer
  */
 static void df_worker(void *arg) {
     ol_df_graph_t *g = (ol_df_graph_t*)arg;
+    df_wait_set_t ws = { NULL, NULL, 0 };
 
     for (;;) {
         /* Stop condition: graph not running */
@@ -185,27 +342,36 @@ static void df_worker(void *arg) {
         ol_df_node_t *n = g->nodes_head;
         bool did_work = false;
 
+        void *items[DF_BATCH];
+
         while (n) {
-            void *item = NULL;
-            int got = ol_channel_try_recv(n->self_inbox.ch, &item);
-            if (got == 1) {
+            int got = ol_channel_try_recv_many(n->self_inbox.ch, items, DF_BATCH);
+            if (got > 0) {
                 did_work = true;
-                /* Process item via node handler */
-                if (n->handler) {
-                    (void)n->handler(n->user_ctx, item, emit_impl, n);
-                }
-                /* Responsibility for freeing/forwarding item is with handler or inbox destructor semantics */
+                df_run_batch(n, items, got);
             }
-
-            /* Note: inbound edges feed into node->self_inbox; no per-edge recv here */
             n = n->next;
         }
 
-        /* If no work performed, yield briefly (could be improved with cond/wakeup) */
+        /* Edge inboxes carry emitted items to their destination node */
+        ol_df_edge_t *e = g->edges_head;
+        while (e) {
+            int got = ol_channel_try_recv_many(e->inbox.ch, items, DF_BATCH);
+            if (got > 0) {
+                did_work = true;
+                df_run_batch(e->to, items, got);
+            }
+            e = e->next;
+        }
+
+        /* Nothing ready: block on all inboxes at once instead of spinning */
         if (!did_work) {
-            /* Cooperative small pause: in a real implementation, use a condition or event to wait */
+            df_wait_for_work(g, &ws);
         }
     }
+
+    free(ws.cases);
+    free(ws.targets);
 }
 
 /* -------------------- Public API -------------------- */
@@ -466,6 +632,28 @@ int ol_df_push(ol_df_graph_t *g, ol_df_node_t *to, void *item) {
     return ol_channel_send(to->self_inbox.ch, item);
 }
 
+/**
+ * @brief Push a batch of items into a node's unified inbox.
+ *
+ * - One channel operation (and one receiver wakeup) per contiguous run.
+ *
+ * @param g Graph pointer
+ * @param to Destination node
+ * @param items Item pointers
+ * @param n Number of items
+ * @return int number of items pushed (items past it remain the caller's), -1 on error
+ */
+int ol_df_push_many(ol_df_graph_t *g, ol_df_node_t *to, void *const *items, size_t n) {
+    if (!g || !to || (!items && n > 0)) return -1;
+    size_t done = 0;
+    while (done < n) {
+        int r = ol_channel_send_many(to->self_inbox.ch, items + done, n - done, 0);
+        if (r <= 0) return done > 0 ? (int)done : -1;
+        done += (size_t)r;
+    }
+    return (int)done;
+}
+
 /**
  * @brief Emit an item from a node on a given output port.
  *
@@ -484,6 +672,11 @@ int ol_df_emit(ol_df_node_t *from, int port_index, void *item) {
     /* Fan out: send to each connected edge's inbox channel */
     ol_df_edge_t *e = from->outs[port_index];
     for (; e; e = e->next) {
+        if (tl_emit_batch) {
+            /* Inside a worker batch: coalesce into one send_many per edge */
+            df_emit_stage(tl_emit_batch, e, item);
+            continue;
+        }
         int r = ol_channel_send(e->inbox.ch, item);
         if (r < 0) {
             /* If edge owns items and send failed due to closed channel, free */
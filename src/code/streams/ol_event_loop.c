@@ -16,6 +16,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
+#include <stdatomic.h>
 
 #if defined(OL_PLATFORM_WINDOWS)
     #include <winsock2.h>
@@ -23,17 +24,94 @@
 #else
     #include <unistd.h>
     #include <fcntl.h>
+    #include <sched.h>
+#endif
+
+#if defined(OL_PLATFORM_LINUX)
+    #include <sys/eventfd.h>
+    #define OL_WAKE_EVENTFD 1
 #endif
 
 /* --------------------------------------------------------------------------
  * Internal structures
  * -------------------------------------------------------------------------- */
 
+/** @brief Fan-out of the timer heap (4-ary keeps siblings in one cache line) */
+#define OL_TIMER_HEAP_ARITY 4
+
+/** @brief heap_index value for entries that are not queued in the timer heap */
+#define OL_TIMER_NOT_QUEUED ((size_t)-1)
+
+/** @brief Event slots per storage chunk (log2) */
+#define OL_EVENT_CHUNK_SHIFT 8
+#define OL_EVENT_CHUNK_SIZE  ((size_t)1 << OL_EVENT_CHUNK_SHIFT)
+#define OL_EVENT_CHUNK_MASK  (OL_EVENT_CHUNK_SIZE - 1)
+
+/** @brief End-of-list marker for the free slot list */
+#define OL_EVENT_NO_SLOT ((uint32_t)-1)
+
+/*
+ * Event IDs encode the slot index (plus one, so 0 stays reserved for the
+ * wake pipe) in the low 32 bits and the slot generation in the high 32 bits.
+ * Freeing a slot bumps its generation, so stale IDs never match a reused slot.
+ */
+#define OL_EVENT_ID(index, gen) \
+    (((uint64_t)(gen) << 32) | (uint64_t)((uint32_t)(index) + 1u))
+#define OL_EVENT_ID_INDEX(id)   ((uint32_t)((id) & 0xFFFFFFFFu) - 1u)
+#define OL_EVENT_ID_GEN(id)     ((uint32_t)((id) >> 32))
+
+/** @brief Maximum posted tasks run per loop iteration */
+#define OL_LOOP_POST_BATCH 1024
+
+/**
+ * @brief Task posted to the loop thread (intrusive MPSC queue node)
+ */
+typedef struct ol_loop_task {
+    _Atomic(struct ol_loop_task*) next; /**< Next task in queue */
+    ol_callback_fn fn;                  /**< Task function */
+    void *arg;                          /**< Task argument */
+    bool heap;                          /**< Freed after running (else embedded) */
+} ol_loop_task_t;
+
+/** @brief Channel registration state bits */
+#define OL_CHAN_REG_QUEUED 0x1u /**< Delivery task is in the post queue */
+#define OL_CHAN_REG_RERUN  0x2u /**< Hook fired again while queued */
+#define OL_CHAN_REG_DEAD   0x4u /**< Unregistered; last owner frees */
+
+/**
+ * @brief Channel watched by the loop (readiness hook context)
+ *
+ * The channel's one-shot hook enqueues the embedded task, which runs the
+ * callback on the loop thread and re-arms. Queued state and unregistration
+ * race through the state bits so exactly one side frees the registration.
+ */
+typedef struct ol_chan_reg {
+    ol_event_loop_t *loop;      /**< Owning loop */
+    uint64_t id;                /**< Event ID of the registration */
+    ol_channel_t *channel;      /**< Watched channel */
+    uint32_t mask;              /**< OL_POLL_IN / OL_POLL_OUT interest */
+    atomic_uint state;          /**< OL_CHAN_REG_* bits */
+    atomic_uint ready;          /**< Events reported by the hook */
+    ol_loop_task_t task;        /**< Embedded delivery task */
+} ol_chan_reg_t;
+
+/**
+ * @brief In-flight completion request (its address is the poller tag)
+ */
+typedef struct ol_io_request {
+    struct ol_io_request *prev;         /**< Previous in-flight request */
+    struct ol_io_request *next;         /**< Next in-flight request */
+    ol_io_complete_cb callback;         /**< Completion callback */
+    void *user_data;                    /**< User data for callback */
+} ol_io_request_t;
+
 /**
  * @brief Registered event entry
  */
 typedef struct {
     uint64_t id;                /**< Unique event identifier */
+    uint32_t generation;        /**< Slot generation (bumped on free) */
+    uint32_t next_free;         /**< Next free slot (inactive entries) */
     ol_ev_type_t type;          /**< Event type (I/O or timer) */
     
     /* I/O fields */
@@ -43,6 +121,10 @@ typedef struct {
     /* Timer fields */
     int64_t when_ns;            /**< Absolute deadline (timer events) */
     int64_t periodic_ns;        /**< Periodic interval (0 for one-shot) */
+    size_t heap_index;          /**< Position in timer heap (timers only) */
+    
+    /* Channel fields */
+    ol_chan_reg_t *chan_reg;    /**< Channel registration (channel events) */
     
     /* Common fields */
     ol_event_cb callback;       /**< User callback function */
@@ -59,23 +141,41 @@ struct ol_event_loop {
     bool should_stop;           /**< Stop request flag */
     
     /* Wake mechanism */
-    int wake_read_fd;           /**< Read end of wake pipe */
-    int wake_write_fd;          /**< Write end of wake pipe */
+    int wake_read_fd;           /**< Read end of wake pipe (eventfd on Linux) */
+    int wake_write_fd;          /**< Write end of wake pipe (same eventfd on Linux) */
+    atomic_bool wake_pending;   /**< Wake already signaled, not yet drained */
+    
+    /* Channel registration whose callback is running (0 = none); a
+     * cross-thread unregister waits for it to clear */
+    _Atomic(uint64_t) chan_delivering;
+    
+    /* Cross-thread task queue (Vyukov MPSC, consumed by the loop thread) */
+    _Atomic(ol_loop_task_t*) post_tail; /**< Producer end */
+    ol_loop_task_t *post_head;  /**< Consumer end */
+    ol_loop_task_t post_stub;   /**< Stub node keeping the queue non-empty */
     
     /* Poller instance */
     ol_poller_t *poller;        /**< I/O poller backend */
     
-    /* Event registry */
-    ol_event_entry_t *events;   /**< Dynamic array of events */
+    /* Event registry (generation-tagged slot map) */
+    ol_event_entry_t **chunks;  /**< Fixed-size slot chunks (never moved) */
+    size_t chunk_count;         /**< Number of allocated chunks */
+    size_t chunk_capacity;      /**< Capacity of the chunk table */
+    size_t slot_count;          /**< Slots handed out so far (high-water mark) */
+    uint32_t free_head;         /**< Head of the free slot list */
     size_t event_count;         /**< Number of active entries */
-    size_t event_capacity;      /**< Allocated capacity */
+    
+    /* Timer heap */
+    size_t *timer_heap;         /**< 4-ary min-heap of timer slot indices */
+    size_t timer_count;         /**< Number of armed timers */
+    size_t timer_capacity;      /**< Allocated heap capacity */
+    
+    /* Completion requests submitted to the poller */
+    ol_io_request_t *inflight;  /**< In-flight request list (under mutex) */
     
     /* Synchronization */
     ol_mutex_t mutex;           /**< Protects event registry */
     
-    /* ID generation */
-    uint64_t next_event_id;     /**< Next available event ID */
-    
     /* Statistics */
     uint64_t iteration_count;   /**< Number of loop iterations */
     uint64_t event_dispatch_count; /**< Number of events dispatched */
@@ -87,9 +187,21 @@ struct ol_event_loop {
 
 /**
  * @brief Create a wake pipe (cross-platform)
+ *
+ * On Linux a single non-blocking eventfd serves as both ends.
  */
 static int ol_create_wake_pipe(int fds[2]) {
-#if defined(OL_PLATFORM_WINDOWS)
+#if defined(OL_WAKE_EVENTFD)
+    int efd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (efd < 0) {
+        return OL_ERROR;
+    }
+    
+    fds[0] = efd;
+    fds[1] = efd;
+    
+    return OL_SUCCESS;
+#elif defined(OL_PLATFORM_WINDOWS)
     /* Windows: use socketpair or pipe from Winsock */
     SOCKET sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
     if (sock == INVALID_SOCKET) {
@@ -176,98 +288,369 @@ static void ol_close_fd(int fd) {
     }
 }
 
+/**
+ * @brief Close the wake pipe ends (once each, they may share an eventfd)
+ */
+static void ol_close_wake_pipe(ol_event_loop_t *loop) {
+    ol_close_fd(loop->wake_read_fd);
+    if (loop->wake_write_fd != loop->wake_read_fd) {
+        ol_close_fd(loop->wake_write_fd);
+    }
+}
+
 /**
  * @brief Drain wake pipe
  */
 static void ol_drain_wake_pipe(int fd) {
+#if defined(OL_WAKE_EVENTFD)
+    uint64_t counter;
+    while (read(fd, &counter, sizeof(counter)) > 0) {
+        /* A single read resets the counter */
+    }
+#elif defined(OL_PLATFORM_WINDOWS)
     char buffer[256];
-#if defined(OL_PLATFORM_WINDOWS)
     while (recv(fd, buffer, sizeof(buffer), 0) > 0) {
         /* Keep draining */
     }
 #else
+    char buffer[256];
     while (read(fd, buffer, sizeof(buffer)) > 0) {
         /* Keep draining */
     }
 #endif
 }
 
+/* --------------------------------------------------------------------------
+ * Cross-thread task queue
+ *
+ * Intrusive Vyukov MPSC queue: producers link a node with one atomic
+ * exchange and never take loop->mutex; only the loop thread pops.
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @brief Initialize the task queue around its stub node
+ */
+static void ol_post_queue_init(ol_event_loop_t *loop) {
+    atomic_init(&loop->post_stub.next, NULL);
+    loop->post_head = &loop->post_stub;
+    atomic_init(&loop->post_tail, &loop->post_stub);
+}
+
+/**
+ * @brief Append a task (any thread)
+ */
+static void ol_post_queue_push(ol_event_loop_t *loop, ol_loop_task_t *task) {
+    atomic_store_explicit(&task->next, NULL, memory_order_relaxed);
+    ol_loop_task_t *prev = atomic_exchange_explicit(&loop->post_tail, task,
+                                                    memory_order_acq_rel);
+    atomic_store_explicit(&prev->next, task, memory_order_release);
+}
+
+/**
+ * @brief Pop the oldest task (loop thread only)
+ *
+ * @return Task, or NULL if the queue is empty or a producer is mid-push
+ *         (that producer wakes the loop once its push is visible)
+ */
+static ol_loop_task_t* ol_post_queue_pop(ol_event_loop_t *loop) {
+    ol_loop_task_t *head = loop->post_head;
+    ol_loop_task_t *next = atomic_load_explicit(&head->next, memory_order_acquire);
+    
+    if (head == &loop->post_stub) {
+        if (!next) {
+            return NULL;
+        }
+        loop->post_head = next;
+        head = next;
+        next = atomic_load_explicit(&head->next, memory_order_acquire);
+    }
+    
+    if (next) {
+        loop->post_head = next;
+        return head;
+    }
+    
+    if (head != atomic_load_explicit(&loop->post_tail, memory_order_acquire)) {
+        return NULL;
+    }
+    
+    /* Re-insert the stub so the last real node can be handed out */
+    ol_post_queue_push(loop, &loop->post_stub);
+    
+    next = atomic_load_explicit(&head->next, memory_order_acquire);
+    if (next) {
+        loop->post_head = next;
+        return head;
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief Run posted tasks (bounded per iteration so tasks that post
+ *        further tasks cannot starve I/O)
+ */
+static void ol_run_posted_tasks(ol_event_loop_t *loop) {
+    for (int i = 0; i < OL_LOOP_POST_BATCH; i++) {
+        ol_loop_task_t *task = ol_post_queue_pop(loop);
+        if (!task) {
+            return;
+        }
+        
+        /* Embedded tasks may be freed or re-queued by their own fn */
+        bool heap = task->heap;
+        task->fn(task->arg);
+        if (heap) {
+            free(task);
+        }
+    }
+    
+    /* Batch exhausted: make sure the next poll returns immediately */
+    ol_event_loop_wake(loop);
+}
+
+/**
+ * @brief Get the entry stored in a slot
+ */
+static inline ol_event_entry_t* ol_slot_at(const ol_event_loop_t *loop,
+                                           size_t index) {
+    return &loop->chunks[index >> OL_EVENT_CHUNK_SHIFT][index & OL_EVENT_CHUNK_MASK];
+}
+
 /**
  * @brief Find event by ID
+ *
+ * O(1): the ID carries the slot index, and the generation check rejects
+ * IDs whose registration has already been removed.
  */
 static ol_event_entry_t* ol_find_event(ol_event_loop_t *loop, uint64_t id) {
     if (!loop || id == 0) {
         return NULL;
     }
     
-    for (size_t i = 0; i < loop->event_count; i++) {
-        if (loop->events[i].active && loop->events[i].id == id) {
-            return &loop->events[i];
-        }
+    uint32_t index = OL_EVENT_ID_INDEX(id);
+    if (index >= loop->slot_count) {
+        return NULL;
     }
     
-    return NULL;
+    ol_event_entry_t *entry = ol_slot_at(loop, index);
+    if (!entry->active || entry->generation != OL_EVENT_ID_GEN(id)) {
+        return NULL;
+    }
+    
+    return entry;
 }
 
 /**
- * @brief Ensure event array has enough capacity
+ * @brief Take a free slot, growing storage by one chunk if needed
+ *
+ * Chunks are never reallocated, so entry pointers stay valid for the
+ * lifetime of the loop.
+ *
+ * @return Slot index, or OL_EVENT_NO_SLOT on allocation failure
  */
-static int ol_ensure_event_capacity(ol_event_loop_t *loop, size_t min_capacity) {
-    if (min_capacity <= loop->event_capacity) {
-        return OL_SUCCESS;
+static uint32_t ol_alloc_slot(ol_event_loop_t *loop) {
+    if (loop->free_head != OL_EVENT_NO_SLOT) {
+        uint32_t index = loop->free_head;
+        loop->free_head = ol_slot_at(loop, index)->next_free;
+        return index;
     }
     
-    size_t new_capacity = loop->event_capacity * 2;
-    if (new_capacity < min_capacity) {
-        new_capacity = min_capacity;
-    }
-    if (new_capacity < 16) {
-        new_capacity = 16;
+    if (loop->slot_count >= (size_t)OL_EVENT_NO_SLOT) {
+        return OL_EVENT_NO_SLOT;
     }
     
-    ol_event_entry_t *new_events = (ol_event_entry_t*)realloc(
-        loop->events, sizeof(ol_event_entry_t) * new_capacity);
-    if (!new_events) {
-        return OL_ERROR;
+    if (loop->slot_count == loop->chunk_count * OL_EVENT_CHUNK_SIZE) {
+        if (loop->chunk_count == loop->chunk_capacity) {
+            size_t new_capacity = loop->chunk_capacity ? loop->chunk_capacity * 2 : 4;
+            ol_event_entry_t **new_chunks = (ol_event_entry_t**)realloc(
+                loop->chunks, sizeof(ol_event_entry_t*) * new_capacity);
+            if (!new_chunks) {
+                return OL_EVENT_NO_SLOT;
+            }
+            loop->chunks = new_chunks;
+            loop->chunk_capacity = new_capacity;
+        }
+        
+        ol_event_entry_t *chunk = (ol_event_entry_t*)calloc(
+            OL_EVENT_CHUNK_SIZE, sizeof(ol_event_entry_t));
+        if (!chunk) {
+            return OL_EVENT_NO_SLOT;
+        }
+        loop->chunks[loop->chunk_count++] = chunk;
     }
     
-    /* Initialize new entries */
-    for (size_t i = loop->event_capacity; i < new_capacity; i++) {
-        memset(&new_events[i], 0, sizeof(ol_event_entry_t));
+    uint32_t index = (uint32_t)loop->slot_count++;
+    ol_slot_at(loop, index)->generation = 1;
+    return index;
+}
+
+/**
+ * @brief Claim a slot and initialize its entry
+ *
+ * @return Entry (with id set), or NULL on allocation failure
+ */
+static ol_event_entry_t* ol_claim_entry(ol_event_loop_t *loop,
+                                        ol_ev_type_t type,
+                                        ol_event_cb cb,
+                                        void *user_data) {
+    uint32_t index = ol_alloc_slot(loop);
+    if (index == OL_EVENT_NO_SLOT) {
+        return NULL;
     }
     
-    loop->events = new_events;
-    loop->event_capacity = new_capacity;
+    ol_event_entry_t *entry = ol_slot_at(loop, index);
+    uint32_t generation = entry->generation;
     
-    return OL_SUCCESS;
+    memset(entry, 0, sizeof(ol_event_entry_t));
+    entry->generation = generation;
+    entry->next_free = OL_EVENT_NO_SLOT;
+    entry->id = OL_EVENT_ID(index, generation);
+    entry->type = type;
+    entry->callback = cb;
+    entry->user_data = user_data;
+    entry->heap_index = OL_TIMER_NOT_QUEUED;
+    entry->active = true;
+    
+    loop->event_count++;
+    return entry;
 }
 
 /**
- * @brief Compact event array (remove inactive entries)
+ * @brief Return an entry's slot to the free list and invalidate its ID
  */
-static void ol_compact_events(ol_event_loop_t *loop) {
-    size_t write_index = 0;
+static void ol_release_entry(ol_event_loop_t *loop, ol_event_entry_t *entry) {
+    uint32_t index = OL_EVENT_ID_INDEX(entry->id);
     
-    for (size_t read_index = 0; read_index < loop->event_count; read_index++) {
-        if (loop->events[read_index].active) {
-            if (write_index != read_index) {
-                loop->events[write_index] = loop->events[read_index];
-            }
-            write_index++;
+    entry->active = false;
+    entry->generation++;
+    entry->next_free = loop->free_head;
+    loop->free_head = index;
+    loop->event_count--;
+}
+
+/* --------------------------------------------------------------------------
+ * Timer heap
+ *
+ * Armed timers live in a 4-ary min-heap keyed by deadline. The heap stores
+ * event slot indices and every timer entry records its own heap
+ * position, so the earliest deadline is read in O(1), arming and cancelling
+ * cost O(log n), and expiry only touches timers that actually fire.
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @brief Deadline of the timer at a heap position
+ */
+static inline int64_t ol_timer_key(const ol_event_loop_t *loop, size_t pos) {
+    return ol_slot_at(loop, loop->timer_heap[pos])->when_ns;
+}
+
+/**
+ * @brief Store an entry index at a heap position and back-link it
+ */
+static inline void ol_timer_heap_place(ol_event_loop_t *loop,
+                                       size_t pos,
+                                       size_t entry_index) {
+    loop->timer_heap[pos] = entry_index;
+    ol_slot_at(loop, entry_index)->heap_index = pos;
+}
+
+/**
+ * @brief Move the timer at a heap position towards the root
+ */
+static void ol_timer_sift_up(ol_event_loop_t *loop, size_t pos) {
+    size_t entry_index = loop->timer_heap[pos];
+    int64_t when = ol_slot_at(loop, entry_index)->when_ns;
+    
+    while (pos > 0) {
+        size_t parent = (pos - 1) / OL_TIMER_HEAP_ARITY;
+        if (ol_timer_key(loop, parent) <= when) {
+            break;
         }
+        ol_timer_heap_place(loop, pos, loop->timer_heap[parent]);
+        pos = parent;
     }
     
-    loop->event_count = write_index;
+    ol_timer_heap_place(loop, pos, entry_index);
+}
+
+/**
+ * @brief Move the timer at a heap position towards the leaves
+ */
+static void ol_timer_sift_down(ol_event_loop_t *loop, size_t pos) {
+    size_t entry_index = loop->timer_heap[pos];
+    int64_t when = ol_slot_at(loop, entry_index)->when_ns;
+    
+    for (;;) {
+        size_t first = pos * OL_TIMER_HEAP_ARITY + 1;
+        if (first >= loop->timer_count) {
+            break;
+        }
+        
+        size_t last = first + OL_TIMER_HEAP_ARITY;
+        if (last > loop->timer_count) {
+            last = loop->timer_count;
+        }
+        
+        size_t best = first;
+        for (size_t child = first + 1; child < last; child++) {
+            if (ol_timer_key(loop, child) < ol_timer_key(loop, best)) {
+                best = child;
+            }
+        }
+        
+        if (ol_timer_key(loop, best) >= when) {
+            break;
+        }
+        
+        ol_timer_heap_place(loop, pos, loop->timer_heap[best]);
+        pos = best;
+    }
     
-    /* Shrink array if it's mostly empty */
-    if (loop->event_capacity > 64 && loop->event_count < loop->event_capacity / 4) {
-        size_t new_capacity = loop->event_capacity / 2;
-        ol_event_entry_t *new_events = (ol_event_entry_t*)realloc(
-            loop->events, sizeof(ol_event_entry_t) * new_capacity);
-        if (new_events) {
-            loop->events = new_events;
-            loop->event_capacity = new_capacity;
+    ol_timer_heap_place(loop, pos, entry_index);
+}
+
+/**
+ * @brief Insert a timer entry into the heap
+ */
+static int ol_timer_heap_push(ol_event_loop_t *loop, size_t entry_index) {
+    if (loop->timer_count == loop->timer_capacity) {
+        size_t new_capacity = loop->timer_capacity ? loop->timer_capacity * 2 : 16;
+        size_t *new_heap = (size_t*)realloc(
+            loop->timer_heap, sizeof(size_t) * new_capacity);
+        if (!new_heap) {
+            return OL_ERROR;
         }
+        loop->timer_heap = new_heap;
+        loop->timer_capacity = new_capacity;
+    }
+    
+    size_t pos = loop->timer_count++;
+    loop->timer_heap[pos] = entry_index;
+    ol_timer_sift_up(loop, pos);
+    
+    return OL_SUCCESS;
+}
+
+/**
+ * @brief Remove the timer at a heap position
+ */
+static void ol_timer_heap_remove(ol_event_loop_t *loop, size_t pos) {
+    size_t last = --loop->timer_count;
+    
+    ol_slot_at(loop, loop->timer_heap[pos])->heap_index = OL_TIMER_NOT_QUEUED;
+    
+    if (pos == last) {
+        return;
+    }
+    
+    ol_timer_heap_place(loop, pos, loop->timer_heap[last]);
+    
+    if (pos > 0 &&
+        ol_timer_key(loop, pos) < ol_timer_key(loop, (pos - 1) / OL_TIMER_HEAP_ARITY)) {
+        ol_timer_sift_up(loop, pos);
+    } else {
+        ol_timer_sift_down(loop, pos);
     }
 }
 
@@ -277,58 +660,221 @@ static void ol_compact_events(ol_event_loop_t *loop) {
 static int64_t ol_next_timer_deadline(ol_event_loop_t *loop) {
     int64_t next_deadline = 0; /* 0 means no timers */
     
-    for (size_t i = 0; i < loop->event_count; i++) {
-        ol_event_entry_t *entry = &loop->events[i];
-        if (!entry->active || entry->type != OL_EV_TIMER) {
-            continue;
-        }
-        
-        if (next_deadline == 0 || entry->when_ns < next_deadline) {
-            next_deadline = entry->when_ns;
-        }
+    ol_mutex_lock(&loop->mutex);
+    if (loop->timer_count > 0) {
+        next_deadline = ol_timer_key(loop, 0);
     }
+    ol_mutex_unlock(&loop->mutex);
     
     return next_deadline;
 }
 
 /**
  * @brief Process expired timers
+ *
+ * Expired timers are popped from the heap root until the earliest deadline
+ * lies in the future. Callbacks run without the registry lock held so they
+ * may register or unregister events themselves.
  */
 static void ol_process_timers(ol_event_loop_t *loop) {
     int64_t now = ol_monotonic_now_ns();
     
-    for (size_t i = 0; i < loop->event_count; i++) {
-        ol_event_entry_t *entry = &loop->events[i];
+    ol_mutex_lock(&loop->mutex);
+    
+    while (loop->timer_count > 0 && ol_timer_key(loop, 0) <= now) {
+        ol_event_entry_t *entry = ol_slot_at(loop, loop->timer_heap[0]);
+        ol_event_cb callback = entry->callback;
+        void *user_data = entry->user_data;
         
-        if (!entry->active || entry->type != OL_EV_TIMER) {
-            continue;
+        if (entry->periodic_ns > 0) {
+            /* Reschedule, skipping missed periods */
+            entry->when_ns += entry->periodic_ns;
+            if (now >= entry->when_ns) {
+                int64_t missed = (now - entry->when_ns) / entry->periodic_ns + 1;
+                entry->when_ns += missed * entry->periodic_ns;
+            }
+            ol_timer_sift_down(loop, 0);
+        } else {
+            /* One-shot timer: dequeue and free its slot */
+            ol_timer_heap_remove(loop, 0);
+            ol_release_entry(loop, entry);
         }
         
-        if (now >= entry->when_ns) {
-            /* Timer expired */
+        loop->event_dispatch_count++;
+        
+        /* Invoke callback */
+        if (callback) {
+            ol_mutex_unlock(&loop->mutex);
+            callback(loop, OL_EV_TIMER, -1, user_data);
+            ol_mutex_lock(&loop->mutex);
+        }
+    }
+    
+    ol_mutex_unlock(&loop->mutex);
+}
+
+/* --------------------------------------------------------------------------
+ * Completion requests
+ * -------------------------------------------------------------------------- */
+
+/** @brief Loop currently running on this thread (skips self-wakes on submit) */
+static OL_THREAD_LOCAL ol_event_loop_t *tl_current_loop = NULL;
+
+static void ol_request_link(ol_event_loop_t *loop, ol_io_request_t *req) {
+    req->prev = NULL;
+    req->next = loop->inflight;
+    if (loop->inflight) {
+        loop->inflight->prev = req;
+    }
+    loop->inflight = req;
+}
+
+static void ol_request_unlink(ol_event_loop_t *loop, ol_io_request_t *req) {
+    if (req->prev) {
+        req->prev->next = req->next;
+    } else {
+        loop->inflight = req->next;
+    }
+    if (req->next) {
+        req->next->prev = req->prev;
+    }
+}
+
+/**
+ * @brief Deliver a completion harvested by the poller
+ */
+static void ol_dispatch_completion(ol_event_loop_t *loop,
+                                   const ol_poll_event_t *pev) {
+    ol_io_request_t *req = (ol_io_request_t*)(uintptr_t)pev->tag;
+    
+    ol_mutex_lock(&loop->mutex);
+    ol_request_unlink(loop, req);
+    ol_mutex_unlock(&loop->mutex);
+    
+    loop->event_dispatch_count++;
+    req->callback(loop, (int)pev->result, req->user_data);
+    free(req);
+}
+
+/* --------------------------------------------------------------------------
+ * Channel readiness
+ * -------------------------------------------------------------------------- */
+
+static uint32_t ol_chan_mask_to_events(uint32_t mask) {
+    return ((mask & OL_POLL_IN) ? OL_CHAN_EV_READ : 0) |
+           ((mask & OL_POLL_OUT) ? OL_CHAN_EV_WRITE : 0);
+}
+
+static uint32_t ol_chan_events_to_mask(uint32_t events) {
+    return ((events & OL_CHAN_EV_READ) ? OL_POLL_IN : 0) |
+           ((events & OL_CHAN_EV_WRITE) ? OL_POLL_OUT : 0);
+}
+
+/**
+ * @brief Channel hook: hand the readiness over to the loop thread
+ *
+ * Runs under the channel lock on whichever thread made the channel ready;
+ * only a lock-free queue push and a (coalesced) wake.
+ */
+static void ol_chan_reg_hook(ol_channel_t *ch, uint32_t events, void *ctx) {
+    (void)ch;
+    ol_chan_reg_t *reg = (ol_chan_reg_t*)ctx;
+    
+    atomic_fetch_or_explicit(&reg->ready, events, memory_order_relaxed);
+    
+    unsigned old = atomic_fetch_or_explicit(&reg->state, OL_CHAN_REG_QUEUED,
+                                            memory_order_acq_rel);
+    if (old & OL_CHAN_REG_QUEUED) {
+        /* Delivery task still running: it re-queues itself */
+        atomic_fetch_or_explicit(&reg->state, OL_CHAN_REG_RERUN,
+                                 memory_order_acq_rel);
+        return;
+    }
+    
+    ol_post_queue_push(reg->loop, &reg->task);
+    ol_event_loop_wake(reg->loop);
+}
+
+/**
+ * @brief Delivery task (loop thread): run the callback, then re-arm
+ */
+static void ol_chan_reg_deliver(void *arg) {
+    ol_chan_reg_t *reg = (ol_chan_reg_t*)arg;
+    ol_event_loop_t *loop = reg->loop;
+    
+    if (!(atomic_load_explicit(&reg->state, memory_order_acquire) & OL_CHAN_REG_DEAD)) {
+        ol_event_cb callback = NULL;
+        void *user_data = NULL;
+        
+        ol_mutex_lock(&loop->mutex);
+        ol_event_entry_t *entry = ol_find_event(loop, reg->id);
+        if (entry && entry->type == OL_EV_CHANNEL && entry->chan_reg == reg) {
+            callback = entry->callback;
+            user_data = entry->user_data;
+            atomic_store_explicit(&loop->chan_delivering, reg->id, memory_order_relaxed);
+        }
+        ol_mutex_unlock(&loop->mutex);
+        
+        /* A rerun can find the events already consumed: nothing to report */
+        uint32_t events = atomic_exchange_explicit(&reg->ready, 0, memory_order_relaxed);
+        if (callback && events) {
             loop->event_dispatch_count++;
-            
-            /* Invoke callback */
-            if (entry->callback) {
-                entry->callback(loop, OL_EV_TIMER, -1, entry->user_data);
-            }
-            
-            /* Reschedule if periodic */
-            if (entry->periodic_ns > 0) {
-                entry->when_ns += entry->periodic_ns;
-                /* Handle missed periods */
-                while (now >= entry->when_ns) {
-                    entry->when_ns += entry->periodic_ns;
-                }
-            } else {
-                /* One-shot timer: mark as inactive */
-                entry->active = false;
+            callback(loop, OL_EV_CHANNEL, (int)ol_chan_events_to_mask(events), user_data);
+        }
+        
+        /* One-shot hook: arm for the next transition (may fire right away,
+         * which only sets RERUN while we still hold QUEUED). Detach marks
+         * DEAD under loop->mutex, so holding it here keeps the channel
+         * alive until the re-arm is done. */
+        ol_mutex_lock(&loop->mutex);
+        if (!(atomic_load_explicit(&reg->state, memory_order_acquire) & OL_CHAN_REG_DEAD)) {
+            ol_channel_arm_ready(reg->channel, ol_chan_mask_to_events(reg->mask));
+        }
+        atomic_store_explicit(&loop->chan_delivering, 0, memory_order_release);
+        ol_mutex_unlock(&loop->mutex);
+    }
+    
+    unsigned state = atomic_load_explicit(&reg->state, memory_order_acquire);
+    for (;;) {
+        if (state & OL_CHAN_REG_DEAD) {
+            free(reg);
+            return;
+        }
+        if (state & OL_CHAN_REG_RERUN) {
+            if (atomic_compare_exchange_weak_explicit(&reg->state, &state,
+                                                      state & ~OL_CHAN_REG_RERUN,
+                                                      memory_order_acq_rel,
+                                                      memory_order_acquire)) {
+                ol_post_queue_push(loop, &reg->task);
+                ol_event_loop_wake(loop);
+                return;
             }
+            continue;
+        }
+        if (atomic_compare_exchange_weak_explicit(&reg->state, &state,
+                                                  state & ~OL_CHAN_REG_QUEUED,
+                                                  memory_order_acq_rel,
+                                                  memory_order_acquire)) {
+            return;
         }
     }
+}
+
+/**
+ * @brief Stop watching the channel and release the registration
+ *
+ * Once the hook is removed it cannot fire again; if a delivery task is
+ * still queued it frees the registration, otherwise we do. Caller holds
+ * loop->mutex, which the delivery task takes around its re-arm.
+ */
+static void ol_chan_reg_detach(ol_chan_reg_t *reg) {
+    ol_channel_set_ready_hook(reg->channel, NULL, NULL);
     
-    /* Compact after processing one-shot timers */
-    ol_compact_events(loop);
+    unsigned old = atomic_fetch_or_explicit(&reg->state, OL_CHAN_REG_DEAD,
+                                            memory_order_acq_rel);
+    if (!(old & OL_CHAN_REG_QUEUED)) {
+        free(reg);
+    }
 }
 
 /* --------------------------------------------------------------------------
@@ -336,6 +882,10 @@ static void ol_process_timers(ol_event_loop_t *loop) {
  * -------------------------------------------------------------------------- */
 
 ol_event_loop_t* ol_event_loop_create(void) {
+    return ol_event_loop_create_ex(OL_POLLER_BACKEND_DEFAULT);
+}
+
+ol_event_loop_t* ol_event_loop_create_ex(ol_poller_backend_t backend) {
     ol_event_loop_t *loop = (ol_event_loop_t*)calloc(1, sizeof(ol_event_loop_t));
     if (!loop) {
         return NULL;
@@ -348,13 +898,18 @@ ol_event_loop_t* ol_event_loop_create(void) {
     }
     
     /* Create poller */
-    loop->poller = ol_poller_create();
+    loop->poller = ol_poller_create_ex(backend);
     if (!loop->poller) {
         ol_mutex_destroy(&loop->mutex);
         free(loop);
         return NULL;
     }
     
+    /* Initialize cross-thread task queue */
+    ol_post_queue_init(loop);
+    atomic_init(&loop->wake_pending, false);
+    atomic_init(&loop->chan_delivering, 0);
+    
     /* Create wake pipe */
     int wake_fds[2];
     if (ol_create_wake_pipe(wake_fds) != OL_SUCCESS) {
@@ -370,22 +925,7 @@ ol_event_loop_t* ol_event_loop_create(void) {
     /* Register wake pipe with poller */
     if (ol_poller_add(loop->poller, loop->wake_read_fd, 
                       OL_POLL_IN, 0) != OL_SUCCESS) {
-        ol_close_fd(loop->wake_read_fd);
-        ol_close_fd(loop->wake_write_fd);
-        ol_poller_destroy(loop->poller);
-        ol_mutex_destroy(&loop->mutex);
-        free(loop);
-        return NULL;
-    }
-    
-    /* Initialize event array */
-    loop->event_capacity = 16;
-    loop->events = (ol_event_entry_t*)calloc(
-        loop->event_capacity, sizeof(ol_event_entry_t));
-    if (!loop->events) {
-        ol_poller_del(loop->poller, loop->wake_read_fd);
-        ol_close_fd(loop->wake_read_fd);
-        ol_close_fd(loop->wake_write_fd);
+        ol_close_wake_pipe(loop);
         ol_poller_destroy(loop->poller);
         ol_mutex_destroy(&loop->mutex);
         free(loop);
@@ -394,8 +934,16 @@ ol_event_loop_t* ol_event_loop_create(void) {
     
     loop->running = false;
     loop->should_stop = false;
+    loop->chunks = NULL;
+    loop->chunk_count = 0;
+    loop->chunk_capacity = 0;
+    loop->slot_count = 0;
+    loop->free_head = OL_EVENT_NO_SLOT;
     loop->event_count = 0;
-    loop->next_event_id = 1;
+    loop->timer_heap = NULL;
+    loop->timer_count = 0;
+    loop->timer_capacity = 0;
+    loop->inflight = NULL;
     loop->iteration_count = 0;
     loop->event_dispatch_count = 0;
     
@@ -413,24 +961,47 @@ void ol_event_loop_destroy(ol_event_loop_t *loop) {
         ol_event_loop_wake(loop);
     }
     
-    /* Unregister all I/O events */
-    for (size_t i = 0; i < loop->event_count; i++) {
-        ol_event_entry_t *entry = &loop->events[i];
+    /* Unregister all I/O events and detach watched channels */
+    for (size_t i = 0; i < loop->slot_count; i++) {
+        ol_event_entry_t *entry = ol_slot_at(loop, i);
         if (entry->active && entry->type == OL_EV_IO) {
             ol_poller_del(loop->poller, entry->fd);
+        } else if (entry->active && entry->type == OL_EV_CHANNEL) {
+            ol_chan_reg_detach(entry->chan_reg);
+        }
+    }
+    
+    /* Run tasks still queued so ownership handed over with them is released */
+    ol_loop_task_t *task;
+    while ((task = ol_post_queue_pop(loop)) != NULL) {
+        bool heap = task->heap;
+        task->fn(task->arg);
+        if (heap) {
+            free(task);
         }
     }
     
     /* Cleanup wake pipe */
     ol_poller_del(loop->poller, loop->wake_read_fd);
-    ol_close_fd(loop->wake_read_fd);
-    ol_close_fd(loop->wake_write_fd);
+    ol_close_wake_pipe(loop);
     
-    /* Destroy poller */
+    /* Destroy poller (tearing down the ring cancels in-flight operations) */
     ol_poller_destroy(loop->poller);
     
-    /* Free event array */
-    free(loop->events);
+    /* Release callers waiting on operations that will never complete */
+    while (loop->inflight) {
+        ol_io_request_t *req = loop->inflight;
+        loop->inflight = req->next;
+        req->callback(loop, -ECANCELED, req->user_data);
+        free(req);
+    }
+    
+    /* Free event slots and timer heap */
+    for (size_t i = 0; i < loop->chunk_count; i++) {
+        free(loop->chunks[i]);
+    }
+    free(loop->chunks);
+    free(loop->timer_heap);
     
     /* Destroy mutex */
     ol_mutex_destroy(&loop->mutex);
@@ -439,76 +1010,124 @@ void ol_event_loop_destroy(ol_event_loop_t *loop) {
     free(loop);
 }
 
-int ol_event_loop_run(ol_event_loop_t *loop) {
-    if (!loop) {
-        return OL_ERROR;
-    }
-    
-    loop->running = true;
-    loop->should_stop = false;
-    
+/**
+ * @brief Run one loop iteration: poll, dispatch I/O, timers, posted tasks
+ *
+ * The poll blocks until the next timer, or until limit_ns if that is
+ * earlier (0 = no limit). A wake or any I/O event ends the wait early.
+ */
+static int ol_event_loop_iterate(ol_event_loop_t *loop, int64_t limit_ns) {
     /* Pre-allocate poll event buffer */
     const int POLL_EVENT_CAPACITY = 64;
     ol_poll_event_t poll_events[POLL_EVENT_CAPACITY];
     
-    while (!loop->should_stop) {
-        loop->iteration_count++;
-        
-        /* Calculate next timer deadline */
-        int64_t next_timer_ns = ol_next_timer_deadline(loop);
-        ol_deadline_t deadline;
+    loop->iteration_count++;
+    
+    /* Calculate next timer deadline (0 = no timers: wait indefinitely) */
+    int64_t next_timer_ns = ol_next_timer_deadline(loop);
+    ol_deadline_t deadline;
+    
+    if (limit_ns > 0 && (next_timer_ns == 0 || limit_ns < next_timer_ns)) {
+        deadline.when_ns = limit_ns;
+    } else {
+        deadline.when_ns = next_timer_ns;
+    }
+    
+    /* Wait for I/O events */
+    int n_events = ol_poller_wait(loop->poller, deadline,
+                                 poll_events, POLL_EVENT_CAPACITY);
+    
+    if (n_events < 0) {
+        return OL_ERROR;
+    }
+    
+    /* Process I/O events */
+    for (int i = 0; i < n_events; i++) {
+        ol_poll_event_t *pev = &poll_events[i];
         
-        if (next_timer_ns == 0) {
-            /* No timers: wait indefinitely */
-            deadline.when_ns = 0;
-        } else {
-            deadline.when_ns = next_timer_ns;
+        /* Completed submission: the tag is the request itself */
+        if (pev->mask & OL_POLL_COMPLETE) {
+            ol_dispatch_completion(loop, pev);
+            continue;
         }
         
-        /* Wait for I/O events */
-        int n_events = ol_poller_wait(loop->poller, deadline,
-                                     poll_events, POLL_EVENT_CAPACITY);
-        
-        if (n_events < 0) {
-            /* Error occurred */
-            loop->running = false;
-            return OL_ERROR;
+        /* Check for wake event (tag 0 is reserved for wake pipe) */
+        if (pev->tag == 0) {
+            ol_drain_wake_pipe(loop->wake_read_fd);
+            /* Re-arm before draining posted tasks so later posts wake us */
+            atomic_store_explicit(&loop->wake_pending, false,
+                                  memory_order_seq_cst);
+            continue;
         }
         
-        /* Process I/O events */
-        for (int i = 0; i < n_events; i++) {
-            ol_poll_event_t *pev = &poll_events[i];
-            
-            /* Check for wake event (tag 0 is reserved for wake pipe) */
-            if (pev->tag == 0) {
-                ol_drain_wake_pipe(loop->wake_read_fd);
-                continue;
-            }
-            
-            /* Find and dispatch I/O event */
-            ol_mutex_lock(&loop->mutex);
-            ol_event_entry_t *entry = ol_find_event(loop, pev->tag);
-            ol_mutex_unlock(&loop->mutex);
-            
-            if (entry && entry->active && entry->type == OL_EV_IO) {
-                loop->event_dispatch_count++;
-                
-                if (entry->callback) {
-                    entry->callback(loop, OL_EV_IO, entry->fd, entry->user_data);
-                }
-            }
-        }
+        /* Find and dispatch I/O event (stale tags fail the generation check) */
+        ol_event_cb callback = NULL;
+        void *user_data = NULL;
+        int fd = -1;
         
-        /* Process timers */
         ol_mutex_lock(&loop->mutex);
-        ol_process_timers(loop);
+        ol_event_entry_t *entry = ol_find_event(loop, pev->tag);
+        if (entry && entry->type == OL_EV_IO) {
+            callback = entry->callback;
+            user_data = entry->user_data;
+            fd = entry->fd;
+        }
         ol_mutex_unlock(&loop->mutex);
+        
+        if (callback) {
+            loop->event_dispatch_count++;
+            callback(loop, OL_EV_IO, fd, user_data);
+        }
     }
     
-    loop->running = false;
+    /* Process timers */
+    ol_process_timers(loop);
+    
+    /* Run tasks posted from other threads */
+    ol_run_posted_tasks(loop);
+    
     return OL_SUCCESS;
 }
 
+int ol_event_loop_run(ol_event_loop_t *loop) {
+    if (!loop) {
+        return OL_ERROR;
+    }
+    
+    loop->running = true;
+    loop->should_stop = false;
+    
+    ol_event_loop_t *outer_loop = tl_current_loop;
+    tl_current_loop = loop;
+    
+    int rc = OL_SUCCESS;
+    while (!loop->should_stop) {
+        if (ol_event_loop_iterate(loop, 0) != OL_SUCCESS) {
+            rc = OL_ERROR;
+            break;
+        }
+    }
+    
+    tl_current_loop = outer_loop;
+    loop->running = false;
+    return rc;
+}
+
+int ol_event_loop_run_once(ol_event_loop_t *loop, int64_t deadline_ns) {
+    if (!loop) {
+        return OL_ERROR;
+    }
+    
+    /* May nest inside a callback of ol_event_loop_run() on this thread */
+    ol_event_loop_t *outer_loop = tl_current_loop;
+    tl_current_loop = loop;
+    
+    int rc = ol_event_loop_iterate(loop, deadline_ns);
+    
+    tl_current_loop = outer_loop;
+    return rc;
+}
+
 void ol_event_loop_stop(ol_event_loop_t *loop) {
     if (!loop) {
         return;
@@ -523,14 +1142,31 @@ int ol_event_loop_wake(ol_event_loop_t *loop) {
         return OL_ERROR;
     }
     
+    /* Coalesce: only the first waker since the last drain makes a syscall */
+    if (atomic_exchange_explicit(&loop->wake_pending, true,
+                                 memory_order_seq_cst)) {
+        return OL_SUCCESS;
+    }
+    
+#if defined(OL_WAKE_EVENTFD)
+    uint64_t one = 1;
+    if (write(loop->wake_write_fd, &one, sizeof(one)) != (ssize_t)sizeof(one) &&
+        errno != EAGAIN) {
+        atomic_store(&loop->wake_pending, false);
+        return OL_ERROR;
+    }
+#elif defined(OL_PLATFORM_WINDOWS)
     /* Write a byte to wake pipe */
     char byte = 1;
-#if defined(OL_PLATFORM_WINDOWS)
     if (send(loop->wake_write_fd, &byte, 1, 0) != 1) {
+        atomic_store(&loop->wake_pending, false);
         return OL_ERROR;
     }
 #else
-    if (write(loop->wake_write_fd, &byte, 1) != 1) {
+    /* Write a byte to wake pipe (a full pipe is already readable) */
+    char byte = 1;
+    if (write(loop->wake_write_fd, &byte, 1) != 1 && errno != EAGAIN) {
+        atomic_store(&loop->wake_pending, false);
         return OL_ERROR;
     }
 #endif
@@ -538,6 +1174,76 @@ int ol_event_loop_wake(ol_event_loop_t *loop) {
     return OL_SUCCESS;
 }
 
+int ol_event_loop_post(ol_event_loop_t *loop, ol_callback_fn fn, void *arg) {
+    if (!loop || !fn) {
+        return OL_ERROR;
+    }
+    
+    ol_loop_task_t *task = (ol_loop_task_t*)malloc(sizeof(ol_loop_task_t));
+    if (!task) {
+        return OL_NOMEM;
+    }
+    
+    task->fn = fn;
+    task->arg = arg;
+    task->heap = true;
+    
+    ol_post_queue_push(loop, task);
+    
+    return ol_event_loop_wake(loop);
+}
+
+bool ol_event_loop_has_completions(const ol_event_loop_t *loop) {
+    return loop && ol_poller_has_completions(loop->poller);
+}
+
+int ol_event_loop_submit(ol_event_loop_t *loop,
+                         ol_io_op_type_t op,
+                         int fd,
+                         void *buf,
+                         size_t len,
+                         ol_io_complete_cb cb,
+                         void *user_data) {
+    if (!loop || !cb || fd < 0) {
+        return OL_ERROR;
+    }
+    
+    if (!ol_poller_has_completions(loop->poller)) {
+        return OL_ERROR;
+    }
+    
+    ol_io_request_t *req = (ol_io_request_t*)malloc(sizeof(ol_io_request_t));
+    if (!req) {
+        return OL_NOMEM;
+    }
+    
+    req->callback = cb;
+    req->user_data = user_data;
+    
+    /* Link before queueing: the completion may be reaped immediately */
+    ol_mutex_lock(&loop->mutex);
+    ol_request_link(loop, req);
+    ol_mutex_unlock(&loop->mutex);
+    
+    int rc = ol_poller_submit(loop->poller, op, fd, buf, len,
+                              (uint64_t)(uintptr_t)req);
+    if (rc != OL_SUCCESS) {
+        ol_mutex_lock(&loop->mutex);
+        ol_request_unlink(loop, req);
+        ol_mutex_unlock(&loop->mutex);
+        free(req);
+        return rc;
+    }
+    
+    /* The loop flushes the batch when it next polls; only a loop blocked
+     * in another thread needs a nudge */
+    if (tl_current_loop != loop) {
+        return ol_event_loop_wake(loop);
+    }
+    
+    return OL_SUCCESS;
+}
+
 uint64_t ol_event_loop_register_io(ol_event_loop_t *loop,
                                    int fd,
                                    uint32_t mask,
@@ -549,37 +1255,79 @@ uint64_t ol_event_loop_register_io(ol_event_loop_t *loop,
     
     ol_mutex_lock(&loop->mutex);
     
-    /* Ensure capacity */
-    if (ol_ensure_event_capacity(loop, loop->event_count + 1) != OL_SUCCESS) {
+    /* Create event entry */
+    ol_event_entry_t *entry = ol_claim_entry(loop, OL_EV_IO, cb, user_data);
+    if (!entry) {
         ol_mutex_unlock(&loop->mutex);
         return 0;
     }
     
-    /* Generate ID */
-    uint64_t id = loop->next_event_id++;
-    if (id == 0) {
-        id = loop->next_event_id++; /* Skip 0 (reserved for wake pipe) */
-    }
+    entry->fd = fd;
+    entry->mask = mask;
+    uint64_t id = entry->id;
     
     /* Add to poller */
     if (ol_poller_add(loop->poller, fd, mask, id) != OL_SUCCESS) {
+        ol_release_entry(loop, entry);
         ol_mutex_unlock(&loop->mutex);
         return 0;
     }
     
-    /* Create event entry */
-    ol_event_entry_t *entry = &loop->events[loop->event_count++];
-    memset(entry, 0, sizeof(ol_event_entry_t));
+    ol_mutex_unlock(&loop->mutex);
+    return id;
+}
+
+uint64_t ol_event_loop_register_channel(ol_event_loop_t *loop,
+                                        ol_channel_t *ch,
+                                        uint32_t mask,
+                                        ol_event_cb cb,
+                                        void *user_data) {
+    if (!loop || !ch || !cb || !(mask & (OL_POLL_IN | OL_POLL_OUT))) {
+        return 0;
+    }
     
-    entry->id = id;
-    entry->type = OL_EV_IO;
-    entry->fd = fd;
-    entry->mask = mask;
-    entry->callback = cb;
-    entry->user_data = user_data;
-    entry->active = true;
+    ol_chan_reg_t *reg = (ol_chan_reg_t*)calloc(1, sizeof(ol_chan_reg_t));
+    if (!reg) {
+        return 0;
+    }
+    
+    reg->loop = loop;
+    reg->channel = ch;
+    reg->mask = mask & (OL_POLL_IN | OL_POLL_OUT);
+    atomic_init(&reg->state, 0);
+    atomic_init(&reg->ready, 0);
+    reg->task.fn = ol_chan_reg_deliver;
+    reg->task.arg = reg;
+    reg->task.heap = false;
+    
+    ol_mutex_lock(&loop->mutex);
+    
+    ol_event_entry_t *entry = ol_claim_entry(loop, OL_EV_CHANNEL, cb, user_data);
+    if (!entry) {
+        ol_mutex_unlock(&loop->mutex);
+        free(reg);
+        return 0;
+    }
+    
+    entry->fd = -1;
+    entry->mask = reg->mask;
+    entry->chan_reg = reg;
+    reg->id = entry->id;
+    uint64_t id = entry->id;
+    
+    /* A channel has a single hook: a second registration fails here */
+    if (ol_channel_set_ready_hook(ch, ol_chan_reg_hook, reg) != OL_SUCCESS) {
+        ol_release_entry(loop, entry);
+        ol_mutex_unlock(&loop->mutex);
+        free(reg);
+        return 0;
+    }
     
     ol_mutex_unlock(&loop->mutex);
+    
+    /* Reports immediately if the channel is already ready */
+    ol_channel_arm_ready(ch, ol_chan_mask_to_events(reg->mask));
+    
     return id;
 }
 
@@ -622,28 +1370,15 @@ uint64_t ol_event_loop_register_timer(ol_event_loop_t *loop,
     
     ol_mutex_lock(&loop->mutex);
     
-    /* Ensure capacity */
-    if (ol_ensure_event_capacity(loop, loop->event_count + 1) != OL_SUCCESS) {
+    /* Create event entry */
+    ol_event_entry_t *entry = ol_claim_entry(loop, OL_EV_TIMER, cb, user_data);
+    if (!entry) {
         ol_mutex_unlock(&loop->mutex);
         return 0;
     }
     
-    /* Generate ID */
-    uint64_t id = loop->next_event_id++;
-    if (id == 0) {
-        id = loop->next_event_id++;
-    }
-    
-    /* Create event entry */
-    ol_event_entry_t *entry = &loop->events[loop->event_count++];
-    memset(entry, 0, sizeof(ol_event_entry_t));
-    
-    entry->id = id;
-    entry->type = OL_EV_TIMER;
     entry->fd = -1;
-    entry->callback = cb;
-    entry->user_data = user_data;
-    entry->active = true;
+    uint64_t id = entry->id;
     
     /* Set timer values */
     if (deadline.when_ns <= 0) {
@@ -655,8 +1390,17 @@ uint64_t ol_event_loop_register_timer(ol_event_loop_t *loop,
     
     entry->periodic_ns = periodic_ns > 0 ? periodic_ns : 0;
     
-    /* Wake loop to recalculate timer deadline */
-    ol_event_loop_wake(loop);
+    /* Arm the timer */
+    if (ol_timer_heap_push(loop, OL_EVENT_ID_INDEX(id)) != OL_SUCCESS) {
+        ol_release_entry(loop, entry);
+        ol_mutex_unlock(&loop->mutex);
+        return 0;
+    }
+    
+    /* Wake loop to recalculate timer deadline if this is the new earliest */
+    if (entry->heap_index == 0) {
+        ol_event_loop_wake(loop);
+    }
     
     ol_mutex_unlock(&loop->mutex);
     return id;
@@ -675,21 +1419,35 @@ int ol_event_loop_unregister(ol_event_loop_t *loop, uint64_t id) {
         return OL_ERROR;
     }
     
-    /* Remove from poller if I/O event */
+    /* Remove from poller if I/O event, detach channel, disarm if timer */
+    bool is_channel = entry->type == OL_EV_CHANNEL;
     if (entry->type == OL_EV_IO) {
         ol_poller_del(loop->poller, entry->fd);
+    } else if (is_channel) {
+        ol_chan_reg_detach(entry->chan_reg);
+        entry->chan_reg = NULL;
+    } else if (entry->heap_index != OL_TIMER_NOT_QUEUED) {
+        ol_timer_heap_remove(loop, entry->heap_index);
     }
     
-    /* Mark as inactive */
-    entry->active = false;
+    /* Free the slot; the ID is stale from here on */
+    ol_release_entry(loop, entry);
     
-    /* Compact if many inactive entries */
-    if (loop->event_count > 32 && 
-        loop->event_count > loop->event_capacity / 2) {
-        ol_compact_events(loop);
+    ol_mutex_unlock(&loop->mutex);
+    
+    /* Off the loop thread, let a callback already running for this channel
+     * finish so the caller may destroy the channel once we return (on the
+     * loop thread that callback is our caller) */
+    if (is_channel && tl_current_loop != loop) {
+        while (atomic_load_explicit(&loop->chan_delivering, memory_order_acquire) == id) {
+#if defined(OL_PLATFORM_WINDOWS)
+            SwitchToThread();
+#else
+            (void)sched_yield();
+#endif
+        }
     }
     
-    ol_mutex_unlock(&loop->mutex);
     return OL_SUCCESS;
 }
 
@@ -705,11 +1463,7 @@ size_t ol_event_loop_event_count(const ol_event_loop_t *loop) {
     size_t count = 0;
     
     ol_mutex_lock((ol_mutex_t*)&loop->mutex);
-    for (size_t i = 0; i < loop->event_count; i++) {
-        if (loop->events[i].active) {
-            count++;
-        }
-    }
+    count = loop->event_count;
     ol_mutex_unlock((ol_mutex_t*)&loop->mutex);
     
     return count;
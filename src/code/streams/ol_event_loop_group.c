@@ -0,0 +1,257 @@
+/**
+ * @file ol_event_loop_group.c
+ * @brief Multi-reactor event loop group implementation
+ * @version 1.2.0
+ *
+ * Each loop runs ol_event_loop_run() on its own thread. Stopping is done by
+ * posting ol_event_loop_stop() to the loop itself, so a stop issued before
+ * the thread has entered its run loop is never lost.
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE /* pthread_setaffinity_np, CPU_SET */
+#endif
+
+#include "ol_event_loop_group.h"
+#include "ol_common.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#if defined(OL_PLATFORM_WINDOWS)
+    #include <windows.h>
+    typedef HANDLE ol_group_thread_t;
+#else
+    #include <pthread.h>
+    #include <unistd.h>
+    #if defined(OL_PLATFORM_LINUX)
+        #include <sched.h>
+    #endif
+    typedef pthread_t ol_group_thread_t;
+#endif
+
+/* --------------------------------------------------------------------------
+ * Internal structures
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @brief One loop and the thread running it
+ */
+typedef struct {
+    ol_event_loop_t *loop;      /**< Event loop */
+    ol_group_thread_t thread;   /**< Thread running the loop */
+    bool started;               /**< Thread was created */
+    int cpu;                    /**< CPU to pin to (-1 = unpinned) */
+} ol_group_member_t;
+
+/**
+ * @brief Event loop group internal state
+ */
+struct ol_event_loop_group {
+    ol_group_member_t *members; /**< Loops and threads */
+    size_t count;               /**< Number of members */
+    atomic_size_t next;         /**< Round-robin cursor */
+};
+
+/* --------------------------------------------------------------------------
+ * Helper functions
+ * -------------------------------------------------------------------------- */
+
+/**
+ * @brief Number of online CPUs (at least 1)
+ */
+static size_t ol_group_cpu_count(void) {
+#if defined(OL_PLATFORM_WINDOWS)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (size_t)info.dwNumberOfProcessors : 1;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (size_t)n : 1;
+#endif
+}
+
+/**
+ * @brief Pin the calling thread to a CPU (best effort)
+ */
+static void ol_group_pin_self(int cpu) {
+    if (cpu < 0) {
+        return;
+    }
+
+#if defined(OL_PLATFORM_WINDOWS)
+    SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << (cpu % 64));
+#elif defined(OL_PLATFORM_LINUX)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    (void)pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu; /* No portable affinity API (macOS only offers hints) */
+#endif
+}
+
+#if defined(OL_PLATFORM_WINDOWS)
+static DWORD WINAPI ol_group_thread_main(LPVOID arg) {
+#else
+static void* ol_group_thread_main(void *arg) {
+#endif
+    ol_group_member_t *m = (ol_group_member_t*)arg;
+    
+    ol_group_pin_self(m->cpu);
+    ol_event_loop_run(m->loop);
+
+#if defined(OL_PLATFORM_WINDOWS)
+    return 0;
+#else
+    return NULL;
+#endif
+}
+
+static int ol_group_thread_start(ol_group_member_t *m) {
+#if defined(OL_PLATFORM_WINDOWS)
+    m->thread = CreateThread(NULL, 0, ol_group_thread_main, m, 0, NULL);
+    return m->thread != NULL ? OL_SUCCESS : OL_ERROR;
+#else
+    return pthread_create(&m->thread, NULL, ol_group_thread_main, m) == 0
+           ? OL_SUCCESS : OL_ERROR;
+#endif
+}
+
+static void ol_group_thread_join(ol_group_member_t *m) {
+#if defined(OL_PLATFORM_WINDOWS)
+    WaitForSingleObject(m->thread, INFINITE);
+    CloseHandle(m->thread);
+#else
+    (void)pthread_join(m->thread, NULL);
+#endif
+}
+
+/**
+ * @brief Posted to a loop to stop it from its own thread
+ */
+static void ol_group_stop_task(void *arg) {
+    ol_event_loop_stop((ol_event_loop_t*)arg);
+}
+
+/* --------------------------------------------------------------------------
+ * Public API implementation
+ * -------------------------------------------------------------------------- */
+
+ol_event_loop_group_t* ol_event_loop_group_create(size_t num_loops,
+                                                  ol_poller_backend_t backend,
+                                                  bool pin_threads) {
+    size_t cpus = ol_group_cpu_count();
+    if (num_loops == 0) {
+        num_loops = cpus;
+    }
+    
+    ol_event_loop_group_t *group =
+        (ol_event_loop_group_t*)calloc(1, sizeof(ol_event_loop_group_t));
+    if (!group) {
+        return NULL;
+    }
+    
+    group->members = (ol_group_member_t*)calloc(num_loops, sizeof(ol_group_member_t));
+    if (!group->members) {
+        free(group);
+        return NULL;
+    }
+    
+    group->count = num_loops;
+    atomic_init(&group->next, 0);
+    
+    /* Create all loops first so a partially started group is never visible */
+    for (size_t i = 0; i < num_loops; i++) {
+        ol_group_member_t *m = &group->members[i];
+        m->cpu = pin_threads ? (int)(i % cpus) : -1;
+        m->loop = ol_event_loop_create_ex(backend);
+        if (!m->loop) {
+            ol_event_loop_group_destroy(group);
+            return NULL;
+        }
+    }
+    
+    for (size_t i = 0; i < num_loops; i++) {
+        ol_group_member_t *m = &group->members[i];
+        if (ol_group_thread_start(m) != OL_SUCCESS) {
+            ol_event_loop_group_destroy(group);
+            return NULL;
+        }
+        m->started = true;
+    }
+    
+    return group;
+}
+
+void ol_event_loop_group_destroy(ol_event_loop_group_t *group) {
+    if (!group) {
+        return;
+    }
+    
+    /* Ask every loop to stop, then join (loops stop in parallel) */
+    for (size_t i = 0; i < group->count; i++) {
+        ol_group_member_t *m = &group->members[i];
+        if (m->started &&
+            ol_event_loop_post(m->loop, ol_group_stop_task, m->loop) != OL_SUCCESS) {
+            /* Out of memory: fall back to a direct stop request */
+            ol_event_loop_stop(m->loop);
+        }
+    }
+    
+    for (size_t i = 0; i < group->count; i++) {
+        ol_group_member_t *m = &group->members[i];
+        if (m->started) {
+            ol_group_thread_join(m);
+        }
+        ol_event_loop_destroy(m->loop);
+    }
+    
+    free(group->members);
+    free(group);
+}
+
+size_t ol_event_loop_group_size(const ol_event_loop_group_t *group) {
+    return group ? group->count : 0;
+}
+
+ol_event_loop_t* ol_event_loop_group_get(ol_event_loop_group_t *group,
+                                         size_t index) {
+    if (!group || index >= group->count) {
+        return NULL;
+    }
+    
+    return group->members[index].loop;
+}
+
+ol_event_loop_t* ol_event_loop_group_next(ol_event_loop_group_t *group) {
+    if (!group || group->count == 0) {
+        return NULL;
+    }
+    
+    size_t i = atomic_fetch_add_explicit(&group->next, 1, memory_order_relaxed);
+    return group->members[i % group->count].loop;
+}
+
+ol_event_loop_t* ol_event_loop_group_least_loaded(ol_event_loop_group_t *group) {
+    if (!group || group->count == 0) {
+        return NULL;
+    }
+    
+    /* Scan from a rotating start so equal loads are spread round-robin */
+    size_t start = atomic_fetch_add_explicit(&group->next, 1, memory_order_relaxed);
+    size_t best = start % group->count;
+    size_t best_load = (size_t)-1;
+    
+    for (size_t k = 0; k < group->count; k++) {
+        size_t i = (start + k) % group->count;
+        size_t load = ol_event_loop_event_count(group->members[i].loop);
+        if (load < best_load) {
+            best_load = load;
+            best = i;
+        }
+    }
+    
+    return group->members[best].loop;
+}
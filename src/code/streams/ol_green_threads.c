@@ -5,11 +5,21 @@
  * @date 2026
  */
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+    #define _GNU_SOURCE /* accept4, SIGEV_THREAD_ID */
+#endif
+
+#include "ol_poller.h"  /* Before ol_green_threads.h, whose macros take precedence */
 #include "ol_green_threads.h"
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <errno.h>
+#include <signal.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #include <cpuid.h>
+#endif
 
 /* ==================== Platform-Specific Headers ==================== */
 #if OL_PLATFORM_WINDOWS
@@ -37,14 +47,20 @@
     #include <sched.h>
     #include <time.h>
     #include <errno.h>
+    #include <fcntl.h>
+    #include <sys/socket.h>
     
     #if defined(__linux__)
         #include <sys/timerfd.h>
         #include <sys/eventfd.h>
         #include <linux/futex.h>
-        #include <numa.h>
-        #include <numaif.h>
-        #define OL_NUMA_AVAILABLE 1
+        #if defined(OL_HAVE_LIBNUMA)
+            #include <numa.h>
+            #include <numaif.h>
+            #define OL_NUMA_AVAILABLE 1  /* Build found libnuma */
+        #else
+            #define OL_NUMA_AVAILABLE 0
+        #endif
     #elif defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__)
         #include <sys/param.h>
         #include <sys/cpuset.h>
@@ -112,10 +128,12 @@ static const uint64_t OL_DEFAULT_PREEMPTION_SLICE_NS = 10 * 1000 * 1000;
 static const size_t OL_MAX_WORK_STEALING_QUEUE_SIZE = 1024;
 
 /**
- * @brief Stack pool bucket sizes (1KB, 2KB, 4KB, 8KB, 16KB, 32KB, 64KB, 128KB)
+ * @brief Stack pool bucket sizes (64KB .. 8MB, i.e. OL_MIN_STACK_SIZE .. OL_MAX_STACK_SIZE)
+ * @note Only address space is reserved per stack; pages are committed on touch
  */
 static const size_t OL_STACK_POOL_BUCKET_SIZES[8] = {
-    1024, 2048, 4096, 8192, 16384, 32768, 65536, 131072
+    64 * 1024, 128 * 1024, 256 * 1024, 512 * 1024,
+    1024 * 1024, 2 * 1024 * 1024, 4 * 1024 * 1024, 8 * 1024 * 1024
 };
 
 /* ==================== Thread-Local Scheduler Instance ==================== */
@@ -149,499 +167,210 @@ static ol_gt_statistics_t g_global_stats = {0};
  */
 static atomic_int g_last_error = ATOMIC_VAR_INIT(OL_GT_SUCCESS);
 
-/* ==================== Assembly Context Switching ==================== */
-
-#if OL_PLATFORM_POSIX && !OL_PLATFORM_WINDOWS
-
-/**
- * @brief x86_64 context structure
- */
-typedef struct {
-    uintptr_t rbx;
-    uintptr_t rbp;
-    uintptr_t r12;
-    uintptr_t r13;
-    uintptr_t r14;
-    uintptr_t r15;
-    uintptr_t rsp;
-    uintptr_t rip;
-    uintptr_t mxcsr;
-    uint64_t xmm6[2];
-    uint64_t xmm7[2];
-    uint64_t xmm8[2];
-    uint64_t xmm9[2];
-    uint64_t xmm10[2];
-    uint64_t xmm11[2];
-    uint64_t xmm12[2];
-    uint64_t xmm13[2];
-    uint64_t xmm14[2];
-    uint64_t xmm15[2];
-} ol_ctx_x86_64_t;
-
-/**
- * @brief ARM64 context structure
- */
-typedef struct {
-    uintptr_t x19;
-    uintptr_t x20;
-    uintptr_t x21;
-    uintptr_t x22;
-    uintptr_t x23;
-    uintptr_t x24;
-    uintptr_t x25;
-    uintptr_t x26;
-    uintptr_t x27;
-    uintptr_t x28;
-    uintptr_t fp;    /* x29 */
-    uintptr_t lr;    /* x30 */
-    uintptr_t sp;
-    uintptr_t pc;
-    uint32_t fpcr;
-    uint32_t fpsr;
-    uint64_t v8[2];
-    uint64_t v9[2];
-    uint64_t v10[2];
-    uint64_t v11[2];
-    uint64_t v12[2];
-    uint64_t v13[2];
-    uint64_t v14[2];
-    uint64_t v15[2];
-} ol_ctx_aarch64_t;
-
-/**
- * @brief ARM context structure
- */
-typedef struct {
-    uintptr_t r4;
-    uintptr_t r5;
-    uintptr_t r6;
-    uintptr_t r7;
-    uintptr_t r8;
-    uintptr_t r9;
-    uintptr_t r10;
-    uintptr_t r11; /* fp */
-    uintptr_t sp;
-    uintptr_t lr;
-    uintptr_t pc;
-    uint32_t fpscr;
-    uint64_t d8;
-    uint64_t d9;
-    uint64_t d10;
-    uint64_t d11;
-    uint64_t d12;
-    uint64_t d13;
-    uint64_t d14;
-    uint64_t d15;
-} ol_ctx_arm_t;
-
-/**
- * @brief Save x86_64 context (assembly)
- */
-static OL_FORCE_INLINE void ol_ctx_save_x86_64(ol_ctx_x86_64_t* ctx) {
-    asm volatile(
-        /* Save integer registers */
-        "movq %%rbx,  0(%0)\n\t"
-        "movq %%rbp,  8(%0)\n\t"
-        "movq %%r12, 16(%0)\n\t"
-        "movq %%r13, 24(%0)\n\t"
-        "movq %%r14, 32(%0)\n\t"
-        "movq %%r15, 40(%0)\n\t"
-        "movq %%rsp, 48(%0)\n\t"
-        "leaq 1f(%%rip), %%rax\n\t"
-        "movq %%rax, 56(%0)\n\t"
-        
-        /* Save MXCSR */
-        "stmxcsr 64(%0)\n\t"
-        
-        /* Save XMM registers */
-        "movdqu %%xmm6,  72(%0)\n\t"
-        "movdqu %%xmm7,  88(%0)\n\t"
-        "movdqu %%xmm8, 104(%0)\n\t"
-        "movdqu %%xmm9, 120(%0)\n\t"
-        "movdqu %%xmm10, 136(%0)\n\t"
-        "movdqu %%xmm11, 152(%0)\n\t"
-        "movdqu %%xmm12, 168(%0)\n\t"
-        "movdqu %%xmm13, 184(%0)\n\t"
-        "movdqu %%xmm14, 200(%0)\n\t"
-        "movdqu %%xmm15, 216(%0)\n\t"
-        
-        "1:\n\t"
-        : 
-        : "r"(ctx)
-        : "rax", "memory"
-    );
-}
+/* ==================== Context Switching ==================== */
 
-/**
- * @brief Restore x86_64 context (assembly)
+/*
+ * A green thread only ever switches to and from its scheduler's root
+ * context (the OS thread's own stack), which decides what runs next.
+ * Switching pushes the callee-saved registers onto the outgoing stack,
+ * saves the stack pointer, loads the other one and pops its registers;
+ * everything else is already saved by the C calling convention.
+ *
+ * A new thread's stack is laid out as if it had been switched out at the
+ * start of ol_gt_ctx_entry, with the entry function and its argument in
+ * two of the callee-saved registers.
  */
-static OL_FORCE_INLINE void ol_ctx_restore_x86_64(const ol_ctx_x86_64_t* ctx) {
-    asm volatile(
-        /* Restore XMM registers */
-        "movdqu 216(%0), %%xmm15\n\t"
-        "movdqu 200(%0), %%xmm14\n\t"
-        "movdqu 184(%0), %%xmm13\n\t"
-        "movdqu 168(%0), %%xmm12\n\t"
-        "movdqu 152(%0), %%xmm11\n\t"
-        "movdqu 136(%0), %%xmm10\n\t"
-        "movdqu 120(%0), %%xmm9\n\t"
-        "movdqu 104(%0), %%xmm8\n\t"
-        "movdqu  88(%0), %%xmm7\n\t"
-        "movdqu  72(%0), %%xmm6\n\t"
-        
-        /* Restore MXCSR */
-        "ldmxcsr 64(%0)\n\t"
-        
-        /* Restore integer registers */
-        "movq 56(%0), %%rax\n\t"
-        "movq 48(%0), %%rsp\n\t"
-        "movq 40(%0), %%r15\n\t"
-        "movq 32(%0), %%r14\n\t"
-        "movq 24(%0), %%r13\n\t"
-        "movq 16(%0), %%r12\n\t"
-        "movq  8(%0), %%rbp\n\t"
-        "movq  0(%0), %%rbx\n\t"
-        
-        /* Jump to saved RIP */
-        "jmp *%%rax\n\t"
-        : 
-        : "r"(ctx)
-        : "rax", "memory"
-    );
-    
-    __builtin_unreachable();
-}
 
-/**
- * @brief Make new x86_64 context
- */
-static OL_FORCE_INLINE void ol_ctx_make_x86_64(ol_ctx_x86_64_t* ctx, 
-                                               void (*fn)(void), 
-                                               void* arg,
-                                               void* stack_base, 
-                                               size_t stack_size) {
-    /* Clear context */
-    memset(ctx, 0, sizeof(*ctx));
-    
-    /* Set MXCSR to default value */
-    ctx->mxcsr = 0x1F80;
-    
-    /* Calculate stack top (16-byte aligned) */
-    uintptr_t stack_top = (uintptr_t)stack_base + stack_size;
-    stack_top = (stack_top & ~0xF);
-    
-    /* Reserve space for return address */
-    stack_top -= sizeof(uintptr_t);
-    
-    /* Set up stack for function call */
-    uintptr_t* stack = (uintptr_t*)stack_top;
-    
-    /* Push argument */
-    stack -= 1;
-    *stack = (uintptr_t)arg;
-    
-    /* Align stack to 16 bytes after pushing */
-    if (((uintptr_t)stack & 0xF) != 0) {
-        stack -= 1;
-        *stack = 0; /* Padding */
-    }
-    
-    /* Set context registers */
-    ctx->rsp = (uintptr_t)stack;
-    ctx->rip = (uintptr_t)fn;
-    
-    /* Save callee-saved registers */
-    ctx->rbx = (uintptr_t)arg;
-    ctx->rbp = 0;
-    ctx->r12 = 0;
-    ctx->r13 = 0;
-    ctx->r14 = 0;
-    ctx->r15 = 0;
-}
+#if OL_PLATFORM_POSIX
 
-/**
- * @brief Save ARM64 context (assembly)
- */
-static OL_FORCE_INLINE void ol_ctx_save_aarch64(ol_ctx_aarch64_t* ctx) {
-    asm volatile(
-        /* Save integer registers */
-        "stp x19, x20, [%0, #0]\n\t"
-        "stp x21, x22, [%0, #16]\n\t"
-        "stp x23, x24, [%0, #32]\n\t"
-        "stp x25, x26, [%0, #48]\n\t"
-        "stp x27, x28, [%0, #64]\n\t"
-        "stp fp, lr, [%0, #80]\n\t"
-        "mov x1, sp\n\t"
-        "str x1, [%0, #96]\n\t"
-        
-        /* Save FPCR and FPSR */
-        "mrs x1, fpcr\n\t"
-        "str w1, [%0, #104]\n\t"
-        "mrs x1, fpsr\n\t"
-        "str w1, [%0, #108]\n\t"
-        
-        /* Save vector registers */
-        "stp d8, d9, [%0, #112]\n\t"
-        "stp d10, d11, [%0, #128]\n\t"
-        "stp d12, d13, [%0, #144]\n\t"
-        "stp d14, d15, [%0, #160]\n\t"
-        
-        /* Save return address */
-        "adr x1, 1f\n\t"
-        "str x1, [%0, #176]\n\t"
-        
-        "1:\n\t"
-        : 
-        : "r"(ctx)
-        : "x1", "memory"
-    );
-}
+#if defined(__APPLE__)
+    #define OL_ASM_SYM(name) "_" #name
+    #define OL_ASM_FUNC(name) \
+        ".globl " OL_ASM_SYM(name) "\n" \
+        ".private_extern " OL_ASM_SYM(name) "\n" \
+        OL_ASM_SYM(name) ":\n"
+#elif OL_ARCH_ARM
+    #define OL_ASM_SYM(name) #name
+    #define OL_ASM_FUNC(name) \
+        ".globl " #name "\n" \
+        ".hidden " #name "\n" \
+        ".type " #name ", %function\n" \
+        #name ":\n"
+#else
+    #define OL_ASM_SYM(name) #name
+    #define OL_ASM_FUNC(name) \
+        ".globl " #name "\n" \
+        ".hidden " #name "\n" \
+        ".type " #name ", @function\n" \
+        #name ":\n"
+#endif
 
 /**
- * @brief Restore ARM64 context (assembly)
+ * @brief Save the running context into *save_sp and switch to load_sp
  */
-static OL_FORCE_INLINE void ol_ctx_restore_aarch64(const ol_ctx_aarch64_t* ctx) {
-    asm volatile(
-        /* Restore vector registers */
-        "ldp d14, d15, [%0, #160]\n\t"
-        "ldp d12, d13, [%0, #144]\n\t"
-        "ldp d10, d11, [%0, #128]\n\t"
-        "ldp d8, d9, [%0, #112]\n\t"
-        
-        /* Restore FPCR and FPSR */
-        "ldr w1, [%0, #108]\n\t"
-        "msr fpsr, x1\n\t"
-        "ldr w1, [%0, #104]\n\t"
-        "msr fpcr, x1\n\t"
-        
-        /* Restore integer registers */
-        "ldr x1, [%0, #96]\n\t"
-        "mov sp, x1\n\t"
-        "ldp fp, lr, [%0, #80]\n\t"
-        "ldp x27, x28, [%0, #64]\n\t"
-        "ldp x25, x26, [%0, #48]\n\t"
-        "ldp x23, x24, [%0, #32]\n\t"
-        "ldp x21, x22, [%0, #16]\n\t"
-        "ldp x19, x20, [%0, #0]\n\t"
-        
-        /* Jump to saved PC */
-        "ldr x1, [%0, #176]\n\t"
-        "br x1\n\t"
-        : 
-        : "r"(ctx)
-        : "x1", "memory"
-    );
-    
-    __builtin_unreachable();
-}
+void ol_gt_ctx_swap(void** save_sp, void* load_sp);
 
 /**
- * @brief Make new ARM64 context
+ * @brief First code a new green thread runs: calls fn(arg), never returns
  */
-static OL_FORCE_INLINE void ol_ctx_make_aarch64(ol_ctx_aarch64_t* ctx,
-                                                void (*fn)(void),
-                                                void* arg,
-                                                void* stack_base,
-                                                size_t stack_size) {
-    /* Clear context */
-    memset(ctx, 0, sizeof(*ctx));
-    
-    /* Set default FPCR/FPSR */
-    ctx->fpcr = 0;
-    ctx->fpsr = 0;
-    
-    /* Calculate stack top (16-byte aligned) */
-    uintptr_t stack_top = (uintptr_t)stack_base + stack_size;
-    stack_top = (stack_top & ~0xF);
-    
-    /* Reserve space for frame record */
-    stack_top -= 16;
-    
-    /* Set up stack */
-    ctx->sp = stack_top;
-    ctx->pc = (uintptr_t)fn;
-    ctx->lr = 0; /* No return address */
-    ctx->fp = 0; /* Frame pointer */
-    
-    /* Set argument in x19 (callee-saved) */
-    ctx->x19 = (uintptr_t)arg;
-}
+void ol_gt_ctx_entry(void);
 
-/**
- * @brief Save ARM context (assembly)
- */
-static OL_FORCE_INLINE void ol_ctx_save_arm(ol_ctx_arm_t* ctx) {
-    asm volatile(
-        /* Save integer registers */
-        "stmia %0!, {r4-r11}\n\t"
-        "str sp, [%0], #4\n\t"
-        "str lr, [%0], #4\n\t"
-        
-        /* Save FPSCR */
-        "vmrs r1, fpscr\n\t"
-        "str r1, [%0], #4\n\t"
-        
-        /* Save vector registers */
-        "vstr d15, [%0], #8\n\t"
-        "vstr d14, [%0], #8\n\t"
-        "vstr d13, [%0], #8\n\t"
-        "vstr d12, [%0], #8\n\t"
-        "vstr d11, [%0], #8\n\t"
-        "vstr d10, [%0], #8\n\t"
-        "vstr d9, [%0], #8\n\t"
-        "vstr d8, [%0], #8\n\t"
-        
-        /* Save return address */
-        "adr r1, 1f\n\t"
-        "str r1, [%0]\n\t"
-        
-        "1:\n\t"
-        : "+r"(ctx)
-        : 
-        : "r1", "memory"
-    );
-}
+#if OL_ARCH_X86_64
 
-/**
- * @brief Restore ARM context (assembly)
- */
-static OL_FORCE_INLINE void ol_ctx_restore_arm(const ol_ctx_arm_t* ctx) {
-    asm volatile(
-        /* Restore vector registers */
-        "vldr d8, [%0], #8\n\t"
-        "vldr d9, [%0], #8\n\t"
-        "vldr d10, [%0], #8\n\t"
-        "vldr d11, [%0], #8\n\t"
-        "vldr d12, [%0], #8\n\t"
-        "vldr d13, [%0], #8\n\t"
-        "vldr d14, [%0], #8\n\t"
-        "vldr d15, [%0], #8\n\t"
-        
-        /* Restore FPSCR */
-        "ldr r1, [%0], #4\n\t"
-        "vmsr fpscr, r1\n\t"
-        
-        /* Restore integer registers */
-        "ldr lr, [%0], #4\n\t"
-        "ldr sp, [%0], #4\n\t"
-        "ldmia %0!, {r4-r11}\n\t"
-        
-        /* Jump to saved PC */
-        "ldr r1, [%0]\n\t"
-        "bx r1\n\t"
-        : "+r"(ctx)
-        : 
-        : "r1", "memory"
-    );
-    
-    __builtin_unreachable();
-}
+/* Frame: mxcsr + x87 control word, r15, r14, r13, r12, rbx, rbp, return address */
+#define OL_CTX_FRAME_SIZE 64
+
+__asm__(
+    ".text\n"
+    ".p2align 4\n"
+    OL_ASM_FUNC(ol_gt_ctx_swap)
+    "    pushq %rbp\n"
+    "    pushq %rbx\n"
+    "    pushq %r12\n"
+    "    pushq %r13\n"
+    "    pushq %r14\n"
+    "    pushq %r15\n"
+    "    subq $8, %rsp\n"
+    "    stmxcsr (%rsp)\n"
+    "    fnstcw 4(%rsp)\n"
+    "    movq %rsp, (%rdi)\n"
+    "    movq %rsi, %rsp\n"
+    "    ldmxcsr (%rsp)\n"
+    "    fldcw 4(%rsp)\n"
+    "    addq $8, %rsp\n"
+    "    popq %r15\n"
+    "    popq %r14\n"
+    "    popq %r13\n"
+    "    popq %r12\n"
+    "    popq %rbx\n"
+    "    popq %rbp\n"
+    "    ret\n"
+    ".p2align 4\n"
+    OL_ASM_FUNC(ol_gt_ctx_entry)
+    "    movq %r13, %rdi\n"
+    "    callq *%r12\n"
+    "    ud2\n"
+);
 
-/**
- * @brief Make new ARM context
- */
-static OL_FORCE_INLINE void ol_ctx_make_arm(ol_ctx_arm_t* ctx,
-                                            void (*fn)(void),
-                                            void* arg,
-                                            void* stack_base,
-                                            size_t stack_size) {
-    /* Clear context */
-    memset(ctx, 0, sizeof(*ctx));
-    
-    /* Set default FPSCR */
-    ctx->fpscr = 0;
-    
-    /* Calculate stack top (8-byte aligned) */
-    uintptr_t stack_top = (uintptr_t)stack_base + stack_size;
-    stack_top = (stack_top & ~0x7);
-    
-    /* Set up stack */
-    ctx->sp = stack_top;
-    ctx->pc = (uintptr_t)fn;
-    ctx->lr = 0; /* No return address */
-    
-    /* Set argument in r4 (callee-saved) */
-    ctx->r4 = (uintptr_t)arg;
-}
+#elif OL_ARCH_AARCH64
 
-#endif /* OL_PLATFORM_POSIX */
+/* Frame: x19-x28, fp, lr, d8-d15 */
+#define OL_CTX_FRAME_SIZE 176
+
+__asm__(
+    ".text\n"
+    ".p2align 4\n"
+    OL_ASM_FUNC(ol_gt_ctx_swap)
+    "    sub sp, sp, #176\n"
+    "    stp x19, x20, [sp, #0]\n"
+    "    stp x21, x22, [sp, #16]\n"
+    "    stp x23, x24, [sp, #32]\n"
+    "    stp x25, x26, [sp, #48]\n"
+    "    stp x27, x28, [sp, #64]\n"
+    "    stp x29, x30, [sp, #80]\n"
+    "    stp d8, d9, [sp, #96]\n"
+    "    stp d10, d11, [sp, #112]\n"
+    "    stp d12, d13, [sp, #128]\n"
+    "    stp d14, d15, [sp, #144]\n"
+    "    mov x2, sp\n"
+    "    str x2, [x0]\n"
+    "    mov sp, x1\n"
+    "    ldp x19, x20, [sp, #0]\n"
+    "    ldp x21, x22, [sp, #16]\n"
+    "    ldp x23, x24, [sp, #32]\n"
+    "    ldp x25, x26, [sp, #48]\n"
+    "    ldp x27, x28, [sp, #64]\n"
+    "    ldp x29, x30, [sp, #80]\n"
+    "    ldp d8, d9, [sp, #96]\n"
+    "    ldp d10, d11, [sp, #112]\n"
+    "    ldp d12, d13, [sp, #128]\n"
+    "    ldp d14, d15, [sp, #144]\n"
+    "    add sp, sp, #176\n"
+    "    ret\n"
+    ".p2align 4\n"
+    OL_ASM_FUNC(ol_gt_ctx_entry)
+    "    mov x0, x20\n"
+    "    blr x19\n"
+    "    brk #0\n"
+);
 
-/* ==================== Context Switching Wrappers ==================== */
+#elif OL_ARCH_ARM
 
-/**
- * @brief Platform-independent context save
- */
-static OL_FORCE_INLINE void ol_ctx_save(void* ctx) {
-#if OL_PLATFORM_WINDOWS
-    /* Windows uses fibers, no manual context save needed */
-    (void)ctx;
-#elif OL_PLATFORM_POSIX
-    #if OL_ARCH_X86_64
-        ol_ctx_save_x86_64((ol_ctx_x86_64_t*)ctx);
-    #elif OL_ARCH_AARCH64
-        ol_ctx_save_aarch64((ol_ctx_aarch64_t*)ctx);
-    #elif OL_ARCH_ARM
-        ol_ctx_save_arm((ol_ctx_arm_t*)ctx);
-    #else
-        #error "Unsupported architecture for assembly context switching"
-    #endif
+#if defined(__ARM_PCS_VFP) || (defined(__VFP_FP__) && !defined(__SOFTFP__))
+    #define OL_CTX_ARM_VFP 1
+    /* Frame: d8-d15, r4-r11, return address */
+    #define OL_CTX_FRAME_SIZE 100
+    #define OL_CTX_ARM_SAVE_VFP "    vpush {d8-d15}\n"
+    #define OL_CTX_ARM_LOAD_VFP "    vpop {d8-d15}\n"
+#else
+    #define OL_CTX_ARM_VFP 0
+    /* Frame: r4-r11, return address */
+    #define OL_CTX_FRAME_SIZE 36
+    #define OL_CTX_ARM_SAVE_VFP ""
+    #define OL_CTX_ARM_LOAD_VFP ""
 #endif
-}
 
-/**
- * @brief Platform-independent context restore
- */
-static OL_FORCE_INLINE void ol_ctx_restore(const void* ctx) {
-#if OL_PLATFORM_WINDOWS
-    /* Windows uses fibers, no manual context restore needed */
-    (void)ctx;
-#elif OL_PLATFORM_POSIX
-    #if OL_ARCH_X86_64
-        ol_ctx_restore_x86_64((const ol_ctx_x86_64_t*)ctx);
-    #elif OL_ARCH_AARCH64
-        ol_ctx_restore_aarch64((const ol_ctx_aarch64_t*)ctx);
-    #elif OL_ARCH_ARM
-        ol_ctx_restore_arm((const ol_ctx_arm_t*)ctx);
-    #else
-        #error "Unsupported architecture for assembly context switching"
-    #endif
+__asm__(
+    ".text\n"
+    ".syntax unified\n"
+    ".arm\n"
+    ".p2align 2\n"
+    OL_ASM_FUNC(ol_gt_ctx_swap)
+    "    push {r4-r11, lr}\n"
+    OL_CTX_ARM_SAVE_VFP
+    "    str sp, [r0]\n"
+    "    mov sp, r1\n"
+    OL_CTX_ARM_LOAD_VFP
+    "    pop {r4-r11, pc}\n"
+    ".p2align 2\n"
+    OL_ASM_FUNC(ol_gt_ctx_entry)
+    "    mov r0, r5\n"
+    "    blx r4\n"
+    "    udf #0\n"
+);
+
+#else
+    #error "Unsupported architecture for green thread context switching"
 #endif
-}
 
 /**
- * @brief Platform-independent context creation
+ * @brief Lay out a new thread's stack so the first switch enters fn(arg)
  */
-static OL_FORCE_INLINE void ol_ctx_make(void* ctx, void (*fn)(void), void* arg,
-                                        void* stack_base, size_t stack_size) {
-#if OL_PLATFORM_WINDOWS
-    /* Windows fibers are created differently */
-    (void)ctx; (void)fn; (void)arg; (void)stack_base; (void)stack_size;
-#elif OL_PLATFORM_POSIX
-    #if OL_ARCH_X86_64
-        ol_ctx_make_x86_64((ol_ctx_x86_64_t*)ctx, fn, arg, stack_base, stack_size);
-    #elif OL_ARCH_AARCH64
-        ol_ctx_make_aarch64((ol_ctx_aarch64_t*)ctx, fn, arg, stack_base, stack_size);
-    #elif OL_ARCH_ARM
-        ol_ctx_make_arm((ol_ctx_arm_t*)ctx, fn, arg, stack_base, stack_size);
-    #else
-        #error "Unsupported architecture for assembly context switching"
-    #endif
+static void ol_ctx_make(ol_gt_t* gt, void (*fn)(void*), void* arg,
+                        void* stack_base, size_t stack_size) {
+    uintptr_t top = ((uintptr_t)stack_base + stack_size) & ~(uintptr_t)15;
+    
+#if OL_ARCH_X86_64
+    /* After the final ret, rsp == top: 16-byte aligned at the call */
+    uintptr_t* frame = (uintptr_t*)(top - OL_CTX_FRAME_SIZE);
+    memset(frame, 0, OL_CTX_FRAME_SIZE);
+    frame[0] = ((uintptr_t)0x037F << 32) | 0x1F80;  /* x87 CW, MXCSR defaults */
+    frame[3] = (uintptr_t)arg;                      /* r13 */
+    frame[4] = (uintptr_t)fn;                       /* r12 */
+    frame[7] = (uintptr_t)ol_gt_ctx_entry;          /* Return address */
+#elif OL_ARCH_AARCH64
+    uintptr_t* frame = (uintptr_t*)(top - OL_CTX_FRAME_SIZE);
+    memset(frame, 0, OL_CTX_FRAME_SIZE);
+    frame[0] = (uintptr_t)fn;                       /* x19 */
+    frame[1] = (uintptr_t)arg;                      /* x20 */
+    frame[11] = (uintptr_t)ol_gt_ctx_entry;         /* x30 */
+#elif OL_ARCH_ARM
+    /* After the final pop, sp == top - 8: 8-byte aligned at the call */
+    uint32_t* frame = (uint32_t*)(top - 8 - OL_CTX_FRAME_SIZE);
+    memset(frame, 0, OL_CTX_FRAME_SIZE);
+    size_t r4 = OL_CTX_ARM_VFP ? 16 : 0;            /* Skip d8-d15 */
+    frame[r4] = (uint32_t)(uintptr_t)fn;            /* r4 */
+    frame[r4 + 1] = (uint32_t)(uintptr_t)arg;       /* r5 */
+    frame[r4 + 8] = (uint32_t)(uintptr_t)ol_gt_ctx_entry;  /* pc */
 #endif
+    
+    gt->context.stack_ptr = frame;
+    gt->context.instruction_ptr = (void*)(uintptr_t)fn;
 }
 
-/* ==================== Work-Stealing Deque Implementation ==================== */
+#endif /* OL_PLATFORM_POSIX */
 
-/**
- * @brief Work-stealing deque structure (Chase-Lev algorithm)
- */
-struct ol_work_stealing_queue {
-    atomic_uintptr_t* array;
-    atomic_long bottom;
-    atomic_long top;
-    size_t capacity;
-    size_t mask;
-    uint8_t padding[OL_CACHE_LINE_SIZE - (4 * sizeof(size_t) + sizeof(atomic_uintptr_t*))];
-};
+/* ==================== Work-Stealing Deque Implementation ==================== */
 
 /**
  * @brief Initialize work-stealing queue
@@ -792,29 +521,138 @@ static OL_FORCE_INLINE bool ol_work_stealing_queue_empty(ol_work_stealing_queue_
     return b <= t;
 }
 
+/**
+ * @brief Take the oldest task from one of this thread's own deques
+ * @note Taking from the top, as a thief does, keeps each priority FIFO so
+ *       ready threads get their turns round-robin
+ */
+static OL_FORCE_INLINE void* ol_work_stealing_queue_take(ol_work_stealing_queue_t* queue) {
+    while (!ol_work_stealing_queue_empty(queue)) {
+        void* task = ol_work_stealing_queue_steal(queue);
+        if (task) {
+            return task;
+        }
+    }
+    return NULL;
+}
+
 /* ==================== Stack Pool Implementation ==================== */
 
 /**
- * @brief Stack pool bucket structure
+ * @brief Map a stack laid out as [guard][stack]
+ *
+ * On POSIX the whole range is reserved PROT_NONE with MAP_NORESERVE and
+ * only the stack part is opened up, so a page costs memory only once the
+ * thread first touches it. The NUMA node is a preference for those pages.
+ * Stacks grow down, so the single guard sits below; no guard above keeps
+ * each stack at two VMAs (guard + body). Every live or pooled stack still
+ * counts against vm.max_map_count (65530 by default, about 32k stacks);
+ * raise it for more threads with materialized stacks.
+ *
+ * On Windows the range is only reserved and the top page committed, so
+ * the guard is an uncommitted page that faults like PROT_NONE.
  */
-typedef struct {
-    void** stacks;
-    atomic_size_t count;
-    size_t capacity;
-    size_t stack_size;
-} ol_stack_bucket_t;
-
-/**
- * @brief Stack pool structure
- */
-struct ol_stack_pool {
-    ol_stack_bucket_t buckets[8];  /* 1KB, 2KB, 4KB, 8KB, 16KB, 32KB, 64KB, 128KB */
-    atomic_uint_fast64_t hits;
-    atomic_uint_fast64_t misses;
-    atomic_uint_fast64_t allocations;
-    atomic_uint_fast64_t deallocations;
-    uint8_t padding[OL_CACHE_LINE_SIZE - (8 * sizeof(ol_stack_bucket_t) + 4 * sizeof(atomic_uint_fast64_t))];
-};
+static void* ol_stack_map(size_t stack_size, int numa_node) {
+    size_t total_size = stack_size + OL_PAGE_SIZE;
+    
+#if OL_PLATFORM_POSIX
+    void* stack_area = mmap(NULL, total_size, PROT_NONE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (stack_area == MAP_FAILED) return NULL;
+    
+    char* stack = (char*)stack_area + OL_PAGE_SIZE;
+    if (mprotect(stack, stack_size, PROT_READ | PROT_WRITE) != 0) {
+        munmap(stack_area, total_size);
+        return NULL;
+    }
+    
+#if defined(__linux__) && OL_NUMA_AVAILABLE
+    if (numa_node >= 0 && numa_node < 64 && numa_available() >= 0) {
+        unsigned long mask = 1UL << numa_node;
+        (void)mbind(stack, stack_size, MPOL_PREFERRED, &mask, 64, 0);
+    }
+#else
+    (void)numa_node;
+#endif
+    
+    return stack;
+#elif OL_PLATFORM_WINDOWS
+    void* stack_area = VirtualAllocExNuma(
+        GetCurrentProcess(),
+        NULL,
+        total_size,
+        MEM_RESERVE,
+        PAGE_NOACCESS,
+        numa_node
+    );
+    if (!stack_area) return NULL;
+    
+    char* stack = (char*)stack_area + OL_PAGE_SIZE;
+    if (!VirtualAlloc(stack + stack_size - OL_PAGE_SIZE, OL_PAGE_SIZE,
+                      MEM_COMMIT, PAGE_READWRITE)) {
+        VirtualFree(stack_area, 0, MEM_RELEASE);
+        return NULL;
+    }
+    
+    return stack;
+#endif
+}
+
+/**
+ * @brief Unmap a stack created by ol_stack_map()
+ */
+static void ol_stack_unmap(void* stack, size_t stack_size) {
+    void* stack_area = (char*)stack - OL_PAGE_SIZE;
+    
+#if OL_PLATFORM_POSIX
+    munmap(stack_area, stack_size + OL_PAGE_SIZE);
+#elif OL_PLATFORM_WINDOWS
+    (void)stack_size;
+    VirtualFree(stack_area, 0, MEM_RELEASE);
+#endif
+}
+
+/**
+ * @brief Return a pooled stack's pages to the OS, keeping the mapping
+ * @note The top page (where the next thread's first frames go) stays resident
+ */
+static void ol_stack_decommit(void* stack, size_t stack_size) {
+#if OL_PLATFORM_POSIX
+    (void)madvise(stack, stack_size - OL_PAGE_SIZE, MADV_DONTNEED);
+#elif OL_PLATFORM_WINDOWS
+    (void)VirtualAlloc(stack, stack_size - OL_PAGE_SIZE, MEM_RESET, PAGE_READWRITE);
+#endif
+}
+
+/**
+ * @brief Bytes of a stack that are actually resident
+ */
+static size_t ol_stack_resident(const void* stack, size_t stack_size) {
+#if OL_PLATFORM_POSIX
+#if defined(__linux__)
+    unsigned char vec[256];
+#else
+    char vec[256];
+#endif
+    size_t pages = stack_size / OL_PAGE_SIZE;
+    size_t resident = 0;
+    
+    for (size_t first = 0; first < pages; first += 256) {
+        size_t n = pages - first < 256 ? pages - first : 256;
+        if (mincore((char*)stack + first * OL_PAGE_SIZE, n * OL_PAGE_SIZE, vec) != 0) {
+            return 0;
+        }
+        for (size_t i = 0; i < n; i++) {
+            resident += vec[i] & 1;
+        }
+    }
+    
+    return resident * OL_PAGE_SIZE;
+#else
+    (void)stack;
+    return stack_size;  /* Fibers commit their own stacks; report the reservation */
+#endif
+}
 
 /**
  * @brief Initialize stack pool
@@ -872,13 +710,7 @@ static OL_FORCE_INLINE void ol_stack_pool_destroy(ol_stack_pool_t* pool) {
             for (size_t j = 0; j < count; j++) {
                 void* stack = bucket->stacks[j];
                 if (stack) {
-#if OL_PLATFORM_POSIX
-                    size_t total_size = bucket->stack_size + 2 * OL_PAGE_SIZE;
-                    void* stack_area = (char*)stack - OL_PAGE_SIZE;
-                    munmap(stack_area, total_size);
-#elif OL_PLATFORM_WINDOWS
-                    VirtualFree(stack, 0, MEM_RELEASE);
-#endif
+                    ol_stack_unmap(stack, bucket->stack_size);
                 }
             }
             
@@ -900,8 +732,20 @@ static OL_FORCE_INLINE int ol_stack_pool_find_bucket(size_t stack_size) {
     return -1;  /* Too large for pool */
 }
 
+/**
+ * @brief Round a stack size up to what the pool actually maps
+ */
+static OL_FORCE_INLINE size_t ol_stack_pool_round(size_t stack_size) {
+    int bucket_idx = ol_stack_pool_find_bucket(stack_size);
+    if (bucket_idx >= 0) {
+        return OL_STACK_POOL_BUCKET_SIZES[bucket_idx];
+    }
+    return (stack_size + OL_PAGE_SIZE - 1) & ~(OL_PAGE_SIZE - 1);
+}
+
 /**
  * @brief Allocate stack (try pool first, then system)
+ * @note stack_size should come from ol_stack_pool_round()
  */
 static OL_FORCE_INLINE void* ol_stack_pool_allocate(ol_stack_pool_t* pool, 
                                                     size_t stack_size,
@@ -914,37 +758,7 @@ static OL_FORCE_INLINE void* ol_stack_pool_allocate(ol_stack_pool_t* pool,
         atomic_fetch_add_explicit(&pool->misses, 1, memory_order_relaxed);
         atomic_fetch_add_explicit(&pool->allocations, 1, memory_order_relaxed);
         
-        /* Direct allocation with NUMA awareness */
-#if OL_PLATFORM_POSIX
-        size_t total_size = stack_size + 2 * OL_PAGE_SIZE;
-        void* stack_area = ol_numa_alloc(total_size, OL_PAGE_SIZE, numa_node);
-        if (!stack_area) return NULL;
-        
-        /* Protect guard pages */
-        mprotect(stack_area, OL_PAGE_SIZE, PROT_NONE);
-        mprotect((char*)stack_area + total_size - OL_PAGE_SIZE, OL_PAGE_SIZE, PROT_NONE);
-        
-        return (char*)stack_area + OL_PAGE_SIZE;
-#elif OL_PLATFORM_WINDOWS
-        size_t total_size = stack_size + 2 * OL_PAGE_SIZE;
-        void* stack_area = VirtualAllocExNuma(
-            GetCurrentProcess(),
-            NULL,
-            total_size,
-            MEM_RESERVE | MEM_COMMIT,
-            PAGE_READWRITE,
-            numa_node
-        );
-        if (!stack_area) return NULL;
-        
-        /* Protect guard pages */
-        DWORD old_protect;
-        VirtualProtect(stack_area, OL_PAGE_SIZE, PAGE_NOACCESS, &old_protect);
-        VirtualProtect((char*)stack_area + total_size - OL_PAGE_SIZE, 
-                      OL_PAGE_SIZE, PAGE_NOACCESS, &old_protect);
-        
-        return (char*)stack_area + OL_PAGE_SIZE;
-#endif
+        return ol_stack_map(stack_size, numa_node);
     }
     
     ol_stack_bucket_t* bucket = &pool->buckets[bucket_idx];
@@ -967,37 +781,7 @@ static OL_FORCE_INLINE void* ol_stack_pool_allocate(ol_stack_pool_t* pool,
     atomic_fetch_add_explicit(&pool->misses, 1, memory_order_relaxed);
     atomic_fetch_add_explicit(&pool->allocations, 1, memory_order_relaxed);
     
-    /* Allocate with guard pages and NUMA awareness */
-#if OL_PLATFORM_POSIX
-    size_t total_size = bucket->stack_size + 2 * OL_PAGE_SIZE;
-    void* stack_area = ol_numa_alloc(total_size, OL_PAGE_SIZE, numa_node);
-    if (!stack_area) return NULL;
-    
-    /* Protect guard pages */
-    mprotect(stack_area, OL_PAGE_SIZE, PROT_NONE);
-    mprotect((char*)stack_area + total_size - OL_PAGE_SIZE, OL_PAGE_SIZE, PROT_NONE);
-    
-    return (char*)stack_area + OL_PAGE_SIZE;
-#elif OL_PLATFORM_WINDOWS
-    size_t total_size = bucket->stack_size + 2 * OL_PAGE_SIZE;
-    void* stack_area = VirtualAllocExNuma(
-        GetCurrentProcess(),
-        NULL,
-        total_size,
-        MEM_RESERVE | MEM_COMMIT,
-        PAGE_READWRITE,
-        numa_node
-    );
-    if (!stack_area) return NULL;
-    
-    /* Protect guard pages */
-    DWORD old_protect;
-    VirtualProtect(stack_area, OL_PAGE_SIZE, PAGE_NOACCESS, &old_protect);
-    VirtualProtect((char*)stack_area + total_size - OL_PAGE_SIZE, 
-                  OL_PAGE_SIZE, PAGE_NOACCESS, &old_protect);
-    
-    return (char*)stack_area + OL_PAGE_SIZE;
-#endif
+    return ol_stack_map(bucket->stack_size, numa_node);
 }
 
 /**
@@ -1012,16 +796,7 @@ static OL_FORCE_INLINE void ol_stack_pool_free(ol_stack_pool_t* pool,
     if (bucket_idx < 0) {
         /* Stack too large for pool, free directly */
         atomic_fetch_add_explicit(&pool->deallocations, 1, memory_order_relaxed);
-        
-#if OL_PLATFORM_POSIX
-        size_t total_size = stack_size + 2 * OL_PAGE_SIZE;
-        void* stack_area = (char*)stack - OL_PAGE_SIZE;
-        munmap(stack_area, total_size);
-#elif OL_PLATFORM_WINDOWS
-        size_t total_size = stack_size + 2 * OL_PAGE_SIZE;
-        void* stack_area = (char*)stack - OL_PAGE_SIZE;
-        VirtualFree(stack_area, 0, MEM_RELEASE);
-#endif
+        ol_stack_unmap(stack, stack_size);
         return;
     }
     
@@ -1031,6 +806,9 @@ static OL_FORCE_INLINE void ol_stack_pool_free(ol_stack_pool_t* pool,
     size_t count = atomic_load_explicit(&bucket->count, memory_order_relaxed);
     
     if (count < bucket->capacity) {
+        /* Pooled stacks keep their address range but not their memory */
+        ol_stack_decommit(stack, bucket->stack_size);
+        
         /* Add to bucket */
         bucket->stacks[count] = stack;
         
@@ -1040,16 +818,7 @@ static OL_FORCE_INLINE void ol_stack_pool_free(ol_stack_pool_t* pool,
     } else {
         /* Pool full, free directly */
         atomic_fetch_add_explicit(&pool->deallocations, 1, memory_order_relaxed);
-        
-#if OL_PLATFORM_POSIX
-        size_t total_size = bucket->stack_size + 2 * OL_PAGE_SIZE;
-        void* stack_area = (char*)stack - OL_PAGE_SIZE;
-        munmap(stack_area, total_size);
-#elif OL_PLATFORM_WINDOWS
-        size_t total_size = bucket->stack_size + 2 * OL_PAGE_SIZE;
-        void* stack_area = (char*)stack - OL_PAGE_SIZE;
-        VirtualFree(stack_area, 0, MEM_RELEASE);
-#endif
+        ol_stack_unmap(stack, bucket->stack_size);
     }
 }
 
@@ -1058,7 +827,7 @@ static OL_FORCE_INLINE void ol_stack_pool_free(ol_stack_pool_t* pool,
 /**
  * @brief Get current NUMA node
  */
-static OL_FORCE_INLINE int ol_get_current_numa_node(void) {
+int ol_get_current_numa_node(void) {
 #if OL_PLATFORM_WINDOWS && OL_NUMA_AVAILABLE
     ULONG node;
     if (GetNumaProcessorNodeEx((PPROCESSOR_NUMBER)NULL, &node) != 0) {
@@ -1078,7 +847,7 @@ static OL_FORCE_INLINE int ol_get_current_numa_node(void) {
 /**
  * @brief Allocate memory with NUMA awareness
  */
-static OL_NO_INLINE void* ol_numa_alloc(size_t size, size_t alignment, int numa_node) {
+OL_NO_INLINE void* ol_numa_alloc(size_t size, size_t alignment, int numa_node) {
     if (size == 0) return NULL;
     
     /* Adjust size for alignment */
@@ -1106,34 +875,29 @@ static OL_NO_INLINE void* ol_numa_alloc(size_t size, size_t alignment, int numa_
     return _aligned_malloc(aligned_size, alignment);
     
 #elif OL_PLATFORM_POSIX
-    /* POSIX allocation with alignment */
+    /* Heap allocation, so ol_numa_free() never has to guess the allocator */
     void* ptr = NULL;
+    if (alignment < sizeof(void*)) {
+        alignment = sizeof(void*);
+    }
+    if (posix_memalign(&ptr, alignment, aligned_size) != 0) {
+        return NULL;
+    }
     
-    #ifdef __linux__
-        /* Linux: try NUMA-aware allocation */
-        if (numa_node >= 0 && OL_NUMA_AVAILABLE && numa_available() >= 0) {
-            ptr = numa_alloc_onnode(aligned_size, numa_node);
-            if (ptr && alignment > sizeof(void*)) {
-                /* Realign if necessary */
-                void* aligned_ptr = ptr;
-                if (posix_memalign(&aligned_ptr, alignment, aligned_size) != 0) {
-                    numa_free(ptr, aligned_size);
-                    ptr = NULL;
-                } else if (aligned_ptr != ptr) {
-                    /* Copy data if alignment changed */
-                    memcpy(aligned_ptr, ptr, aligned_size);
-                    numa_free(ptr, aligned_size);
-                    ptr = aligned_ptr;
-                }
+    #if defined(__linux__) && OL_NUMA_AVAILABLE
+        /* Prefer the node for the whole pages inside the block */
+        if (numa_node >= 0 && numa_node < 64 && numa_available() >= 0) {
+            uintptr_t first = ((uintptr_t)ptr + OL_PAGE_SIZE - 1) & ~(uintptr_t)(OL_PAGE_SIZE - 1);
+            uintptr_t last = ((uintptr_t)ptr + aligned_size) & ~(uintptr_t)(OL_PAGE_SIZE - 1);
+            if (last > first) {
+                unsigned long mask = 1UL << numa_node;
+                (void)mbind((void*)first, last - first, MPOL_PREFERRED, &mask, 64, 0);
             }
-            if (ptr) return ptr;
         }
+    #else
+        (void)numa_node;
     #endif
     
-    /* Fallback to aligned allocation */
-    if (posix_memalign(&ptr, alignment, aligned_size) != 0) {
-        return NULL;
-    }
     return ptr;
 #endif
 }
@@ -1141,7 +905,7 @@ static OL_NO_INLINE void* ol_numa_alloc(size_t size, size_t alignment, int numa_
 /**
  * @brief Free NUMA-aware memory
  */
-static OL_NO_INLINE void ol_numa_free(void* ptr, size_t size) {
+OL_NO_INLINE void ol_numa_free(void* ptr, size_t size) {
     if (!ptr) return;
     
 #if OL_PLATFORM_WINDOWS
@@ -1157,16 +921,7 @@ static OL_NO_INLINE void ol_numa_free(void* ptr, size_t size) {
     #endif
     
 #elif OL_PLATFORM_POSIX
-    #ifdef __linux__
-        /* Check if it was allocated with numa_alloc */
-        if (OL_NUMA_AVAILABLE && numa_available() >= 0) {
-            /* Try to free as NUMA memory */
-            numa_free(ptr, size);
-            return;
-        }
-    #endif
-    
-    /* Fallback to regular free */
+    (void)size;
     free(ptr);
 #endif
 }
@@ -1174,7 +929,7 @@ static OL_NO_INLINE void ol_numa_free(void* ptr, size_t size) {
 /**
  * @brief Get CPU core count per NUMA node
  */
-static OL_FORCE_INLINE int ol_get_numa_cpu_count(int numa_node) {
+int ol_get_numa_cpu_count(int numa_node) {
 #if OL_PLATFORM_WINDOWS && OL_NUMA_AVAILABLE
     ULONG cpu_count = 0;
     if (GetNumaNodeProcessorMaskEx((USHORT)numa_node, &cpu_count) != 0) {
@@ -1206,13 +961,255 @@ static OL_FORCE_INLINE int ol_get_numa_cpu_count(int numa_node) {
 #endif
 }
 
-/* ==================== Scheduler Implementation ==================== */
+/* ==================== Clock & Preemption ==================== */
 
 /**
- * @brief Initialize thread-local scheduler
+ * @brief Nanoseconds per TSC tick in 32.32 fixed point (0 = TSC unusable)
+ * @note Calibrated by ol_gt_scheduler_init(); until then, and on CPUs
+ *       without an invariant TSC, scheduler ticks are monotonic nanoseconds
  */
-static OL_NO_INLINE int ol_gt_scheduler_init_thread_local(void) {
-    if (g_thread_scheduler) {
+static atomic_uint_fast64_t g_tsc_ns_mult = ATOMIC_VAR_INIT(0);
+
+/**
+ * @brief Read the monotonic clock and the TSC at (nearly) the same instant
+ * @note Keeps the tightest of a few TSC-bracketed clock reads
+ */
+static void ol_gt_tsc_sample(uint64_t* tsc, int64_t* ns) {
+    uint64_t before = ol_rdtsc();
+    *ns = ol_monotonic_now_ns();
+    uint64_t best = ol_rdtsc() - before;
+    *tsc = before + best / 2;
+    
+    for (int i = 1; i < 5; i++) {
+        before = ol_rdtsc();
+        int64_t now = ol_monotonic_now_ns();
+        uint64_t after = ol_rdtsc();
+        if (after - before < best) {
+            best = after - before;
+            *tsc = before + best / 2;
+            *ns = now;
+        }
+    }
+}
+
+/**
+ * @brief Calibrate the TSC against the monotonic clock (once per process)
+ */
+static void ol_gt_tsc_calibrate(void) {
+#if OL_PERF_COUNTER_AVAILABLE
+    if (atomic_load_explicit(&g_tsc_ns_mult, memory_order_relaxed) != 0) {
+        return;
+    }
+    
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    /* The TSC only measures time if its rate is invariant */
+    unsigned int a, b, c, d;
+    if (!__get_cpuid(0x80000007, &a, &b, &c, &d) || !(d & (1u << 8))) {
+        return;
+    }
+#endif
+    
+    /* Bracket a short sleep with paired (TSC, clock) samples */
+    uint64_t t0, t1;
+    int64_t n0, n1;
+    ol_gt_tsc_sample(&t0, &n0);
+#if OL_PLATFORM_WINDOWS
+    Sleep(5);
+#else
+    struct timespec ts = { 0, 5000000 };
+    nanosleep(&ts, NULL);
+#endif
+    ol_gt_tsc_sample(&t1, &n1);
+    
+    if (t1 > t0 && n1 > n0) {
+        double ns_per_tick = (double)(n1 - n0) / (double)(t1 - t0);
+        atomic_store_explicit(&g_tsc_ns_mult, (uint64_t)(ns_per_tick * 4294967296.0),
+                             memory_order_relaxed);
+    }
+#endif
+}
+
+/**
+ * @brief Current time in scheduler clock ticks
+ */
+static OL_FORCE_INLINE uint64_t ol_gt_clock_ticks(void) {
+    if (atomic_load_explicit(&g_tsc_ns_mult, memory_order_relaxed) != 0) {
+        return ol_rdtsc();
+    }
+    return (uint64_t)ol_monotonic_now_ns();
+}
+
+/**
+ * @brief Convert scheduler clock ticks to nanoseconds
+ */
+static OL_FORCE_INLINE uint64_t ol_gt_ticks_to_ns(uint64_t ticks) {
+    uint64_t mult = atomic_load_explicit(&g_tsc_ns_mult, memory_order_relaxed);
+    if (mult == 0) {
+        return ticks;
+    }
+    
+    /* Split the 32.32 product so it cannot overflow */
+    return (ticks >> 32) * mult + (((ticks & 0xFFFFFFFFu) * mult) >> 32);
+}
+
+/*
+ * OL_GT_SCHED_PREEMPTIVE threads are time-sliced by a per-scheduler-thread
+ * CPU-time timer that sends SIGURG to that thread. The handler only sets
+ * g_preempt_pending; the switch happens at the next safe point (see
+ * ol_gt_preempt_check(), which ol_gt_yield/spawn/resume and the I/O entry
+ * points also act as), never inside the handler. Elsewhere the slice is
+ * checked against the calibrated clock at the same safe points. A loop
+ * that reaches no safe point is not preempted at all.
+ */
+#if defined(__linux__)
+    #define OL_GT_SIGNAL_PREEMPTION 1
+#else
+    #define OL_GT_SIGNAL_PREEMPTION 0
+#endif
+
+#if OL_GT_SIGNAL_PREEMPTION
+
+/**
+ * @brief Set by the preemption timer, cleared on every switch
+ */
+static __thread volatile sig_atomic_t g_preempt_pending = 0;
+
+/**
+ * @brief Per-scheduler-thread preemption timer
+ */
+static __thread timer_t g_preempt_timer;
+static __thread bool g_preempt_timer_active = false;  /* Created */
+static __thread bool g_preempt_timer_armed = false;   /* Ticking */
+
+/**
+ * @brief OL_GT_SCHED_PREEMPTIVE threads spawned and not yet finished
+ * @note Process-wide because a stolen thread finishes on another scheduler;
+ *       each scheduler thread disarms its own timer once it sees zero
+ */
+static atomic_size_t g_preempt_live = ATOMIC_VAR_INIT(0);
+
+/**
+ * @brief SIGURG disposition before ours, for chaining
+ */
+static struct sigaction g_prev_sigurg;
+static atomic_flag g_sigurg_installed = ATOMIC_FLAG_INIT;
+
+static void ol_gt_sigurg_handler(int sig, siginfo_t* info, void* uctx) {
+    if (info && info->si_code == SI_TIMER) {
+        g_preempt_pending = 1;
+        return;
+    }
+    
+    /* Not ours (e.g. TCP urgent data): pass it on */
+    if (g_prev_sigurg.sa_flags & SA_SIGINFO) {
+        if (g_prev_sigurg.sa_sigaction) {
+            g_prev_sigurg.sa_sigaction(sig, info, uctx);
+        }
+    } else if (g_prev_sigurg.sa_handler != SIG_DFL && g_prev_sigurg.sa_handler != SIG_IGN) {
+        g_prev_sigurg.sa_handler(sig);
+    }
+}
+
+/**
+ * @brief Install the SIGURG handler (once per process)
+ */
+static void ol_gt_preempt_install(void) {
+    if (atomic_flag_test_and_set(&g_sigurg_installed)) {
+        return;
+    }
+    
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_sigaction = ol_gt_sigurg_handler;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    (void)sigaction(SIGURG, &sa, &g_prev_sigurg);
+}
+
+/**
+ * @brief Start (or re-time) this thread's preemption timer
+ *
+ * Armed lazily when the first preemptive thread is spawned here and
+ * disarmed by ol_gt_preempt_release() once none is live. It counts thread
+ * CPU time, so an idle scheduler thread is never signalled.
+ */
+static void ol_gt_preempt_timer_arm(void) {
+    if (!g_thread_scheduler) {
+        return;
+    }
+    
+    if (!g_preempt_timer_active) {
+        struct sigevent sev;
+        memset(&sev, 0, sizeof(sev));
+        sev.sigev_notify = SIGEV_THREAD_ID;
+        sev.sigev_signo = SIGURG;
+#if defined(sigev_notify_thread_id)
+        sev.sigev_notify_thread_id = (pid_t)syscall(SYS_gettid);
+#else
+        sev._sigev_un._tid = (pid_t)syscall(SYS_gettid);
+#endif
+        if (timer_create(CLOCK_THREAD_CPUTIME_ID, &sev, &g_preempt_timer) != 0) {
+            return;  /* Fall back to clock checks at safe points */
+        }
+        g_preempt_timer_active = true;
+    }
+    
+    uint64_t slice = g_thread_scheduler->preemption_slice_ns;
+    struct itimerspec its;
+    its.it_interval.tv_sec = (time_t)(slice / 1000000000ull);
+    its.it_interval.tv_nsec = (long)(slice % 1000000000ull);
+    its.it_value = its.it_interval;
+    g_preempt_timer_armed = timer_settime(g_preempt_timer, 0, &its, NULL) == 0;
+}
+
+/**
+ * @brief Stop this thread's timer without deleting it
+ *
+ * A CPU-time timer keeps firing while the thread runs anything, so it is
+ * disarmed once no preemptive thread is left to slice.
+ */
+static void ol_gt_preempt_timer_disarm(void) {
+    if (g_preempt_timer_armed) {
+        struct itimerspec its;
+        memset(&its, 0, sizeof(its));
+        (void)timer_settime(g_preempt_timer, 0, &its, NULL);
+        g_preempt_timer_armed = false;
+    }
+    g_preempt_pending = 0;
+}
+
+static void ol_gt_preempt_timer_delete(void) {
+    if (g_preempt_timer_active) {
+        (void)timer_delete(g_preempt_timer);
+        g_preempt_timer_active = false;
+        g_preempt_timer_armed = false;
+    }
+    g_preempt_pending = 0;
+}
+
+/**
+ * @brief Account for a finished thread; disarm once none are left
+ * @param gt Thread that just finished, or NULL to only check the count
+ */
+static void ol_gt_preempt_release(const ol_gt_t* gt) {
+    if (gt && gt->sched_policy == OL_GT_SCHED_PREEMPTIVE) {
+        atomic_fetch_sub_explicit(&g_preempt_live, 1, memory_order_relaxed);
+    }
+    if (g_preempt_timer_armed &&
+        atomic_load_explicit(&g_preempt_live, memory_order_relaxed) == 0) {
+        ol_gt_preempt_timer_disarm();
+    }
+}
+
+#endif /* OL_GT_SIGNAL_PREEMPTION */
+
+/* ==================== Scheduler Implementation ==================== */
+
+/**
+ * @brief Initialize thread-local scheduler
+ */
+static OL_NO_INLINE int ol_gt_scheduler_init_thread_local(void) {
+    if (g_thread_scheduler) {
         return 0;  /* Already initialized */
     }
     
@@ -1263,6 +1260,14 @@ static OL_NO_INLINE int ol_gt_scheduler_init_thread_local(void) {
     /* Set default preemption slice */
     g_thread_scheduler->preemption_slice_ns = OL_DEFAULT_PREEMPTION_SLICE_NS;
     
+#if OL_PLATFORM_WINDOWS
+    /* The root context must itself be a fiber to switch to others */
+    g_thread_scheduler->scheduler_fiber = ConvertThreadToFiber(NULL);
+    if (!g_thread_scheduler->scheduler_fiber) {
+        g_thread_scheduler->scheduler_fiber = GetCurrentFiber();
+    }
+#endif
+    
     /* Enable features by default */
     g_thread_scheduler->work_stealing_enabled = true;
     g_thread_scheduler->lazy_allocation_enabled = true;
@@ -1316,72 +1321,655 @@ static OL_NO_INLINE void* ol_gt_work_steal(void) {
                 }
             }
         }
-        other = other->next;
+        other = other->next;
+    }
+    
+    return NULL;
+}
+
+/**
+ * @brief Check whether the current thread's time slice has expired
+ */
+static OL_FORCE_INLINE bool ol_gt_should_preempt(void) {
+    if (!g_thread_scheduler || !g_thread_scheduler->current ||
+        g_thread_scheduler->current->sched_policy == OL_GT_SCHED_COOPERATIVE) {
+        return false;
+    }
+    
+#if OL_GT_SIGNAL_PREEMPTION
+    /* Preemptive threads are sliced by the timer (CPU time) */
+    if (g_thread_scheduler->current->sched_policy == OL_GT_SCHED_PREEMPTIVE &&
+        g_preempt_timer_armed) {
+        return g_preempt_pending != 0;
+    }
+#endif
+    
+    /* Hybrid: check the slice against the calibrated clock */
+    uint64_t last_preemption = atomic_load_explicit(&g_thread_scheduler->last_preemption,
+                                                   memory_order_relaxed);
+    uint64_t elapsed_ns = ol_gt_ticks_to_ns(ol_gt_clock_ticks() - last_preemption);
+    return elapsed_ns >= g_thread_scheduler->preemption_slice_ns;
+}
+
+/**
+ * @brief Start a fresh time slice for the thread being switched in
+ */
+static OL_FORCE_INLINE void ol_gt_slice_start(void) {
+    atomic_store_explicit(&g_thread_scheduler->last_preemption, ol_gt_clock_ticks(),
+                         memory_order_relaxed);
+#if OL_GT_SIGNAL_PREEMPTION
+    g_preempt_pending = 0;
+#endif
+}
+
+/**
+ * @brief Put a runnable thread at the back of its priority's run queue
+ */
+static void ol_gt_enqueue(ol_gt_scheduler_t* sched, ol_gt_t* gt) {
+    int priority = (int)gt->priority;
+    if (priority < OL_GT_PRIORITY_IDLE) priority = OL_GT_PRIORITY_IDLE;
+    if (priority > OL_GT_PRIORITY_REALTIME) priority = OL_GT_PRIORITY_REALTIME;
+    
+    if (ol_work_stealing_queue_push(&sched->queues[priority], gt)) {
+        return;
+    }
+    
+    /* Deque full: keep it on the (unstealable) overflow list */
+    gt->next = NULL;
+    if (sched->overflow_tail) {
+        sched->overflow_tail->next = gt;
+    } else {
+        sched->overflow_head = gt;
+    }
+    sched->overflow_tail = gt;
+}
+
+/**
+ * @brief Make a parked thread runnable on this thread's scheduler
+ *
+ * A thread that is still running (about to park, or running on another
+ * OS thread) is flagged instead, and requeued as soon as it parks.
+ *
+ * @return true if gt was parked and is now queued
+ */
+static bool ol_gt_wake(ol_gt_scheduler_t* sched, ol_gt_t* gt) {
+    uint_fast32_t state = atomic_load_explicit(&gt->state, memory_order_acquire);
+    
+    for (;;) {
+        if (state == OL_GT_STATE_WAITING || state == OL_GT_STATE_SLEEPING) {
+            if (atomic_compare_exchange_weak_explicit(&gt->state, &state, OL_GT_STATE_READY,
+                                                      memory_order_acq_rel,
+                                                      memory_order_acquire)) {
+                ol_gt_enqueue(sched, gt);
+                return true;
+            }
+            continue;
+        }
+        
+        if (state != OL_GT_STATE_RUNNING) {
+            return false;  /* Already queued, or finished */
+        }
+        
+        atomic_store_explicit(&gt->wake_pending, true, memory_order_seq_cst);
+        state = atomic_load_explicit(&gt->state, memory_order_seq_cst);
+        if (state == OL_GT_STATE_RUNNING) {
+            return false;
+        }
+    }
+}
+
+/**
+ * @brief Switch the running green thread out to the root context
+ *
+ * The root context stores state once this stack is no longer in use:
+ * READY requeues the thread, WAITING/SLEEPING park it until woken, and
+ * DONE/CANCELED retire it. Returns when the thread is next switched in.
+ */
+static OL_NO_INLINE void ol_gt_switch_out(ol_gt_t* gt, uint32_t state) {
+    ol_gt_scheduler_t* sched = g_thread_scheduler;
+    sched->exit_state = state;
+    
+#if OL_PLATFORM_WINDOWS
+    (void)gt;
+    SwitchToFiber(sched->scheduler_fiber);
+#else
+    ol_gt_ctx_swap(&gt->context.stack_ptr, sched->root_sp);
+#endif
+}
+
+static int ol_gt_materialize(ol_gt_t* gt, size_t stack_size);
+
+/**
+ * @brief Run gt from the root context until it yields, parks or finishes
+ */
+static void ol_gt_run(ol_gt_scheduler_t* sched, ol_gt_t* gt) {
+    uint_fast32_t state = atomic_load_explicit(&gt->state, memory_order_acquire);
+    
+    if (state == OL_GT_STATE_LAZY) {
+        /* Canceled before it ever ran: no stack needed */
+        if (atomic_load_explicit(&gt->cancel_flag, memory_order_acquire)) {
+            atomic_store_explicit(&gt->state, OL_GT_STATE_CANCELED, memory_order_release);
+#if OL_GT_SIGNAL_PREEMPTION
+            ol_gt_preempt_release(gt);
+#endif
+            return;
+        }
+        if (ol_gt_materialize(gt, gt->stack_size) != 0) {
+            ol_gt_enqueue(sched, gt);  /* Out of stacks: retry on a later pass */
+            return;
+        }
+    } else if (state != OL_GT_STATE_READY) {
+        return;
+    }
+    
+    sched->current = gt;
+    atomic_store_explicit(&gt->wake_pending, false, memory_order_relaxed);
+    atomic_store_explicit(&gt->state, OL_GT_STATE_RUNNING, memory_order_release);
+    atomic_store_explicit(&gt->last_run_time, (int_fast64_t)ol_gt_clock_ticks(),
+                          memory_order_relaxed);
+    atomic_fetch_add_explicit(&gt->stats.context_switches, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&g_global_stats.context_switches, 1, memory_order_relaxed);
+    ol_gt_slice_start();
+    
+#if OL_PLATFORM_WINDOWS
+    SwitchToFiber(gt->fiber);
+#else
+    ol_gt_ctx_swap(&sched->root_sp, gt->context.stack_ptr);
+#endif
+    
+    /* Back in the root context: gt's stack is idle now */
+    sched->current = NULL;
+    uint32_t exit_state = sched->exit_state;
+    atomic_store_explicit(&gt->state, exit_state, memory_order_seq_cst);
+    
+    if (exit_state == OL_GT_STATE_READY) {
+        ol_gt_enqueue(sched, gt);
+    } else if ((exit_state == OL_GT_STATE_WAITING || exit_state == OL_GT_STATE_SLEEPING) &&
+               atomic_exchange_explicit(&gt->wake_pending, false, memory_order_seq_cst)) {
+        /* Woken before it finished parking */
+        uint_fast32_t parked = exit_state;
+        if (atomic_compare_exchange_strong_explicit(&gt->state, &parked, OL_GT_STATE_READY,
+                                                    memory_order_acq_rel,
+                                                    memory_order_acquire)) {
+            ol_gt_enqueue(sched, gt);
+        }
+    }
+    
+#if OL_GT_SIGNAL_PREEMPTION
+    /* Also disarms here when the last preemptive thread ended elsewhere */
+    ol_gt_preempt_release((exit_state == OL_GT_STATE_DONE ||
+                           exit_state == OL_GT_STATE_CANCELED) ? gt : NULL);
+#endif
+}
+
+/**
+ * @brief Check whether any thread is queued to run on this thread
+ */
+static bool ol_gt_has_runnable(void) {
+    if (!g_thread_scheduler) {
+        return false;
+    }
+    
+    for (int i = 0; i < 5; i++) {
+        if (!ol_work_stealing_queue_empty(&g_thread_scheduler->queues[i])) {
+            return true;
+        }
+    }
+    
+    return g_thread_scheduler->overflow_head != NULL;
+}
+
+/**
+ * @brief Hand the CPU to the next ready thread of equal or higher priority
+ *
+ * The current thread goes to the back of its queue. With nobody to hand
+ * over to it just starts a new slice.
+ */
+static OL_NO_INLINE void ol_gt_preempt_current(void) {
+    ol_gt_t* current = g_thread_scheduler->current;
+    bool contended = false;
+    
+    for (int priority = OL_GT_PRIORITY_REALTIME;
+         priority >= (int)current->priority && !contended; priority--) {
+        contended = !ol_work_stealing_queue_empty(&g_thread_scheduler->queues[priority]);
+    }
+    
+    if (!contended) {
+        ol_gt_slice_start();
+        return;
+    }
+    
+    /* Update statistics */
+    atomic_fetch_add_explicit(&g_global_stats.preemptive_yields, 1, memory_order_relaxed);
+    if (g_thread_scheduler->statistics_enabled) {
+        atomic_fetch_add_explicit(&current->stats.preemptive_yields, 1, memory_order_relaxed);
+    }
+    
+    ol_gt_switch_out(current, OL_GT_STATE_READY);
+}
+
+/* ==================== Netpoller ==================== */
+
+#if OL_PLATFORM_POSIX
+
+/**
+ * @brief A thread parked on an fd and/or a deadline
+ * @note Lives on the parked thread's stack; detached before it is woken
+ */
+typedef struct {
+    ol_gt_t* gt;                /**< Parked green thread (NULL outside one) */
+    int fd;                     /**< Awaited fd (-1 for a pure sleep) */
+    int64_t deadline_ns;        /**< Wake-up time (0 = none) */
+    size_t heap_index;          /**< Slot in the timer heap (SIZE_MAX = none) */
+    bool fired;                 /**< Woken (ready, timed out or closed) */
+    int error;                  /**< 0 when ready, else ETIMEDOUT or EBADF */
+} ol_gt_waiter_t;
+
+/**
+ * @brief Netpoller state for one fd
+ */
+typedef struct {
+    ol_gt_waiter_t* rd;         /**< Waiting to read or accept */
+    ol_gt_waiter_t* wr;         /**< Waiting to write or connect */
+    bool known;                 /**< Already switched to O_NONBLOCK */
+    bool registered;            /**< Present in the poller */
+} ol_gt_pollfd_t;
+
+/**
+ * @brief Per-scheduler-thread netpoller
+ *
+ * Registrations are oneshot and tagged with the fd; an fd stays in the
+ * poller (disarmed) between waits so the next wait is a single re-arm.
+ */
+typedef struct {
+    ol_poller_t* poller;        /**< Readiness backend */
+    ol_gt_pollfd_t* fds;        /**< Indexed by fd */
+    size_t fd_cap;              /**< Entries in fds */
+    ol_gt_waiter_t** timers;    /**< Min-heap on deadline_ns */
+    size_t timer_count;         /**< Entries in timers */
+    size_t timer_cap;           /**< Capacity of timers */
+    size_t io_waiters;          /**< Waiters parked on an fd */
+} ol_gt_netpoll_t;
+
+/**
+ * @brief Thread-local netpoller, created on first blocking-style call
+ */
+static __thread ol_gt_netpoll_t* g_thread_netpoll = NULL;
+
+/**
+ * @brief Get (creating if needed) this thread's netpoller
+ */
+static ol_gt_netpoll_t* ol_gt_netpoll_get(void) {
+    if (OL_LIKELY(g_thread_netpoll != NULL)) {
+        return g_thread_netpoll;
+    }
+    
+    ol_gt_netpoll_t* np = (ol_gt_netpoll_t*)calloc(1, sizeof(ol_gt_netpoll_t));
+    if (!np) {
+        errno = ENOMEM;
+        return NULL;
+    }
+    
+    np->poller = ol_poller_create();
+    if (!np->poller) {
+        free(np);
+        return NULL;
+    }
+    
+    g_thread_netpoll = np;
+    return np;
+}
+
+/**
+ * @brief Destroy this thread's netpoller (no thread may be parked on it)
+ */
+static void ol_gt_netpoll_destroy(void) {
+    ol_gt_netpoll_t* np = g_thread_netpoll;
+    if (!np) {
+        return;
+    }
+    
+    ol_poller_destroy(np->poller);
+    free(np->fds);
+    free(np->timers);
+    free(np);
+    g_thread_netpoll = NULL;
+}
+
+/**
+ * @brief Get the state for fd, switching it to non-blocking on first use
+ * @param nonblocking fd is known to be non-blocking already (skips fcntl)
+ */
+static ol_gt_pollfd_t* ol_gt_netpoll_fd(ol_gt_netpoll_t* np, int fd, bool nonblocking) {
+    if (fd < 0) {
+        errno = EBADF;
+        return NULL;
+    }
+    
+    if ((size_t)fd >= np->fd_cap) {
+        size_t cap = np->fd_cap ? np->fd_cap : 64;
+        while (cap <= (size_t)fd) {
+            cap *= 2;
+        }
+        
+        ol_gt_pollfd_t* fds = (ol_gt_pollfd_t*)realloc(np->fds, cap * sizeof(ol_gt_pollfd_t));
+        if (!fds) {
+            errno = ENOMEM;
+            return NULL;
+        }
+        memset(fds + np->fd_cap, 0, (cap - np->fd_cap) * sizeof(ol_gt_pollfd_t));
+        np->fds = fds;
+        np->fd_cap = cap;
+    }
+    
+    ol_gt_pollfd_t* pfd = &np->fds[fd];
+    if (!pfd->known) {
+        if (!nonblocking) {
+            int flags = fcntl(fd, F_GETFL, 0);
+            if (flags < 0 ||
+                (!(flags & O_NONBLOCK) && fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0)) {
+                return NULL;
+            }
+        }
+        pfd->known = true;
+    }
+    
+    return pfd;
+}
+
+/**
+ * @brief Swap two timer heap slots
+ */
+static OL_FORCE_INLINE void ol_gt_timer_swap(ol_gt_netpoll_t* np, size_t a, size_t b) {
+    ol_gt_waiter_t* t = np->timers[a];
+    np->timers[a] = np->timers[b];
+    np->timers[b] = t;
+    np->timers[a]->heap_index = a;
+    np->timers[b]->heap_index = b;
+}
+
+/**
+ * @brief Restore heap order around slot i
+ */
+static void ol_gt_timer_fix(ol_gt_netpoll_t* np, size_t i) {
+    while (i > 0 && np->timers[i]->deadline_ns < np->timers[(i - 1) / 2]->deadline_ns) {
+        ol_gt_timer_swap(np, i, (i - 1) / 2);
+        i = (i - 1) / 2;
+    }
+    
+    for (;;) {
+        size_t l = 2 * i + 1;
+        size_t m = i;
+        if (l < np->timer_count && np->timers[l]->deadline_ns < np->timers[m]->deadline_ns) {
+            m = l;
+        }
+        if (l + 1 < np->timer_count && np->timers[l + 1]->deadline_ns < np->timers[m]->deadline_ns) {
+            m = l + 1;
+        }
+        if (m == i) {
+            break;
+        }
+        ol_gt_timer_swap(np, i, m);
+        i = m;
+    }
+}
+
+static int ol_gt_timer_push(ol_gt_netpoll_t* np, ol_gt_waiter_t* w) {
+    if (np->timer_count == np->timer_cap) {
+        size_t cap = np->timer_cap ? np->timer_cap * 2 : 16;
+        ol_gt_waiter_t** timers = (ol_gt_waiter_t**)realloc(np->timers, cap * sizeof(ol_gt_waiter_t*));
+        if (!timers) {
+            return -1;
+        }
+        np->timers = timers;
+        np->timer_cap = cap;
+    }
+    
+    w->heap_index = np->timer_count;
+    np->timers[np->timer_count++] = w;
+    ol_gt_timer_fix(np, w->heap_index);
+    return 0;
+}
+
+static void ol_gt_timer_remove(ol_gt_netpoll_t* np, ol_gt_waiter_t* w) {
+    size_t i = w->heap_index;
+    size_t last = --np->timer_count;
+    
+    if (i != last) {
+        np->timers[i] = np->timers[last];
+        np->timers[i]->heap_index = i;
+        ol_gt_timer_fix(np, i);
+    }
+    w->heap_index = SIZE_MAX;
+}
+
+/**
+ * @brief (Re-)arm fd for the directions that still have a waiter
+ */
+static int ol_gt_netpoll_arm(ol_gt_netpoll_t* np, int fd) {
+    ol_gt_pollfd_t* pfd = &np->fds[fd];
+    uint32_t mask = (pfd->rd ? OL_POLL_IN : 0) | (pfd->wr ? OL_POLL_OUT : 0);
+    if (mask == 0) {
+        return 0;  /* Oneshot: stays disarmed until the next wait */
+    }
+    
+    mask |= OL_POLL_ONESHOT;
+    int rc = pfd->registered ? ol_poller_mod(np->poller, fd, mask, (uint64_t)fd)
+                             : ol_poller_add(np->poller, fd, mask, (uint64_t)fd);
+    if (rc != OL_SUCCESS) {
+        /* fd was closed and reused without ol_gt_close() */
+        rc = pfd->registered ? ol_poller_add(np->poller, fd, mask, (uint64_t)fd)
+                             : ol_poller_mod(np->poller, fd, mask, (uint64_t)fd);
+    }
+    
+    pfd->registered = (rc == OL_SUCCESS);
+    return pfd->registered ? 0 : -1;
+}
+
+/**
+ * @brief Detach a waiter and make its thread runnable
+ */
+static void ol_gt_netpoll_wake(ol_gt_netpoll_t* np, ol_gt_waiter_t* w, int error) {
+    w->fired = true;
+    w->error = error;
+    
+    if (w->heap_index != SIZE_MAX) {
+        ol_gt_timer_remove(np, w);
+    }
+    
+    if (w->fd >= 0) {
+        ol_gt_pollfd_t* pfd = &np->fds[w->fd];
+        if (pfd->rd == w) {
+            pfd->rd = NULL;
+        } else {
+            pfd->wr = NULL;
+        }
+        np->io_waiters--;
+    }
+    
+    /* A thread polling for itself sees fired when the poll returns */
+    if (w->gt && w->gt != g_thread_scheduler->current) {
+        ol_gt_wake(g_thread_scheduler, w->gt);
+    }
+}
+
+/**
+ * @brief Collect readiness and expired timers, waking their threads
+ * @param block Wait for the first event or timer instead of just polling
+ */
+static void ol_gt_netpoll_poll(ol_gt_netpoll_t* np, bool block) {
+    ol_poll_event_t events[64];
+    ol_deadline_t dl = { 1 };  /* Already expired: don't wait */
+    
+    if (block && np->timer_count > 0) {
+        dl.when_ns = np->timers[0]->deadline_ns;
+    } else if (block && np->io_waiters > 0) {
+        dl.when_ns = 0;  /* No timer: wait for readiness only */
+    }
+    
+    if (np->io_waiters > 0 || dl.when_ns != 1) {
+        int n = ol_poller_wait(np->poller, dl, events, 64);
+        for (int i = 0; i < n; i++) {
+            int fd = (int)events[i].tag;
+            if ((size_t)fd >= np->fd_cap) {
+                continue;
+            }
+            
+            ol_gt_pollfd_t* pfd = &np->fds[fd];
+            uint32_t mask = events[i].mask;
+            if (pfd->rd && (mask & (OL_POLL_IN | OL_POLL_ERR))) {
+                ol_gt_netpoll_wake(np, pfd->rd, 0);
+            }
+            if (pfd->wr && (mask & (OL_POLL_OUT | OL_POLL_ERR))) {
+                ol_gt_netpoll_wake(np, pfd->wr, 0);
+            }
+            ol_gt_netpoll_arm(np, fd);
+        }
     }
     
-    return NULL;
+    if (np->timer_count > 0) {
+        int64_t now = ol_monotonic_now_ns();
+        while (np->timer_count > 0 && np->timers[0]->deadline_ns <= now) {
+            ol_gt_waiter_t* w = np->timers[0];
+            ol_gt_netpoll_wake(np, w, ETIMEDOUT);
+            if (w->fd >= 0) {
+                ol_gt_netpoll_arm(np, w->fd);
+            }
+        }
+    }
 }
 
 /**
- * @brief Hybrid scheduler - check for preemption
+ * @brief Park the calling thread until fd is ready or the deadline passes
+ *
+ * A parked green thread is in no run queue; the root context polls
+ * between the threads it runs and requeues it when its fd or deadline
+ * fires. Called from the root context itself, this runs other threads
+ * while polling, blocking in the poller only once nothing is runnable.
+ *
+ * @param fd fd to wait on (-1 = deadline only)
+ * @param write Wait for writability rather than readability
+ * @return 0 when ready, else an errno value
  */
-static OL_FORCE_INLINE bool ol_gt_should_preempt(void) {
-    if (!g_thread_scheduler || 
-        g_thread_scheduler->current->sched_policy != OL_GT_SCHED_HYBRID) {
-        return false;
+static int ol_gt_netpoll_wait(ol_gt_netpoll_t* np, int fd, bool write, int64_t deadline_ns) {
+    if (deadline_ns > 0 && deadline_ns <= ol_monotonic_now_ns()) {
+        return ETIMEDOUT;
     }
     
-    /* Check if time slice expired */
-    uint64_t now = ol_rdtsc();
-    uint64_t last_preemption = atomic_load_explicit(&g_thread_scheduler->last_preemption, 
-                                                   memory_order_relaxed);
-    
-    /* Convert TSC to nanoseconds (approximate) */
-    uint64_t elapsed_ns = (now - last_preemption) / 3;  /* ~3GHz CPU assumption */
+    ol_gt_waiter_t w = {
+        .gt = g_thread_scheduler ? g_thread_scheduler->current : NULL,
+        .fd = fd,
+        .deadline_ns = deadline_ns,
+        .heap_index = SIZE_MAX,
+    };
     
-    if (elapsed_ns >= g_thread_scheduler->preemption_slice_ns) {
-        atomic_store_explicit(&g_thread_scheduler->last_preemption, now, 
-                             memory_order_relaxed);
-        
-        /* Update statistics */
-        atomic_fetch_add_explicit(&g_global_stats.preemptive_yields, 1, memory_order_relaxed);
-        if (g_thread_scheduler->statistics_enabled && g_thread_scheduler->current) {
-            atomic_fetch_add_explicit(&g_thread_scheduler->current->stats.preemptive_yields, 
-                                     1, memory_order_relaxed);
+    if (fd >= 0) {
+        ol_gt_pollfd_t* pfd = &np->fds[fd];
+        ol_gt_waiter_t** slot = write ? &pfd->wr : &pfd->rd;
+        if (*slot) {
+            return EBUSY;
         }
         
-        return true;
+        *slot = &w;
+        if (ol_gt_netpoll_arm(np, fd) != 0) {
+            *slot = NULL;
+            return errno ? errno : EBADF;
+        }
+        np->io_waiters++;
+    }
+    
+    if (deadline_ns > 0 && ol_gt_timer_push(np, &w) != 0) {
+        if (fd >= 0) {
+            ol_gt_netpoll_wake(np, &w, ENOMEM);
+        }
+        return ENOMEM;
+    }
+    
+    if (w.gt) {
+        /* Spurious wake-ups (ol_gt_resume()) just park again */
+        while (!w.fired) {
+            ol_gt_switch_out(w.gt, fd >= 0 ? OL_GT_STATE_WAITING : OL_GT_STATE_SLEEPING);
+        }
+    } else {
+        while (!w.fired) {
+            ol_gt_netpoll_poll(np, !ol_gt_has_runnable());
+            if (!w.fired) {
+                ol_gt_yield();
+            }
+        }
     }
     
-    return false;
+    return w.error;
 }
 
+#endif /* OL_PLATFORM_POSIX */
+
+/* ==================== Scheduler Loop ==================== */
+
 /**
  * @brief Select next thread to run based on priority
+ *
+ * Collects netpoller readiness first (without blocking) so threads whose
+ * I/O or sleep finished compete in this same pass.
  */
 static OL_NO_INLINE ol_gt_t* ol_gt_scheduler_select_next(void) {
     if (!g_thread_scheduler) {
         return NULL;
     }
     
-    /* Try to get task from work-stealing queues (highest priority first) */
+#if OL_PLATFORM_POSIX
+    if (g_thread_netpoll) {
+        ol_gt_netpoll_poll(g_thread_netpoll, false);
+    }
+#endif
+    
+    /* Own queues first (highest priority first) */
     for (int priority = OL_GT_PRIORITY_REALTIME; priority >= OL_GT_PRIORITY_IDLE; priority--) {
-        /* First try local queue */
-        void* task = ol_work_stealing_queue_pop(&g_thread_scheduler->queues[priority]);
+        void* task = ol_work_stealing_queue_take(&g_thread_scheduler->queues[priority]);
         if (task) {
             return (ol_gt_t*)task;
         }
-        
-        /* If work stealing enabled, try to steal */
-        if (g_thread_scheduler->work_stealing_enabled) {
-            task = ol_gt_work_steal();
-            if (task) {
-                return (ol_gt_t*)task;
-            }
+    }
+    
+    ol_gt_t* overflow = g_thread_scheduler->overflow_head;
+    if (overflow) {
+        g_thread_scheduler->overflow_head = overflow->next;
+        if (!overflow->next) {
+            g_thread_scheduler->overflow_tail = NULL;
         }
+        overflow->next = NULL;
+        return overflow;
     }
     
-    return NULL;
+    /* If work stealing enabled, try to steal */
+    return (ol_gt_t*)ol_gt_work_steal();
+}
+
+/**
+ * @brief Run one ready thread from the root context
+ * @param block With nothing ready, wait in the netpoller for the first
+ *        readiness event or the next timer before giving up
+ * @return true if a thread ran
+ */
+static bool ol_gt_schedule_once(bool block) {
+    ol_gt_t* next = ol_gt_scheduler_select_next();
+    
+#if OL_PLATFORM_POSIX
+    ol_gt_netpoll_t* np = g_thread_netpoll;
+    if (!next && block && np && (np->io_waiters > 0 || np->timer_count > 0)) {
+        ol_gt_netpoll_poll(np, true);
+        next = ol_gt_scheduler_select_next();
+    }
+#else
+    (void)block;
+#endif
+    
+    if (!next) {
+        return false;
+    }
+    
+    ol_gt_run(g_thread_scheduler, next);
+    return true;
 }
 
 /* ==================== Original API Implementation ==================== */
@@ -1402,6 +1990,12 @@ int ol_gt_scheduler_init(void) {
     OL_PAGE_SIZE = sys_info.dwPageSize;
 #endif
     
+    /* Calibrate the slice clock and install the preemption signal handler */
+    ol_gt_tsc_calibrate();
+#if OL_GT_SIGNAL_PREEMPTION
+    ol_gt_preempt_install();
+#endif
+    
     /* Initialize thread-local scheduler */
     return ol_gt_scheduler_init_thread_local();
 }
@@ -1446,6 +2040,16 @@ void ol_gt_scheduler_shutdown(void) {
     /* Destroy stack pool */
     ol_stack_pool_destroy(&g_thread_scheduler->stack_pool);
     
+#if OL_PLATFORM_POSIX
+    /* Destroy netpoller */
+    ol_gt_netpoll_destroy();
+#endif
+    
+#if OL_GT_SIGNAL_PREEMPTION
+    /* Stop time-slicing this thread */
+    ol_gt_preempt_timer_delete();
+#endif
+    
     /* Free scheduler */
     ol_numa_free(g_thread_scheduler, sizeof(ol_gt_scheduler_t));
     g_thread_scheduler = NULL;
@@ -1456,39 +2060,30 @@ void ol_gt_scheduler_shutdown(void) {
 
 /**
  * @brief Trampoline function for green thread execution
+ * @note Never returns: the final switch hands the stack back to the root
  */
 static void OL_NO_INLINE ol_gt_trampoline(void* arg) {
     ol_gt_t* gt = (ol_gt_t*)arg;
-    
-    /* Update thread state */
-    atomic_store_explicit(&gt->state, OL_GT_STATE_RUNNING, memory_order_release);
-    g_thread_scheduler->current = gt;
+    uint32_t final_state = OL_GT_STATE_CANCELED;
     
     /* Check for cancellation */
-    if (atomic_load_explicit(&gt->cancel_flag, memory_order_acquire)) {
-        atomic_store_explicit(&gt->state, OL_GT_STATE_CANCELED, memory_order_release);
-        g_thread_scheduler->current = NULL;
-        ol_gt_yield();
-        return;
+    if (!atomic_load_explicit(&gt->cancel_flag, memory_order_acquire)) {
+        /* Update statistics */
+        uint64_t start_time = ol_gt_clock_ticks();
+        
+        /* Execute user function */
+        gt->entry(gt->arg);
+        
+        /* Update runtime statistics */
+        uint64_t end_time = ol_gt_clock_ticks();
+        uint64_t runtime = ol_gt_ticks_to_ns(end_time - start_time);
+        atomic_fetch_add_explicit(&gt->total_runtime, runtime, memory_order_relaxed);
+        
+        final_state = OL_GT_STATE_DONE;
     }
     
-    /* Update statistics */
-    uint64_t start_time = ol_rdtsc();
-    
-    /* Execute user function */
-    gt->entry(gt->arg);
-    
-    /* Update runtime statistics */
-    uint64_t end_time = ol_rdtsc();
-    uint64_t runtime = end_time - start_time;
-    atomic_fetch_add_explicit(&gt->total_runtime, runtime, memory_order_relaxed);
-    
-    /* Mark as done */
-    atomic_store_explicit(&gt->state, OL_GT_STATE_DONE, memory_order_release);
-    g_thread_scheduler->current = NULL;
-    
-    /* Yield to scheduler */
-    ol_gt_yield();
+    ol_gt_switch_out(gt, final_state);
+    abort();  /* A finished thread is never switched in again */
 }
 
 /**
@@ -1516,6 +2111,9 @@ static ol_gt_t* ol_gt_create_lazy(ol_gt_entry_fn entry, void* arg,
     gt->entry = entry;
     gt->arg = arg;
     
+    /* Requested stack size, used when the thread is materialized */
+    gt->stack_size = config ? config->stack_size : 0;
+    
     /* Set priority and scheduling policy */
     gt->priority = config ? config->priority : OL_GT_PRIORITY_NORMAL;
     gt->sched_policy = config ? config->sched_policy : OL_GT_SCHED_COOPERATIVE;
@@ -1526,6 +2124,7 @@ static ol_gt_t* ol_gt_create_lazy(ol_gt_entry_fn entry, void* arg,
     /* Initialize atomic fields */
     atomic_init(&gt->cancel_flag, false);
     atomic_init(&gt->cancel_requested, false);
+    atomic_init(&gt->wake_pending, false);
     atomic_init(&gt->stack_watermark, 0);
     atomic_init(&gt->last_run_time, 0);
     atomic_init(&gt->total_runtime, 0);
@@ -1559,6 +2158,7 @@ static int ol_gt_materialize(ol_gt_t* gt, size_t stack_size) {
     if (actual_stack_size > OL_MAX_STACK_SIZE) {
         actual_stack_size = OL_MAX_STACK_SIZE;
     }
+    actual_stack_size = ol_stack_pool_round(actual_stack_size);
     
     /* Allocate stack from pool */
     void* stack = ol_stack_pool_allocate(&g_thread_scheduler->stack_pool,
@@ -1576,8 +2176,8 @@ static int ol_gt_materialize(ol_gt_t* gt, size_t stack_size) {
     
     /* Create execution context */
 #if OL_PLATFORM_WINDOWS
-    /* Create fiber */
-    gt->fiber = CreateFiberEx(actual_stack_size, 0, 
+    /* Create fiber (reserve the whole stack, commit on demand) */
+    gt->fiber = CreateFiberEx(0, actual_stack_size, 
                              FIBER_FLAG_FLOAT_SWITCH,
                              (LPFIBER_START_ROUTINE)ol_gt_trampoline,
                              gt);
@@ -1588,7 +2188,7 @@ static int ol_gt_materialize(ol_gt_t* gt, size_t stack_size) {
     }
 #else
     /* Create assembly context */
-    ol_ctx_make(&gt->context, ol_gt_trampoline, gt, stack, actual_stack_size);
+    ol_ctx_make(gt, ol_gt_trampoline, gt, stack, actual_stack_size);
 #endif
     
     /* Update state */
@@ -1655,14 +2255,18 @@ ol_gt_t* ol_gt_spawn_ex(ol_gt_entry_fn entry, void* arg, const ol_gt_config_t* c
         }
     }
     
-    /* Add to scheduler queue */
-    if (atomic_load_explicit(&gt->state, memory_order_acquire) == OL_GT_STATE_READY) {
-        int priority = config ? config->priority : OL_GT_PRIORITY_NORMAL;
-        if (priority < 0) priority = 0;
-        if (priority > 4) priority = 4;
-        
-        ol_work_stealing_queue_push(&g_thread_scheduler->queues[priority], gt);
+    /* Add to scheduler queue (lazy threads get their stack when first run) */
+    ol_gt_enqueue(g_thread_scheduler, gt);
+    
+#if OL_GT_SIGNAL_PREEMPTION
+    /* First live preemptive thread here: start time-slicing this thread */
+    if (config && config->sched_policy == OL_GT_SCHED_PREEMPTIVE) {
+        atomic_fetch_add_explicit(&g_preempt_live, 1, memory_order_relaxed);
+        if (!g_preempt_timer_armed) {
+            ol_gt_preempt_timer_arm();
+        }
     }
+#endif
     
     /* Update statistics */
     atomic_fetch_add_explicit(&g_global_stats.total_spawned, 1, memory_order_relaxed);
@@ -1671,11 +2275,17 @@ ol_gt_t* ol_gt_spawn_ex(ol_gt_entry_fn entry, void* arg, const ol_gt_config_t* c
                                  1, memory_order_relaxed);
     }
     
+    /* Safe point: a spawning loop is not left to run past its slice */
+    ol_gt_preempt_check();
+    
     return gt;
 }
 
 /**
  * @brief Resume execution of a green thread
+ *
+ * Makes a parked thread runnable. From the root context (not inside a
+ * green thread) it then runs the scheduler until gt has had a turn.
  */
 int ol_gt_resume(ol_gt_t* gt) {
     if (!gt) {
@@ -1696,29 +2306,16 @@ int ol_gt_resume(ol_gt_t* gt) {
         return -1;
     }
     
-    /* Materialize lazy thread if needed */
-    if (state == OL_GT_STATE_LAZY) {
-        if (ol_gt_materialize(gt, OL_DEFAULT_STACK_SIZE) != 0) {
-            return -1;
-        }
-    }
-    
-    /* Check for cancellation */
-    if (atomic_load_explicit(&gt->cancel_flag, memory_order_acquire)) {
-        atomic_store_explicit(&gt->state, OL_GT_STATE_CANCELED, memory_order_release);
-        return -1;
-    }
-    
-    /* Update state */
-    atomic_store_explicit(&gt->state, OL_GT_STATE_READY, memory_order_release);
+    ol_gt_wake(g_thread_scheduler, gt);
     
-    /* Add to scheduler queue */
-    ol_work_stealing_queue_push(&g_thread_scheduler->queues[gt->priority], gt);
-    
-    /* Update statistics */
-    atomic_fetch_add_explicit(&g_global_stats.context_switches, 1, memory_order_relaxed);
-    if (g_thread_scheduler->statistics_enabled) {
-        atomic_fetch_add_explicit(&gt->stats.context_switches, 1, memory_order_relaxed);
+    if (!g_thread_scheduler->current) {
+        uint64_t runs = atomic_load_explicit(&gt->stats.context_switches, memory_order_relaxed);
+        while (atomic_load_explicit(&gt->stats.context_switches, memory_order_relaxed) == runs &&
+               ol_gt_is_alive(gt) && ol_gt_schedule_once(false)) {
+            /* Run others queued ahead of it */
+        }
+    } else {
+        ol_gt_preempt_check();  /* Safe point: gt may be waiting on us */
     }
     
     return 0;
@@ -1726,44 +2323,41 @@ int ol_gt_resume(ol_gt_t* gt) {
 
 /**
  * @brief Yield execution to another green thread
+ * @note From the root context this runs one ready thread, if any
  */
 void ol_gt_yield(void) {
-    if (!g_thread_scheduler || !g_thread_scheduler->current) {
+    if (!g_thread_scheduler) {
         return;
     }
     
     ol_gt_t* current = g_thread_scheduler->current;
-    
-    /* Update statistics */
-    atomic_fetch_add_explicit(&g_global_stats.voluntary_yields, 1, memory_order_relaxed);
-    if (g_thread_scheduler->statistics_enabled) {
-        atomic_fetch_add_explicit(&current->stats.voluntary_yields, 1, memory_order_relaxed);
+    if (!current) {
+        ol_gt_schedule_once(false);
+        return;
     }
     
-    /* Save current context */
-#if OL_PLATFORM_WINDOWS
-    /* Switch to scheduler fiber */
-    g_thread_scheduler->current = NULL;
-    SwitchToFiber(g_thread_scheduler->scheduler_fiber);
-#else
-    /* Save context and switch to scheduler */
-    ol_ctx_save(&current->context);
-    
-    /* Find next thread to run */
-    ol_gt_t* next = ol_gt_scheduler_select_next();
-    if (next) {
-        g_thread_scheduler->current = next;
-        atomic_store_explicit(&next->state, OL_GT_STATE_RUNNING, memory_order_release);
-        ol_ctx_restore(&next->context);
+    /* Safe point: with the slice already expired this is the preemption */
+    if (ol_gt_should_preempt()) {
+        atomic_fetch_add_explicit(&g_global_stats.preemptive_yields, 1, memory_order_relaxed);
+        if (g_thread_scheduler->statistics_enabled) {
+            atomic_fetch_add_explicit(&current->stats.preemptive_yields, 1, memory_order_relaxed);
+        }
+    } else {
+        atomic_fetch_add_explicit(&g_global_stats.voluntary_yields, 1, memory_order_relaxed);
+        if (g_thread_scheduler->statistics_enabled) {
+            atomic_fetch_add_explicit(&current->stats.voluntary_yields, 1, memory_order_relaxed);
+        }
     }
     
-    /* If no next thread, return to caller */
-    g_thread_scheduler->current = current;
-#endif
+    ol_gt_switch_out(current, OL_GT_STATE_READY);
 }
 
 /**
  * @brief Wait for a green thread to complete
+ *
+ * Inside a green thread this yields until gt finishes. In the root context
+ * it runs the scheduler, blocking in the netpoller when every thread is
+ * parked, and fails if gt can no longer make progress.
  */
 int ol_gt_join(ol_gt_t* gt) {
     if (!gt) {
@@ -1776,6 +2370,11 @@ int ol_gt_join(ol_gt_t* gt) {
         return -1;
     }
     
+    if (gt == g_thread_scheduler->current) {
+        atomic_store_explicit(&g_last_error, OL_GT_ERROR_INVALID_ARG, memory_order_relaxed);
+        return -1;
+    }
+    
     /* Wait for thread to complete */
     while (true) {
         ol_gt_state_t state = atomic_load_explicit(&gt->state, memory_order_acquire);
@@ -1784,11 +2383,21 @@ int ol_gt_join(ol_gt_t* gt) {
             break;
         }
         
-        /* Yield to other threads while waiting */
-        ol_gt_yield();
+        if (g_thread_scheduler->current) {
+            ol_gt_yield();
+            continue;
+        }
         
-        /* Check for timeout or other conditions */
-        // TODO: Add timeout mechanism
+        if (!ol_gt_schedule_once(true)) {
+            if (state == OL_GT_STATE_READY || state == OL_GT_STATE_RUNNING) {
+                OL_PAUSE();  /* Queued or running on another scheduler thread */
+                continue;
+            }
+            
+            /* Parked with nothing left that could wake it */
+            atomic_store_explicit(&g_last_error, OL_GT_ERROR_INTERNAL, memory_order_relaxed);
+            return -1;
+        }
     }
     
     /* Update statistics */
@@ -1809,7 +2418,9 @@ void ol_gt_destroy(ol_gt_t* gt) {
     if (atomic_load_explicit(&gt->state, memory_order_acquire) != OL_GT_STATE_DONE &&
         atomic_load_explicit(&gt->state, memory_order_acquire) != OL_GT_STATE_CANCELED) {
         ol_gt_cancel(gt);
-        ol_gt_join(gt);
+        if (ol_gt_join(gt) != 0) {
+            return;  /* Still parked: its stack may be referenced, so leak it */
+        }
     }
     
     /* Free stack if allocated */
@@ -1905,31 +2516,17 @@ int ol_gt_get_statistics(const ol_gt_t* gt, ol_gt_statistics_t* stats) {
     /* Add runtime information */
     stats->total_runtime_ns = atomic_load_explicit(&gt->total_runtime, memory_order_relaxed);
     
-    /* Add stack usage information */
-    if (gt->stack_base && gt->stack_limit) {
-        void* current_stack = NULL;
-        
-        /* Get current stack pointer (architecture specific) */
-        #if OL_ARCH_X86_64
-            asm volatile("mov %%rsp, %0" : "=r"(current_stack));
-        #elif OL_ARCH_AARCH64
-            asm volatile("mov %0, sp" : "=r"(current_stack));
-        #elif OL_ARCH_ARM
-            asm volatile("mov %0, sp" : "=r"(current_stack));
-        #endif
+    /* Stack usage is what is resident, not the reserved size */
+    if (gt->stack_base) {
+        size_t usage = ol_stack_resident(gt->stack_base, gt->stack_size);
+        stats->stack_usage = usage;
         
-        if (current_stack) {
-            size_t usage = (uintptr_t)gt->stack_limit - (uintptr_t)current_stack;
-            stats->stack_usage = usage;
-            
-            /* Update peak usage */
-            size_t watermark = atomic_load_explicit(&gt->stack_watermark, memory_order_relaxed);
-            if (usage > watermark) {
-                atomic_store_explicit(&gt->stack_watermark, usage, memory_order_relaxed);
-            }
-            stats->peak_stack_usage = atomic_load_explicit(&gt->stack_watermark, 
-                                                          memory_order_relaxed);
+        /* Update peak usage */
+        atomic_size_t* watermark = &((ol_gt_t*)gt)->stack_watermark;
+        if (usage > atomic_load_explicit(watermark, memory_order_relaxed)) {
+            atomic_store_explicit(watermark, usage, memory_order_relaxed);
         }
+        stats->peak_stack_usage = atomic_load_explicit(watermark, memory_order_relaxed);
     }
     
     stats->stack_size = gt->stack_size;
@@ -1974,7 +2571,23 @@ void ol_gt_enable_work_stealing(bool enabled) {
 void ol_gt_set_preemption_slice(uint64_t microseconds) {
     if (g_thread_scheduler) {
         g_thread_scheduler->preemption_slice_ns = microseconds * 1000;
+#if OL_GT_SIGNAL_PREEMPTION
+        if (g_preempt_timer_armed) {
+            ol_gt_preempt_timer_arm();
+        }
+#endif
+    }
+}
+
+/**
+ * @brief Preemption safe point
+ */
+void ol_gt_preempt_check(void) {
+    if (OL_LIKELY(!ol_gt_should_preempt())) {
+        return;
     }
+    
+    ol_gt_preempt_current();
 }
 
 /**
@@ -2124,6 +2737,245 @@ const char* ol_gt_get_build_config(void) {
     return config;
 }
 
+/* ==================== Blocking-Style I/O Implementation ==================== */
+
+#if OL_PLATFORM_POSIX
+
+/**
+ * @brief Read, parking on EAGAIN
+ */
+ptrdiff_t ol_gt_read(int fd, void* buf, size_t len, int64_t deadline_ns) {
+    ol_gt_preempt_check();  /* Safe point: a busy fd that is always ready never parks */
+    
+    ol_gt_netpoll_t* np = ol_gt_netpoll_get();
+    if (!np || !ol_gt_netpoll_fd(np, fd, false)) {
+        return -1;
+    }
+    
+    for (;;) {
+        ssize_t n = read(fd, buf, len);
+        if (n >= 0) {
+            return (ptrdiff_t)n;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            return -1;
+        }
+        
+        int err = ol_gt_netpoll_wait(np, fd, false, deadline_ns);
+        if (err) {
+            errno = err;
+            return -1;
+        }
+    }
+}
+
+/**
+ * @brief Write everything, parking whenever the fd is full
+ */
+ptrdiff_t ol_gt_write(int fd, const void* buf, size_t len, int64_t deadline_ns) {
+    ol_gt_preempt_check();
+    
+    ol_gt_netpoll_t* np = ol_gt_netpoll_get();
+    if (!np || !ol_gt_netpoll_fd(np, fd, false)) {
+        return -1;
+    }
+    
+    size_t done = 0;
+    while (done < len) {
+        ssize_t n = write(fd, (const char*)buf + done, len - done);
+        if (n >= 0) {
+            done += (size_t)n;
+            continue;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        
+        int err = (errno == EAGAIN || errno == EWOULDBLOCK)
+                  ? ol_gt_netpoll_wait(np, fd, true, deadline_ns)
+                  : errno;
+        if (err) {
+            errno = err;
+            return done > 0 ? (ptrdiff_t)done : -1;
+        }
+    }
+    
+    return (ptrdiff_t)done;
+}
+
+/**
+ * @brief Accept, parking until a connection is pending
+ */
+int ol_gt_accept(int fd, struct sockaddr* addr, uint32_t* addrlen, int64_t deadline_ns) {
+    ol_gt_preempt_check();
+    
+    ol_gt_netpoll_t* np = ol_gt_netpoll_get();
+    if (!np || !ol_gt_netpoll_fd(np, fd, false)) {
+        return -1;
+    }
+    
+    for (;;) {
+        socklen_t sl = addrlen ? (socklen_t)*addrlen : 0;
+#if defined(__linux__)
+        int conn = accept4(fd, addr, addrlen ? &sl : NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+#else
+        int conn = accept(fd, addr, addrlen ? &sl : NULL);
+        if (conn >= 0) {
+            (void)fcntl(conn, F_SETFD, FD_CLOEXEC);
+            (void)fcntl(conn, F_SETFL, fcntl(conn, F_GETFL, 0) | O_NONBLOCK);
+        }
+#endif
+        if (conn >= 0) {
+            if (addrlen) {
+                *addrlen = (uint32_t)sl;
+            }
+            
+            /* A reused fd number must not inherit the previous fd's state */
+            if ((size_t)conn < np->fd_cap) {
+                memset(&np->fds[conn], 0, sizeof(ol_gt_pollfd_t));
+            }
+            (void)ol_gt_netpoll_fd(np, conn, true);
+            return conn;
+        }
+        if (errno == EINTR || errno == ECONNABORTED) {
+            continue;
+        }
+        if (errno != EAGAIN && errno != EWOULDBLOCK) {
+            return -1;
+        }
+        
+        int err = ol_gt_netpoll_wait(np, fd, false, deadline_ns);
+        if (err) {
+            errno = err;
+            return -1;
+        }
+    }
+}
+
+/**
+ * @brief Connect, parking until the handshake completes
+ */
+int ol_gt_connect(int fd, const struct sockaddr* addr, uint32_t addrlen, int64_t deadline_ns) {
+    ol_gt_preempt_check();
+    
+    ol_gt_netpoll_t* np = ol_gt_netpoll_get();
+    if (!np || !ol_gt_netpoll_fd(np, fd, false)) {
+        return -1;
+    }
+    
+    if (connect(fd, addr, (socklen_t)addrlen) == 0) {
+        return 0;
+    }
+    
+    /* EINTR leaves the handshake running, just like EINPROGRESS */
+    if (errno != EINPROGRESS && errno != EINTR) {
+        return -1;
+    }
+    
+    int err = ol_gt_netpoll_wait(np, fd, true, deadline_ns);
+    if (!err) {
+        socklen_t sl = sizeof(err);
+        if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &err, &sl) != 0) {
+            return -1;
+        }
+    }
+    
+    if (err) {
+        errno = err;
+        return -1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Sleep on the netpoller's timer heap
+ */
+int ol_gt_sleep_until(int64_t deadline_ns) {
+    if (deadline_ns <= ol_monotonic_now_ns()) {
+        return 0;
+    }
+    
+    ol_gt_netpoll_t* np = ol_gt_netpoll_get();
+    if (!np) {
+        return -1;
+    }
+    
+    int err = ol_gt_netpoll_wait(np, -1, false, deadline_ns);
+    if (err && err != ETIMEDOUT) {
+        errno = err;
+        return -1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief Wake waiters with EBADF, forget the fd and close it
+ */
+int ol_gt_close(int fd) {
+    ol_gt_netpoll_t* np = g_thread_netpoll;
+    
+    if (np && fd >= 0 && (size_t)fd < np->fd_cap) {
+        ol_gt_pollfd_t* pfd = &np->fds[fd];
+        if (pfd->rd) {
+            ol_gt_netpoll_wake(np, pfd->rd, EBADF);
+        }
+        if (pfd->wr) {
+            ol_gt_netpoll_wake(np, pfd->wr, EBADF);
+        }
+        if (pfd->registered) {
+            (void)ol_poller_del(np->poller, fd);
+        }
+        memset(pfd, 0, sizeof(ol_gt_pollfd_t));
+    }
+    
+    return close(fd);
+}
+
+#else /* !OL_PLATFORM_POSIX */
+
+ptrdiff_t ol_gt_read(int fd, void* buf, size_t len, int64_t deadline_ns) {
+    (void)fd; (void)buf; (void)len; (void)deadline_ns;
+    atomic_store_explicit(&g_last_error, OL_GT_ERROR_PLATFORM_UNSUPPORTED, memory_order_relaxed);
+    return -1;
+}
+
+ptrdiff_t ol_gt_write(int fd, const void* buf, size_t len, int64_t deadline_ns) {
+    (void)fd; (void)buf; (void)len; (void)deadline_ns;
+    atomic_store_explicit(&g_last_error, OL_GT_ERROR_PLATFORM_UNSUPPORTED, memory_order_relaxed);
+    return -1;
+}
+
+int ol_gt_accept(int fd, struct sockaddr* addr, uint32_t* addrlen, int64_t deadline_ns) {
+    (void)fd; (void)addr; (void)addrlen; (void)deadline_ns;
+    atomic_store_explicit(&g_last_error, OL_GT_ERROR_PLATFORM_UNSUPPORTED, memory_order_relaxed);
+    return -1;
+}
+
+int ol_gt_connect(int fd, const struct sockaddr* addr, uint32_t addrlen, int64_t deadline_ns) {
+    (void)fd; (void)addr; (void)addrlen; (void)deadline_ns;
+    atomic_store_explicit(&g_last_error, OL_GT_ERROR_PLATFORM_UNSUPPORTED, memory_order_relaxed);
+    return -1;
+}
+
+int ol_gt_sleep_until(int64_t deadline_ns) {
+    (void)deadline_ns;
+    atomic_store_explicit(&g_last_error, OL_GT_ERROR_PLATFORM_UNSUPPORTED, memory_order_relaxed);
+    return -1;
+}
+
+int ol_gt_close(int fd) {
+    (void)fd;
+    atomic_store_explicit(&g_last_error, OL_GT_ERROR_PLATFORM_UNSUPPORTED, memory_order_relaxed);
+    return -1;
+}
+
+#endif /* OL_PLATFORM_POSIX */
+
 /* ==================== Debugging Support ==================== */
 
 #ifdef OL_GT_DEBUG
@@ -1,8 +1,26 @@
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+  #define _GNU_SOURCE /* syscall() */
+#endif
+
 #include "ol_parallel.h"
+#include "ol_parallel_internal.h"
 #include "ol_lock_mutex.h"
+#include "ol_deadlines.h"
+#include "ol_common.h"
 
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
+
+#if !defined(_WIN32)
+  #include <sched.h>
+#endif
+
+#if defined(__linux__)
+  #include <linux/futex.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
 
 /* Platform threads */
 #if defined(_WIN32)
@@ -22,73 +40,541 @@
   static void ol_thread_join(ol_thread_t t) { (void)pthread_join(t, NULL); }
 #endif
 
-/* Queue node */
-typedef struct ol_task_node {
+/* Scheduling layout
+ *
+ * Every worker owns a bounded ring of tasks (Chase-Lev style): only the
+ * owner pushes, at the bottom, and anyone takes from the top with a CAS.
+ * The owner consumes FIFO too, so a task that resubmits itself (e.g. a busy
+ * actor) still goes behind work already queued. Submissions from a worker
+ * land in its own ring without locks or allocation; submissions from other
+ * threads, and ring overflow, go to a shared injection ring behind mu.
+ * Idle workers take from their ring, then the injection ring, then steal
+ * from a random victim, and finally park on a futex (condvar elsewhere).
+ * A waker claims a parked worker before waking it and counts it as
+ * searching; while one is searching, further submits wake nobody. The
+ * searcher passes the wake-up on once it finds a task, so a burst of
+ * submits costs a handful of wake-ups rather than one per task.
+ *
+ * The rings and injection queue hold the NORMAL class. HIGH tasks wait in
+ * an earliest-deadline-first heap and LOW tasks in a FIFO, both behind mu.
+ * Workers look at HIGH before anything else and at LOW only when idle,
+ * except that every OL_POOL_LOW_EVERY-th pick checks LOW first so a steady
+ * stream of foreground work cannot starve background tasks.
+ */
+
+#define OL_POOL_RING_SIZE  1024u                    /* per-worker slots (power of two) */
+#define OL_POOL_RING_MASK  (OL_POOL_RING_SIZE - 1)
+#define OL_POOL_CACHE_LINE 64
+#define OL_POOL_LOW_EVERY  32u                      /* background share: 1 pick in N */
+#define OL_POOL_WAIT_SAMPLE 16u                     /* NORMAL wait timing: 1 submit in N */
+
+/* Queued task */
+typedef struct {
     ol_task_fn fn;
     void *arg;
-    struct ol_task_node *next;
-} ol_task_node_t;
+    ol_task_group_t *group;                         /* completed after fn (may be NULL) */
+    int64_t enq_ns;                                 /* submit time (0 = not sampled) */
+    uint32_t prio;                                  /* ol_task_priority_t */
+    uint32_t keep;                                  /* runs even if shutdown discards */
+} ol_task_t;
+
+/* Growable FIFO ring (guarded by mu) */
+typedef struct {
+    ol_task_t *buf;
+    size_t     cap;
+    size_t     head;
+    size_t     count;       /* also read without mu as a hint */
+} ol_fifo_t;
+
+/* HIGH class entry: ordered by deadline, then submission order */
+typedef struct {
+    ol_task_t task;
+    int64_t   deadline;     /* INT64_MAX when none was given */
+    uint64_t  seq;
+} ol_edf_entry_t;
+
+/* Per-class submit counters, shared (atomic) */
+typedef struct {
+    uint64_t submitted;
+    uint64_t dropped;       /* cancelled by a non-draining shutdown */
+} ol_class_counters_t;
+
+/* Per-class run counters of one worker: single writer, summed on read.
+ * Queue depth is derived (submitted - dropped - started) so running a task
+ * costs no shared atomic beyond the pending count. */
+typedef struct {
+    uint64_t started;
+    uint64_t completed;
+    uint64_t wait_samples;
+    uint64_t wait_ns_total;
+    uint64_t wait_ns_max;
+    uint64_t deadline_misses;
+} ol_run_counters_t;
+
+/* Task group: counts its tasks still queued or running */
+struct ol_task_group {
+    ol_parallel_pool_t *pool;
+    size_t     pending;      /* atomic */
+    size_t     waiters;      /* threads blocked in wait (atomic) */
+    ol_mutex_t mu;
+    ol_cond_t  cv_done;
+};
+
+/* Per-worker run queue */
+typedef struct ol_worker {
+    long top;                                       /* next slot to take (any thread) */
+    char pad0[OL_POOL_CACHE_LINE - sizeof(long)];
+    long bottom;                                    /* next slot to fill (owner only) */
+    char pad1[OL_POOL_CACHE_LINE - sizeof(long)];
+    ol_task_t ring[OL_POOL_RING_SIZE];
+    struct ol_parallel_pool *pool;
+    uint32_t rng;                                   /* victim selection */
+    uint32_t parked;                                /* 1 while asleep and unclaimed (futex word) */
+    uint32_t picks;                                 /* tasks taken, for the LOW share */
+    ol_run_counters_t runs[OL_TASK_PRIORITY_COUNT];
+} ol_worker_t;
 
 /* Thread pool */
 struct ol_parallel_pool {
     /* Workers */
     ol_thread_t *threads;
+    ol_worker_t *workers;
     size_t       nthreads;
 
-    /* Work queue (FIFO) */
-    ol_task_node_t *q_head;
-    ol_task_node_t *q_tail;
-    size_t          q_size;
+    /* Shared queues (guarded by mu) */
+    ol_fifo_t       inj;        /* NORMAL tasks from non-worker threads */
+    ol_fifo_t       low;        /* LOW tasks */
+    ol_edf_entry_t *high;       /* HIGH tasks, binary min-heap */
+    size_t          high_cap;
+    size_t          high_count; /* also read without mu as a hint */
+    uint64_t        high_seq;
+
+    /* Counters (atomic) */
+    ol_class_counters_t cls[OL_TASK_PRIORITY_COUNT];
+    size_t pending;         /* submitted, not yet finished */
+    size_t flushers;        /* threads waiting in flush */
+
+    /* Parking */
+    size_t sleepers;        /* parked workers not yet claimed by a waker */
+    size_t searching;       /* woken workers that have not found a task yet */
+#if !defined(__linux__)
+    ol_mutex_t park_mu;
+    ol_cond_t  park_cv;
+#endif
 
     /* Synchronization */
     ol_mutex_t  mu;
-    ol_cond_t   cv_has_work;   /* workers wait for work */
     ol_cond_t   cv_idle;       /* flush waits for idle (no work, no active workers) */
 
     /* State flags */
-    bool running;       /* accepting work */
+    bool running;       /* accepting work (atomic; written under mu) */
     bool shutting_down; /* shutdown in progress */
-
-    /* Active workers currently executing a task (for flush) */
-    size_t active_workers;
+    bool discard;       /* drop tasks instead of running them */
 };
 
+/* Worker owning the calling thread (NULL outside pools) */
+static OL_THREAD_LOCAL ol_worker_t *tl_worker = NULL;
+
+/* NORMAL submissions by this thread, for wait-time sampling */
+static OL_THREAD_LOCAL uint32_t tl_submits = 0;
+
 /* Internal helpers */
 
-static void ol_enqueue_task(ol_parallel_pool_t *p, ol_task_fn fn, void *arg) {
-    ol_task_node_t *node = (ol_task_node_t*)malloc(sizeof(ol_task_node_t));
-    node->fn = fn;
-    node->arg = arg;
-    node->next = NULL;
-    if (!p->q_tail) {
-        p->q_head = p->q_tail = node;
-    } else {
-        p->q_tail->next = node;
-        p->q_tail = node;
+/* Owner: append to the bottom of its ring; false when full */
+static bool ol_ring_push(ol_worker_t *w, const ol_task_t *task) {
+    long b = w->bottom;
+    long t = __atomic_load_n(&w->top, __ATOMIC_ACQUIRE);
+    if (b - t >= (long)OL_POOL_RING_SIZE) return false;
+    ol_task_t *slot = &w->ring[(size_t)b & OL_POOL_RING_MASK];
+    __atomic_store_n(&slot->fn, task->fn, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->arg, task->arg, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->group, task->group, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->enq_ns, task->enq_ns, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->prio, task->prio, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->keep, task->keep, __ATOMIC_RELAXED);
+    __atomic_store_n(&w->bottom, b + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/* Any thread: take the oldest task of a ring.
+ * A slot read may race with the owner refilling it, but the owner can only
+ * reuse slot t after top has moved past t, so the CAS then fails. */
+static bool ol_ring_take(ol_worker_t *w, ol_task_t *out) {
+    long t = __atomic_load_n(&w->top, __ATOMIC_ACQUIRE);
+    for (;;) {
+        long b = __atomic_load_n(&w->bottom, __ATOMIC_ACQUIRE);
+        if (t >= b) return false;
+        ol_task_t *slot = &w->ring[(size_t)t & OL_POOL_RING_MASK];
+        out->fn  = __atomic_load_n(&slot->fn, __ATOMIC_RELAXED);
+        out->arg = __atomic_load_n(&slot->arg, __ATOMIC_RELAXED);
+        out->group = __atomic_load_n(&slot->group, __ATOMIC_RELAXED);
+        out->enq_ns = __atomic_load_n(&slot->enq_ns, __ATOMIC_RELAXED);
+        out->prio = __atomic_load_n(&slot->prio, __ATOMIC_RELAXED);
+        out->keep = __atomic_load_n(&slot->keep, __ATOMIC_RELAXED);
+        if (__atomic_compare_exchange_n(&w->top, &t, t + 1, false,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            return true;
+        }
     }
-    p->q_size++;
 }
 
-static int ol_dequeue_task(ol_parallel_pool_t *p, ol_task_fn *out_fn, void **out_arg) {
-    ol_task_node_t *node = p->q_head;
-    if (!node) return 0;
-    p->q_head = node->next;
-    if (!p->q_head) p->q_tail = NULL;
-    p->q_size--;
-    *out_fn  = node->fn;
-    *out_arg = node->arg;
-    free(node);
-    return 1;
+static bool ol_ring_empty(ol_worker_t *w) {
+    return __atomic_load_n(&w->top, __ATOMIC_ACQUIRE) >=
+           __atomic_load_n(&w->bottom, __ATOMIC_ACQUIRE);
 }
 
-static void ol_clear_queue(ol_parallel_pool_t *p) {
-    while (p->q_head) {
-        ol_task_node_t *n = p->q_head;
-        p->q_head = n->next;
-        free(n);
+/* Append to a shared FIFO (mu held); returns 0 or -1 if out of memory */
+static int ol_fifo_push(ol_fifo_t *q, const ol_task_t *task) {
+    if (q->count == q->cap) {
+        size_t cap = q->cap ? q->cap * 2 : 64;
+        ol_task_t *buf = (ol_task_t*)malloc(cap * sizeof(ol_task_t));
+        if (!buf) return -1;
+        for (size_t i = 0; i < q->count; i++) {
+            buf[i] = q->buf[(q->head + i) % q->cap];
+        }
+        free(q->buf);
+        q->buf = buf;
+        q->cap = cap;
+        q->head = 0;
     }
-    p->q_tail = NULL;
-    p->q_size = 0;
+    q->buf[(q->head + q->count) % q->cap] = *task;
+    __atomic_store_n(&q->count, q->count + 1, __ATOMIC_RELEASE);
+    return 0;
+}
+
+/* Pop the oldest task of a shared FIFO (mu held) */
+static bool ol_fifo_pop(ol_fifo_t *q, ol_task_t *out) {
+    if (q->count == 0) return false;
+    *out = q->buf[q->head];
+    q->head = (q->head + 1) % q->cap;
+    __atomic_store_n(&q->count, q->count - 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+static bool ol_fifo_hint(const ol_fifo_t *q) {
+    return __atomic_load_n(&q->count, __ATOMIC_ACQUIRE) != 0;
+}
+
+static bool ol_edf_before(const ol_edf_entry_t *a, const ol_edf_entry_t *b) {
+    return a->deadline < b->deadline || (a->deadline == b->deadline && a->seq < b->seq);
+}
+
+/* Insert into the HIGH heap (mu held); returns 0 or -1 if out of memory */
+static int ol_edf_push(ol_parallel_pool_t *p, const ol_task_t *task, int64_t deadline) {
+    if (p->high_count == p->high_cap) {
+        size_t cap = p->high_cap ? p->high_cap * 2 : 64;
+        ol_edf_entry_t *heap = (ol_edf_entry_t*)realloc(p->high, cap * sizeof(ol_edf_entry_t));
+        if (!heap) return -1;
+        p->high = heap;
+        p->high_cap = cap;
+    }
+    ol_edf_entry_t e = { *task, deadline > 0 ? deadline : INT64_MAX, p->high_seq++ };
+    size_t i = p->high_count;
+    while (i > 0) {
+        size_t parent = (i - 1) / 2;
+        if (!ol_edf_before(&e, &p->high[parent])) break;
+        p->high[i] = p->high[parent];
+        i = parent;
+    }
+    p->high[i] = e;
+    __atomic_store_n(&p->high_count, p->high_count + 1, __ATOMIC_RELEASE);
+    return 0;
+}
+
+/* Remove the earliest-deadline HIGH task (mu held) */
+static bool ol_edf_pop(ol_parallel_pool_t *p, ol_edf_entry_t *out) {
+    if (p->high_count == 0) return false;
+    *out = p->high[0];
+    size_t n = p->high_count - 1;
+    ol_edf_entry_t last = p->high[n];
+    size_t i = 0;
+    for (;;) {
+        size_t child = 2 * i + 1;
+        if (child >= n) break;
+        if (child + 1 < n && ol_edf_before(&p->high[child + 1], &p->high[child])) child++;
+        if (!ol_edf_before(&p->high[child], &last)) break;
+        p->high[i] = p->high[child];
+        i = child;
+    }
+    if (n > 0) p->high[i] = last;
+    __atomic_store_n(&p->high_count, n, __ATOMIC_RELEASE);
+    return true;
+}
+
+/* Clear a worker's parked flag; true if this call did it (and owns the
+ * sleepers slot) */
+static bool ol_park_claim(ol_parallel_pool_t *p, ol_worker_t *w) {
+    uint32_t one = 1;
+    if (!__atomic_compare_exchange_n(&w->parked, &one, 0, false,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+        return false;
+    }
+    __atomic_fetch_sub(&p->sleepers, 1, __ATOMIC_SEQ_CST);
+    return true;
+}
+
+static void ol_park_wake(ol_parallel_pool_t *p, ol_worker_t *w) {
+#if defined(__linux__)
+    (void)p;
+    (void)syscall(SYS_futex, &w->parked, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+#else
+    (void)w;
+    ol_mutex_lock(&p->park_mu);
+    ol_cond_broadcast(&p->park_cv);
+    ol_mutex_unlock(&p->park_mu);
+#endif
+}
+
+/* Wake up to n parked workers (all of them when force is set) */
+static void ol_pool_unpark(ol_parallel_pool_t *p, size_t n, bool force) {
+    /* Pairs with the sleepers increment in ol_worker_main() */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    if (!force) {
+        if (__atomic_load_n(&p->sleepers, __ATOMIC_SEQ_CST) == 0) return;
+        /* A searching worker will find the task and wake the next one */
+        if (__atomic_load_n(&p->searching, __ATOMIC_SEQ_CST) != 0) return;
+    }
+    for (size_t i = 0; i < p->nthreads && (force || n > 0); i++) {
+        ol_worker_t *w = &p->workers[i];
+        if (ol_park_claim(p, w)) {
+            __atomic_fetch_add(&p->searching, 1, __ATOMIC_SEQ_CST);
+            ol_park_wake(p, w);
+            n--;
+        }
+    }
+}
+
+/* Sleep until a waker clears our parked flag (may return spuriously) */
+static void ol_pool_park(ol_parallel_pool_t *p, ol_worker_t *w) {
+#if defined(__linux__)
+    (void)p;
+    (void)syscall(SYS_futex, &w->parked, FUTEX_WAIT_PRIVATE, 1, NULL, NULL, 0);
+#else
+    ol_mutex_lock(&p->park_mu);
+    while (__atomic_load_n(&w->parked, __ATOMIC_ACQUIRE) == 1) {
+        (void)ol_cond_wait_until(&p->park_cv, &p->park_mu, /*infinite*/ 0);
+    }
+    ol_mutex_unlock(&p->park_mu);
+#endif
+}
+
+/* One task of a group finished. Only the thread that takes pending to zero
+ * touches the group afterwards, and it does so under mu, so a waiter that
+ * saw zero and then took mu may free the group. */
+static void ol_task_group_done(ol_task_group_t *g) {
+    size_t left = __atomic_load_n(&g->pending, __ATOMIC_ACQUIRE);
+    for (;;) {
+        if (left == 1) {
+            ol_mutex_lock(&g->mu);
+            if (__atomic_sub_fetch(&g->pending, 1, __ATOMIC_SEQ_CST) == 0 &&
+                __atomic_load_n(&g->waiters, __ATOMIC_RELAXED) != 0) {
+                ol_cond_broadcast(&g->cv_done);
+            }
+            ol_mutex_unlock(&g->mu);
+            return;
+        }
+        if (__atomic_compare_exchange_n(&g->pending, &left, left - 1, true,
+                                        __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            return;
+        }
+    }
+}
+
+/* Account for n tasks leaving the pool; wakes flush when none remain */
+static void ol_pool_finish(ol_parallel_pool_t *p, size_t n) {
+    if (n == 0) return;
+    if (__atomic_sub_fetch(&p->pending, n, __ATOMIC_SEQ_CST) != 0) return;
+    /* Pairs with the flushers increment in ol_parallel_flush() */
+    if (__atomic_load_n(&p->flushers, __ATOMIC_SEQ_CST) == 0) return;
+    ol_mutex_lock(&p->mu);
+    ol_cond_broadcast(&p->cv_idle);
+    ol_mutex_unlock(&p->mu);
+}
+
+/* Take from the injection ring, moving a share of it into the local ring */
+static bool ol_inject_take(ol_parallel_pool_t *p, ol_worker_t *w, ol_task_t *out) {
+    if (!ol_fifo_hint(&p->inj)) return false;
+    ol_mutex_lock(&p->mu);
+    if (!ol_fifo_pop(&p->inj, out)) {
+        ol_mutex_unlock(&p->mu);
+        return false;
+    }
+    /* Grab a fair share so external submitters do not serialize on mu */
+    size_t share = p->inj.count / p->nthreads;
+    if (share > OL_POOL_RING_SIZE / 2) share = OL_POOL_RING_SIZE / 2;
+    size_t moved = 0;
+    ol_task_t t;
+    while (moved < share && ol_fifo_pop(&p->inj, &t)) {
+        if (!ol_ring_push(w, &t)) {
+            /* Cannot happen with an empty ring; put it back in front */
+            p->inj.head = (p->inj.head + p->inj.cap - 1) % p->inj.cap;
+            __atomic_store_n(&p->inj.count, p->inj.count + 1, __ATOMIC_RELEASE);
+            break;
+        }
+        moved++;
+    }
+    ol_mutex_unlock(&p->mu);
+    if (moved > 0) ol_pool_unpark(p, 1, false); /* let a sleeper steal some */
+    return true;
+}
+
+/* Steal from the other workers, starting at a random victim */
+static bool ol_steal(ol_parallel_pool_t *p, ol_worker_t *w, ol_task_t *out) {
+    if (p->nthreads < 2) return false;
+    w->rng ^= w->rng << 13;
+    w->rng ^= w->rng >> 17;
+    w->rng ^= w->rng << 5;
+    size_t start = w->rng % p->nthreads;
+    for (size_t i = 0; i < p->nthreads; i++) {
+        ol_worker_t *victim = &p->workers[(start + i) % p->nthreads];
+        if (victim != w && ol_ring_take(victim, out)) return true;
+    }
+    return false;
+}
+
+/* Bump a worker-owned counter; readers on other threads see whole values */
+static void ol_stat_add(uint64_t *c, uint64_t v) {
+    __atomic_store_n(c, __atomic_load_n(c, __ATOMIC_RELAXED) + v, __ATOMIC_RELAXED);
+}
+
+/* Take the earliest-deadline HIGH task */
+static bool ol_high_take(ol_parallel_pool_t *p, ol_worker_t *w, ol_task_t *out) {
+    if (__atomic_load_n(&p->high_count, __ATOMIC_ACQUIRE) == 0) return false;
+    ol_edf_entry_t e;
+    ol_mutex_lock(&p->mu);
+    bool found = ol_edf_pop(p, &e);
+    ol_mutex_unlock(&p->mu);
+    if (!found) return false;
+    if (e.deadline != INT64_MAX && ol_monotonic_now_ns() > e.deadline) {
+        ol_stat_add(&w->runs[OL_TASK_PRIORITY_HIGH].deadline_misses, 1);
+    }
+    *out = e.task;
+    return true;
+}
+
+/* Take the oldest LOW task */
+static bool ol_low_take(ol_parallel_pool_t *p, ol_task_t *out) {
+    if (!ol_fifo_hint(&p->low)) return false;
+    ol_mutex_lock(&p->mu);
+    bool found = ol_fifo_pop(&p->low, out);
+    ol_mutex_unlock(&p->mu);
+    return found;
+}
+
+static bool ol_find_task(ol_parallel_pool_t *p, ol_worker_t *w, ol_task_t *out) {
+    /* Guaranteed background share, so LOW cannot starve */
+    if (++w->picks % OL_POOL_LOW_EVERY == 0 && ol_low_take(p, out)) return true;
+    return ol_high_take(p, w, out) || ol_ring_take(w, out) || ol_inject_take(p, w, out) ||
+           ol_steal(p, w, out) || ol_low_take(p, out);
+}
+
+/* Any runnable task left anywhere (checked before parking) */
+static bool ol_pool_has_work(ol_parallel_pool_t *p) {
+    if (ol_fifo_hint(&p->inj) || ol_fifo_hint(&p->low) ||
+        __atomic_load_n(&p->high_count, __ATOMIC_ACQUIRE) != 0) return true;
+    for (size_t i = 0; i < p->nthreads; i++) {
+        if (!ol_ring_empty(&p->workers[i])) return true;
+    }
+    return false;
+}
+
+/* Queue tasks from any thread. NORMAL tasks go to the caller's ring when
+ * it is one of this pool's workers, to the injection ring otherwise; HIGH
+ * and LOW tasks go to their shared queues. Kept tasks still run after a
+ * cancelling shutdown. Returns the number queued or -2 if the pool is not
+ * accepting work. */
+static int ol_pool_push(ol_parallel_pool_t *p, ol_task_fn fn,
+                        void *const *args, size_t count, ol_task_group_t *group,
+                        ol_task_priority_t prio, int64_t deadline_ns, bool keep) {
+    if (!__atomic_load_n(&p->running, __ATOMIC_ACQUIRE)) return -2;
+
+    ol_class_counters_t *cls = &p->cls[prio];
+
+    /* Count first: a task may finish before this function returns. The
+     * class count follows the push, so depth may briefly read low, never
+     * high. */
+    __atomic_fetch_add(&p->pending, count, __ATOMIC_SEQ_CST);
+
+    /* The clock read costs about as much as a small task, so the NORMAL
+     * class only times a sample of its submissions */
+    bool timed = prio != OL_TASK_PRIORITY_NORMAL || tl_submits++ % OL_POOL_WAIT_SAMPLE == 0;
+    ol_task_t t = { fn, NULL, group, timed ? ol_monotonic_now_ns() : 0, (uint32_t)prio,
+                    keep ? 1u : 0u };
+    size_t queued = 0;
+    ol_worker_t *w = tl_worker;
+    if (prio == OL_TASK_PRIORITY_NORMAL && w && w->pool == p) {
+        /* A worker of a shutting-down pool drains its own ring before exiting */
+        while (queued < count) {
+            t.arg = args[queued];
+            if (!ol_ring_push(w, &t)) break;
+            queued++;
+        }
+    }
+
+    int rc = 0;
+    if (queued < count) {
+        ol_mutex_lock(&p->mu);
+        if (!p->running || p->shutting_down) {
+            rc = -2; /* not accepting work */
+        } else {
+            while (queued < count) {
+                t.arg = args[queued];
+                int r = prio == OL_TASK_PRIORITY_HIGH ? ol_edf_push(p, &t, deadline_ns)
+                      : prio == OL_TASK_PRIORITY_LOW  ? ol_fifo_push(&p->low, &t)
+                      : ol_fifo_push(&p->inj, &t);
+                if (r != 0) break;
+                queued++;
+            }
+        }
+        ol_mutex_unlock(&p->mu);
+    }
+
+    if (queued > 0) __atomic_fetch_add(&cls->submitted, queued, __ATOMIC_RELAXED);
+    if (queued < count) ol_pool_finish(p, count - queued);
+    if (queued > 0) ol_pool_unpark(p, queued, false);
+
+    return queued == 0 && rc != 0 ? rc : (int)queued;
+}
+
+/* Run one task taken from a queue */
+static void ol_run_task(ol_parallel_pool_t *p, ol_worker_t *w, const ol_task_t *t) {
+    ol_run_counters_t *run = &w->runs[t->prio];
+    ol_stat_add(&run->started, 1);
+
+    if (t->enq_ns != 0) {
+        int64_t waited = ol_monotonic_now_ns() - t->enq_ns;
+        uint64_t wait_ns = waited > 0 ? (uint64_t)waited : 0;
+        ol_stat_add(&run->wait_samples, 1);
+        ol_stat_add(&run->wait_ns_total, wait_ns);
+        if (wait_ns > run->wait_ns_max) {
+            __atomic_store_n(&run->wait_ns_max, wait_ns, __ATOMIC_RELAXED);
+        }
+    }
+
+    if (!__atomic_load_n(&p->discard, __ATOMIC_ACQUIRE) || t->keep) {
+        t->fn(t->arg);
+        ol_stat_add(&run->completed, 1);
+    }
+    if (t->group) ol_task_group_done(t->group);
+    ol_pool_finish(p, 1);
+}
+
+/* Run one queued task on behalf of a waiting worker; false if the caller
+ * is not one of p's workers or nothing was runnable */
+static bool ol_pool_help(ol_parallel_pool_t *p) {
+    ol_worker_t *w = tl_worker;
+    ol_task_t t;
+    if (!w || w->pool != p || !ol_find_task(p, w, &t)) return false;
+    ol_run_task(p, w, &t);
+    return true;
+}
+
+static void ol_pool_yield(void) {
+#if defined(_WIN32)
+    SwitchToThread();
+#else
+    (void)sched_yield();
+#endif
 }
 
 /* Worker routines */
@@ -98,51 +584,49 @@ static DWORD WINAPI ol_worker_main(LPVOID param)
 static void* ol_worker_main(void *param)
 #endif
 {
-    ol_parallel_pool_t *p = (ol_parallel_pool_t*)param;
+    ol_worker_t *w = (ol_worker_t*)param;
+    ol_parallel_pool_t *p = w->pool;
+    bool searching = false;
+    tl_worker = w;
 
     for (;;) {
-        ol_mutex_lock(&p->mu);
-
-        /* Wait for work or shutdown */
-        while (p->running && p->q_size == 0) {
-            /* If flush is waiting, signal idle when no active workers and no tasks */
-            if (p->active_workers == 0) {
-                ol_cond_broadcast(&p->cv_idle);
+        ol_task_t t;
+        if (ol_find_task(p, w, &t)) {
+            if (searching) {
+                /* Hand the search over if more work is waiting */
+                searching = false;
+                if (__atomic_sub_fetch(&p->searching, 1, __ATOMIC_SEQ_CST) == 0 &&
+                    ol_pool_has_work(p)) {
+                    ol_pool_unpark(p, 1, false);
+                }
             }
-            int r = ol_cond_wait_until(&p->cv_has_work, &p->mu, /*infinite*/ 0);
-            (void)r; /* ignore spurious wakeups */
+            ol_run_task(p, w, &t);
+            continue;
         }
 
-        /* If not running and no work queued: exit thread */
-        if (!p->running && p->q_size == 0) {
-            ol_mutex_unlock(&p->mu);
-            break;
+        /* Stop searching before the re-check below, so a submit that skipped
+         * its wake-up because of us is seen there */
+        if (searching) {
+            searching = false;
+            __atomic_fetch_sub(&p->searching, 1, __ATOMIC_SEQ_CST);
         }
 
-        /* Dequeue one task */
-        ol_task_fn fn = NULL;
-        void *arg = NULL;
-        if (ol_dequeue_task(p, &fn, &arg)) {
-            p->active_workers++;
-            ol_mutex_unlock(&p->mu);
-
-            /* Execute outside the lock */
-            fn(arg);
-
-            ol_mutex_lock(&p->mu);
-            p->active_workers--;
+        /* Nothing left anywhere and no more submissions: exit thread */
+        if (!__atomic_load_n(&p->running, __ATOMIC_ACQUIRE)) break;
 
-            /* If queue empty and no active workers, signal idle for flush/shutdown */
-            if (p->q_size == 0 && p->active_workers == 0) {
-                ol_cond_broadcast(&p->cv_idle);
-            }
-            ol_mutex_unlock(&p->mu);
-        } else {
-            /* No task despite condition: loop back */
-            ol_mutex_unlock(&p->mu);
+        /* Announce the sleep, then re-check so a concurrent submit either
+         * sees us in sleepers or we see its task */
+        __atomic_store_n(&w->parked, 1, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&p->sleepers, 1, __ATOMIC_SEQ_CST);
+        if (!ol_pool_has_work(p) && __atomic_load_n(&p->running, __ATOMIC_SEQ_CST)) {
+            ol_pool_park(p, w);
         }
+        /* Still flagged: spurious return or work found, withdraw ourselves.
+         * Otherwise a waker claimed us and counted us as searching. */
+        searching = !ol_park_claim(p, w);
     }
 
+    tl_worker = NULL;
 #if defined(_WIN32)
     return 0;
 #else
@@ -152,6 +636,21 @@ static void* ol_worker_main(void *param)
 
 /* Public API */
 
+static void ol_pool_free(ol_parallel_pool_t *p) {
+#if !defined(__linux__)
+    ol_cond_destroy(&p->park_cv);
+    ol_mutex_destroy(&p->park_mu);
+#endif
+    ol_cond_destroy(&p->cv_idle);
+    ol_mutex_destroy(&p->mu);
+    free(p->inj.buf);
+    free(p->low.buf);
+    free(p->high);
+    free(p->workers);
+    free(p->threads);
+    free(p);
+}
+
 ol_parallel_pool_t* ol_parallel_create(size_t num_threads) {
     if (num_threads == 0) num_threads = 1;
 
@@ -159,46 +658,58 @@ ol_parallel_pool_t* ol_parallel_create(size_t num_threads) {
     if (!p) return NULL;
 
     p->threads = (ol_thread_t*)calloc(num_threads, sizeof(ol_thread_t));
-    if (!p->threads) { free(p); return NULL; }
+    p->workers = (ol_worker_t*)calloc(num_threads, sizeof(ol_worker_t));
+    if (!p->threads || !p->workers) { free(p->workers); free(p->threads); free(p); return NULL; }
 
     p->nthreads = num_threads;
-    p->q_head = p->q_tail = NULL;
-    p->q_size = 0;
     p->running = true;
     p->shutting_down = false;
-    p->active_workers = 0;
 
-    if (ol_mutex_init(&p->mu) != 0) { free(p->threads); free(p); return NULL; }
-    if (ol_cond_init(&p->cv_has_work) != 0) { ol_mutex_destroy(&p->mu); free(p->threads); free(p); return NULL; }
+    for (size_t i = 0; i < num_threads; i++) {
+        p->workers[i].pool = p;
+        p->workers[i].rng = (uint32_t)(i * 0x9E3779B9u) | 1u;
+    }
+
+    if (ol_mutex_init(&p->mu) != 0) { free(p->workers); free(p->threads); free(p); return NULL; }
     if (ol_cond_init(&p->cv_idle) != 0) {
-        ol_cond_destroy(&p->cv_has_work);
         ol_mutex_destroy(&p->mu);
+        free(p->workers);
+        free(p->threads);
+        free(p);
+        return NULL;
+    }
+#if !defined(__linux__)
+    if (ol_mutex_init(&p->park_mu) != 0) {
+        ol_cond_destroy(&p->cv_idle);
+        ol_mutex_destroy(&p->mu);
+        free(p->workers);
+        free(p->threads);
+        free(p);
+        return NULL;
+    }
+    if (ol_cond_init(&p->park_cv) != 0) {
+        ol_mutex_destroy(&p->park_mu);
+        ol_cond_destroy(&p->cv_idle);
+        ol_mutex_destroy(&p->mu);
+        free(p->workers);
         free(p->threads);
         free(p);
         return NULL;
     }
+#endif
 
     /* Start workers */
     for (size_t i = 0; i < num_threads; i++) {
-#if defined(_WIN32)
-        if (ol_thread_start(&p->threads[i], ol_worker_main, p) != 0)
-#else
-        if (ol_thread_start(&p->threads[i], ol_worker_main, p) != 0)
-#endif
-        {
+        if (ol_thread_start(&p->threads[i], ol_worker_main, &p->workers[i]) != 0) {
             /* Rollback on failure: request shutdown and join started workers */
             ol_mutex_lock(&p->mu);
-            p->running = false;
-            ol_cond_broadcast(&p->cv_has_work);
+            __atomic_store_n(&p->running, false, __ATOMIC_SEQ_CST);
             ol_mutex_unlock(&p->mu);
+            ol_pool_unpark(p, SIZE_MAX, true);
             for (size_t j = 0; j < i; j++) {
                 ol_thread_join(p->threads[j]);
             }
-            ol_cond_destroy(&p->cv_idle);
-            ol_cond_destroy(&p->cv_has_work);
-            ol_mutex_destroy(&p->mu);
-            free(p->threads);
-            free(p);
+            ol_pool_free(p);
             return NULL;
         }
     }
@@ -209,26 +720,57 @@ ol_parallel_pool_t* ol_parallel_create(size_t num_threads) {
 /* Submit — upgraded to return -2 when pool not running to distinguish from generic error */
 int ol_parallel_submit(ol_parallel_pool_t *p, ol_task_fn fn, void *arg) {
     if (!p || !fn) return -1;
-    ol_mutex_lock(&p->mu);
-    if (!p->running || p->shutting_down) {
-        ol_mutex_unlock(&p->mu);
-        return -2; /* not accepting work */
-    }
-    ol_enqueue_task(p, fn, arg);
-    /* Wake one worker */
-    ol_cond_signal(&p->cv_has_work);
-    ol_mutex_unlock(&p->mu);
-    return 0;
+    int r = ol_pool_push(p, fn, &arg, 1, NULL, OL_TASK_PRIORITY_NORMAL, 0, false);
+    if (r == 1) return 0;
+    return r == 0 ? -1 : r;
+}
+
+int ol_parallel_submit_kept(ol_parallel_pool_t *p, ol_task_fn fn, void *arg) {
+    if (!p || !fn) return -1;
+    int r = ol_pool_push(p, fn, &arg, 1, NULL, OL_TASK_PRIORITY_NORMAL, 0, true);
+    if (r == 1) return 0;
+    return r == 0 ? -1 : r;
+}
+
+int ol_parallel_submit_ex(ol_parallel_pool_t *p, ol_task_fn fn, void *arg,
+                          ol_task_priority_t priority, int64_t deadline_ns) {
+    if (!p || !fn || (unsigned)priority >= OL_TASK_PRIORITY_COUNT) return -1;
+    int r = ol_pool_push(p, fn, &arg, 1, NULL, priority, deadline_ns, false);
+    if (r == 1) return 0;
+    return r == 0 ? -1 : r;
+}
+
+/* Batch submit — one lock round trip for many tasks (e.g. waking broadcast receivers) */
+int ol_parallel_submit_batch(ol_parallel_pool_t *p, ol_task_fn fn,
+                             void *const *args, size_t count) {
+    if (!p || !fn || (!args && count > 0)) return -1;
+    if (count == 0) return 0;
+    if (count > (size_t)INT_MAX) count = (size_t)INT_MAX;
+    return ol_pool_push(p, fn, args, count, NULL, OL_TASK_PRIORITY_NORMAL, 0, false);
+}
+
+int ol_parallel_submit_batch_kept(ol_parallel_pool_t *p, ol_task_fn fn,
+                                  void *const *args, size_t count) {
+    if (!p || !fn || (!args && count > 0)) return -1;
+    if (count == 0) return 0;
+    if (count > (size_t)INT_MAX) count = (size_t)INT_MAX;
+    return ol_pool_push(p, fn, args, count, NULL, OL_TASK_PRIORITY_NORMAL, 0, true);
 }
 
 int ol_parallel_flush(ol_parallel_pool_t *p) {
     if (!p) return -1;
     ol_mutex_lock(&p->mu);
+    __atomic_fetch_add(&p->flushers, 1, __ATOMIC_SEQ_CST);
     /* Wait until queue empty and no active workers */
-    while (p->q_size != 0 || p->active_workers != 0) {
+    while (__atomic_load_n(&p->pending, __ATOMIC_SEQ_CST) != 0) {
         int r = ol_cond_wait_until(&p->cv_idle, &p->mu, /*infinite*/ 0);
-        if (r < 0) { ol_mutex_unlock(&p->mu); return -1; }
+        if (r < 0) {
+            __atomic_fetch_sub(&p->flushers, 1, __ATOMIC_SEQ_CST);
+            ol_mutex_unlock(&p->mu);
+            return -1;
+        }
     }
+    __atomic_fetch_sub(&p->flushers, 1, __ATOMIC_SEQ_CST);
     ol_mutex_unlock(&p->mu);
     return 0;
 }
@@ -237,18 +779,48 @@ int ol_parallel_shutdown(ol_parallel_pool_t *p, bool drain) {
     if (!p) return -1;
 
     ol_mutex_lock(&p->mu);
+    if (p->shutting_down) {
+        /* Already shut down (e.g. shutdown followed by destroy) */
+        ol_mutex_unlock(&p->mu);
+        return 0;
+    }
     p->shutting_down = true;
     /* Stop accepting new tasks */
-    p->running = false;
+    __atomic_store_n(&p->running, false, __ATOMIC_SEQ_CST);
 
+    size_t dropped = 0;
     if (!drain) {
-        /* Cancel pending tasks (not-yet-started) */
-        ol_clear_queue(p);
+        /* Cancel pending tasks (not-yet-started): shared queues now, worker
+         * rings as workers pull them. Kept tasks go back to the injection
+         * queue, which workers drain before they exit. */
+        __atomic_store_n(&p->discard, true, __ATOMIC_RELEASE);
+        ol_fifo_t kept = { 0 };
+        ol_task_t t;
+        ol_edf_entry_t e;
+        for (;;) {
+            if (ol_edf_pop(p, &e)) t = e.task;
+            else if (!ol_fifo_pop(&p->inj, &t) && !ol_fifo_pop(&p->low, &t)) break;
+            if (t.keep && ol_fifo_push(&kept, &t) == 0) continue;
+            __atomic_fetch_add(&p->cls[t.prio].dropped, 1, __ATOMIC_RELAXED);
+            if (t.group) ol_task_group_done(t.group);
+            dropped++;
+        }
+        while (ol_fifo_pop(&kept, &t)) {
+            if (ol_fifo_push(&p->inj, &t) != 0) {
+                __atomic_fetch_add(&p->cls[t.prio].dropped, 1, __ATOMIC_RELAXED);
+                if (t.group) ol_task_group_done(t.group);
+                dropped++;
+            }
+        }
+        free(kept.buf);
     }
-    /* Wake all workers so they can exit (queue may be empty or will be drained) */
-    ol_cond_broadcast(&p->cv_has_work);
     ol_mutex_unlock(&p->mu);
 
+    ol_pool_finish(p, dropped);
+
+    /* Wake all workers so they can exit (queues may be empty or will be drained) */
+    ol_pool_unpark(p, SIZE_MAX, true);
+
     /* If drain requested, wait until workers finish outstanding tasks */
     if (drain) (void)ol_parallel_flush(p);
 
@@ -260,21 +832,231 @@ int ol_parallel_shutdown(ol_parallel_pool_t *p, bool drain) {
     return 0;
 }
 
+bool ol_parallel_help(ol_parallel_pool_t *p) {
+    return p && ol_pool_help(p);
+}
+
 void ol_parallel_destroy(ol_parallel_pool_t *p) {
     if (!p) return;
     /* Ensure shutdown (drain) */
     (void)ol_parallel_shutdown(p, true);
 
     /* Cleanup synchronization and storage */
-    ol_cond_destroy(&p->cv_idle);
-    ol_cond_destroy(&p->cv_has_work);
-    ol_mutex_destroy(&p->mu);
+    ol_pool_free(p);
+}
 
-    /* Clear any remaining queue nodes defensively */
-    ol_clear_queue(p);
+/* Task groups */
 
-    free(p->threads);
-    free(p);
+static int ol_task_group_init(ol_task_group_t *g, ol_parallel_pool_t *pool) {
+    g->pool = pool;
+    g->pending = 0;
+    g->waiters = 0;
+    if (ol_mutex_init(&g->mu) != 0) return -1;
+    if (ol_cond_init(&g->cv_done) != 0) { ol_mutex_destroy(&g->mu); return -1; }
+    return 0;
+}
+
+static void ol_task_group_fini(ol_task_group_t *g) {
+    ol_cond_destroy(&g->cv_done);
+    ol_mutex_destroy(&g->mu);
+}
+
+ol_task_group_t* ol_task_group_create(ol_parallel_pool_t *pool) {
+    if (!pool) return NULL;
+    ol_task_group_t *g = (ol_task_group_t*)malloc(sizeof(ol_task_group_t));
+    if (!g) return NULL;
+    if (ol_task_group_init(g, pool) != 0) { free(g); return NULL; }
+    return g;
+}
+
+void ol_task_group_destroy(ol_task_group_t *g) {
+    if (!g) return;
+    ol_task_group_fini(g);
+    free(g);
+}
+
+static int ol_task_group_push(ol_task_group_t *g, ol_task_fn fn, void *arg, bool keep) {
+    /* Count first: the task may finish before the push returns */
+    __atomic_fetch_add(&g->pending, 1, __ATOMIC_SEQ_CST);
+    int r = ol_pool_push(g->pool, fn, &arg, 1, g, OL_TASK_PRIORITY_NORMAL, 0, keep);
+    if (r == 1) return 0;
+    ol_task_group_done(g);
+    return r == 0 ? -1 : r;
+}
+
+int ol_task_group_run(ol_task_group_t *g, ol_task_fn fn, void *arg) {
+    if (!g || !fn) return -1;
+    return ol_task_group_push(g, fn, arg, false);
+}
+
+int ol_task_group_wait(ol_task_group_t *g) {
+    if (!g) return -1;
+
+    /* A worker runs other tasks meanwhile: blocking it could deadlock a
+     * pool whose workers all wait on groups */
+    unsigned idle = 0;
+    while (__atomic_load_n(&g->pending, __ATOMIC_ACQUIRE) != 0) {
+        if (ol_pool_help(g->pool)) {
+            idle = 0;
+            continue;
+        }
+        if (tl_worker && tl_worker->pool == g->pool) {
+            if (++idle > 64) ol_pool_yield();
+            continue;
+        }
+
+        ol_mutex_lock(&g->mu);
+        __atomic_fetch_add(&g->waiters, 1, __ATOMIC_SEQ_CST);
+        while (__atomic_load_n(&g->pending, __ATOMIC_SEQ_CST) != 0) {
+            (void)ol_cond_wait_until(&g->cv_done, &g->mu, /*infinite*/ 0);
+        }
+        __atomic_fetch_sub(&g->waiters, 1, __ATOMIC_RELAXED);
+        ol_mutex_unlock(&g->mu);
+        return 0;
+    }
+
+    /* Let the last finisher leave the group's mutex before we return */
+    ol_mutex_lock(&g->mu);
+    ol_mutex_unlock(&g->mu);
+    return 0;
+}
+
+/* Data-parallel loops
+ *
+ * Ranges are split lazily: a worker runs its range one grain at a time and
+ * only splits off the upper half when its own ring is empty, i.e. when
+ * nobody is waiting on work it already exposed. Idle workers steal those
+ * halves, so the splitting follows the actual load instead of a fixed
+ * chunk count. The splitter joins its halves in reverse order, so reduce
+ * combines partial results left to right. */
+
+typedef struct {
+    ol_parallel_pool_t *pool;
+    size_t         grain;
+    ol_range_fn    for_fn;
+    ol_reduce_fn   reduce_fn;
+    ol_combine_fn  combine;
+    void          *ctx;
+    size_t         acc_size;
+    const void    *identity;
+} ol_range_job_t;
+
+typedef struct ol_range_node {
+    ol_range_job_t *job;
+    size_t begin;
+    size_t end;
+    void  *acc;                   /* reduce accumulator */
+    int    done;                  /* set once the range is complete (atomic) */
+    struct ol_range_node *next;   /* spawner's stack of unjoined halves */
+} ol_range_node_t;
+
+/* Node plus trailing accumulator storage */
+#define OL_RANGE_NODE_SIZE ((sizeof(ol_range_node_t) + 15u) & ~(size_t)15u)
+
+static void ol_range_exec(ol_range_job_t *job, size_t begin, size_t end, void *acc);
+
+static void ol_range_task(void *arg) {
+    ol_range_node_t *node = (ol_range_node_t*)arg;
+    ol_range_exec(node->job, node->begin, node->end, node->acc);
+    __atomic_store_n(&node->done, 1, __ATOMIC_RELEASE);
+}
+
+static void ol_range_exec(ol_range_job_t *job, size_t begin, size_t end, void *acc) {
+    ol_worker_t *w = tl_worker;
+    bool can_split = w && w->pool == job->pool;
+    ol_range_node_t *halves = NULL;
+
+    while (begin < end) {
+        size_t n = end - begin;
+        if (can_split && n > job->grain && ol_ring_empty(w)) {
+            ol_range_node_t *half = (ol_range_node_t*)malloc(OL_RANGE_NODE_SIZE + job->acc_size);
+            if (half) {
+                half->job = job;
+                half->begin = begin + n / 2;
+                half->end = end;
+                half->acc = (char*)half + OL_RANGE_NODE_SIZE;
+                half->done = 0;
+                if (job->acc_size) memcpy(half->acc, job->identity, job->acc_size);
+                /* Kept: the splitter is joining it, even across shutdown */
+                void *arg = half;
+                if (ol_pool_push(job->pool, ol_range_task, &arg, 1, NULL,
+                                 OL_TASK_PRIORITY_NORMAL, 0, true) == 1) {
+                    half->next = halves;
+                    halves = half;
+                    end = half->begin;
+                    continue;
+                }
+                free(half);
+            }
+            can_split = false; /* out of memory or shutting down: finish inline */
+        }
+
+        size_t chunk = n < job->grain ? n : job->grain;
+        if (job->reduce_fn) job->reduce_fn(begin, begin + chunk, acc, job->ctx);
+        else job->for_fn(begin, begin + chunk, job->ctx);
+        begin += chunk;
+    }
+
+    /* Join the halves, nearest (most recently split) first */
+    while (halves) {
+        ol_range_node_t *half = halves;
+        unsigned idle = 0;
+        while (!__atomic_load_n(&half->done, __ATOMIC_ACQUIRE)) {
+            if (ol_pool_help(job->pool)) idle = 0;
+            else if (++idle > 64) ol_pool_yield();
+        }
+        if (job->combine) job->combine(acc, half->acc, job->ctx);
+        halves = half->next;
+        free(half);
+    }
+}
+
+/* Run a job over [begin, end): inline on one of the pool's workers,
+ * otherwise as a pool task the caller waits for */
+static int ol_range_run(ol_range_job_t *job, size_t begin, size_t end, void *acc) {
+    if (begin >= end) return 0;
+
+    if (job->grain == 0) {
+        /* Default: about eight grains per worker before any splitting */
+        job->grain = (end - begin) / (8 * job->pool->nthreads);
+        if (job->grain == 0) job->grain = 1;
+    }
+
+    if (tl_worker && tl_worker->pool == job->pool) {
+        ol_range_exec(job, begin, end, acc);
+        return 0;
+    }
+
+    ol_task_group_t g;
+    if (ol_task_group_init(&g, job->pool) != 0) return -1;
+    ol_range_node_t root = { job, begin, end, acc, 0, NULL };
+    int r = ol_task_group_push(&g, ol_range_task, &root, true);
+    if (r == 0) (void)ol_task_group_wait(&g);
+    ol_task_group_fini(&g);
+    return r;
+}
+
+int ol_parallel_for(ol_parallel_pool_t *p, size_t begin, size_t end, size_t grain,
+                    ol_range_fn fn, void *ctx) {
+    if (!p || !fn) return -1;
+    ol_range_job_t job = { p, grain, fn, NULL, NULL, ctx, 0, NULL };
+    return ol_range_run(&job, begin, end, NULL);
+}
+
+int ol_parallel_reduce(ol_parallel_pool_t *p, size_t begin, size_t end, size_t grain,
+                       void *result, size_t result_size,
+                       ol_reduce_fn fn, ol_combine_fn combine, void *ctx) {
+    if (!p || !fn || !combine || !result || result_size == 0) return -1;
+
+    /* Every split-off half starts from the caller's initial value */
+    void *identity = malloc(result_size);
+    if (!identity) return -1;
+    memcpy(identity, result, result_size);
+
+    ol_range_job_t job = { p, grain, NULL, fn, combine, ctx, result_size, identity };
+    int r = ol_range_run(&job, begin, end, result);
+    free(identity);
+    return r;
 }
 
 /* Introspection */
@@ -285,18 +1067,39 @@ size_t ol_parallel_thread_count(const ol_parallel_pool_t *p) {
 
 size_t ol_parallel_queue_size(const ol_parallel_pool_t *p) {
     if (!p) return 0;
-    size_t sz;
-    ol_mutex_lock((ol_mutex_t*)&p->mu);
-    sz = p->q_size;
-    ol_mutex_unlock((ol_mutex_t*)&p->mu);
+    size_t sz = 0;
+    for (int i = 0; i < OL_TASK_PRIORITY_COUNT; i++) {
+        ol_parallel_class_stats_t st;
+        (void)ol_parallel_get_class_stats(p, (ol_task_priority_t)i, &st);
+        sz += st.queued;
+    }
     return sz;
 }
 
+int ol_parallel_get_class_stats(const ol_parallel_pool_t *p, ol_task_priority_t priority,
+                                ol_parallel_class_stats_t *out) {
+    if (!p || !out || (unsigned)priority >= OL_TASK_PRIORITY_COUNT) return -1;
+    const ol_class_counters_t *c = &p->cls[priority];
+    memset(out, 0, sizeof(*out));
+    uint64_t started = 0;
+    for (size_t i = 0; i < p->nthreads; i++) {
+        const ol_run_counters_t *r = &p->workers[i].runs[priority];
+        uint64_t max = __atomic_load_n(&r->wait_ns_max, __ATOMIC_RELAXED);
+        started              += __atomic_load_n(&r->started, __ATOMIC_RELAXED);
+        out->completed       += __atomic_load_n(&r->completed, __ATOMIC_RELAXED);
+        out->wait_samples    += __atomic_load_n(&r->wait_samples, __ATOMIC_RELAXED);
+        out->wait_ns_total   += __atomic_load_n(&r->wait_ns_total, __ATOMIC_RELAXED);
+        out->deadline_misses += __atomic_load_n(&r->deadline_misses, __ATOMIC_RELAXED);
+        if (max > out->wait_ns_max) out->wait_ns_max = max;
+    }
+    /* A task can start before its submit is counted: clamp at zero */
+    out->submitted = __atomic_load_n(&c->submitted, __ATOMIC_RELAXED);
+    uint64_t gone = started + __atomic_load_n(&c->dropped, __ATOMIC_RELAXED);
+    out->queued = out->submitted > gone ? (size_t)(out->submitted - gone) : 0;
+    return 0;
+}
+
 bool ol_parallel_is_running(const ol_parallel_pool_t *p) {
     if (!p) return false;
-    bool r;
-    ol_mutex_lock((ol_mutex_t*)&p->mu);
-    r = p->running;
-    ol_mutex_unlock((ol_mutex_t*)&p->mu);
-    return r;
+    return __atomic_load_n(&p->running, __ATOMIC_ACQUIRE);
 }
@@ -0,0 +1,27 @@
+#ifndef OL_PARALLEL_INTERNAL_H
+#define OL_PARALLEL_INTERNAL_H
+
+/* Runtime-only pool entry points, shared by the modules built into the
+ * library and not installed with the public headers. */
+
+#include "ol_parallel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Like ol_parallel_submit(), but ol_parallel_shutdown(pool, false) still
+ * runs the task instead of dropping it. For runtime tasks whose completion
+ * releases an owner someone waits on (e.g. actor run slices).
+ */
+int ol_parallel_submit_kept(ol_parallel_pool_t *pool, ol_task_fn fn, void *arg);
+
+/* Like ol_parallel_submit_batch(), with the same guarantee for every task. */
+int ol_parallel_submit_batch_kept(ol_parallel_pool_t *pool, ol_task_fn fn,
+                                  void *const *args, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OL_PARALLEL_INTERNAL_H */
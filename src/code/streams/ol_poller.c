@@ -34,6 +34,16 @@
 #if defined(__linux__)
     #define OL_BACKEND_EPOLL 1
     #include <sys/epoll.h>
+    #if defined(__has_include)
+        #if __has_include(<linux/io_uring.h>)
+            #define OL_HAVE_IO_URING 1
+            #include <linux/io_uring.h>
+            #include <sys/eventfd.h>
+            #include <sys/mman.h>
+            #include <sys/syscall.h>
+            #include "ol_lock_mutex.h"
+        #endif
+    #endif
 #elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || \
       defined(__NetBSD__) || defined(OL_PLATFORM_BSD)
     #define OL_BACKEND_KQUEUE 1
@@ -54,11 +64,18 @@
  * Poller structure definition
  * -------------------------------------------------------------------------- */
 
+#if defined(OL_HAVE_IO_URING)
+struct ol_uring;
+#endif
+
 struct ol_poller {
 #if defined(OL_BACKEND_EPOLL)
     int epfd;                       /**< epoll file descriptor */
     struct epoll_event *events;     /**< Event buffer */
     int capacity;                   /**< Buffer capacity */
+#if defined(OL_HAVE_IO_URING)
+    struct ol_uring *uring;         /**< Completion ring (NULL if unused) */
+#endif
 #elif defined(OL_BACKEND_KQUEUE)
     int kq;                         /**< kqueue file descriptor */
     struct kevent *events;          /**< Event buffer */
@@ -91,6 +108,8 @@ static uint32_t ol_mask_to_backend(uint32_t mask) {
     if (mask & OL_POLL_IN)  m |= EPOLLIN;
     if (mask & OL_POLL_OUT) m |= EPOLLOUT;
     if (mask & OL_POLL_ERR) m |= EPOLLERR | EPOLLHUP;
+    if (mask & OL_POLL_ET)  m |= EPOLLET;
+    if (mask & OL_POLL_ONESHOT) m |= EPOLLONESHOT;
     return m;
 #elif defined(OL_BACKEND_KQUEUE)
     /* kqueue mapping done per filter */
@@ -100,6 +119,18 @@ static uint32_t ol_mask_to_backend(uint32_t mask) {
 #endif
 }
 
+#if defined(OL_BACKEND_KQUEUE)
+/**
+ * @brief kevent flags for adding a filter with the given registration mode
+ */
+static unsigned short ol_kqueue_add_flags(uint32_t mask) {
+    unsigned short flags = EV_ADD | EV_ENABLE;
+    if (mask & OL_POLL_ET)      flags |= EV_CLEAR;
+    if (mask & OL_POLL_ONESHOT) flags |= EV_ONESHOT;
+    return flags;
+}
+#endif
+
 /**
  * @brief Convert backend-specific events to OLSRT mask
  */
@@ -118,11 +149,355 @@ static uint32_t ol_backend_to_mask(uint32_t backend_events) {
 #endif
 }
 
+/* --------------------------------------------------------------------------
+ * io_uring completion engine (Linux)
+ *
+ * Readiness stays on epoll; the ring only carries submitted operations.
+ * SQEs are queued without a syscall and flushed in one io_uring_enter() per
+ * ol_poller_wait(). The ring signals completions through an eventfd that is
+ * registered in the epoll set under OL_POLLER_RESERVED_TAG.
+ * -------------------------------------------------------------------------- */
+
+#if defined(OL_HAVE_IO_URING)
+
+/** @brief Ring size requested from the kernel */
+#define OL_URING_ENTRIES 256
+
+/**
+ * @brief Mapped io_uring instance
+ */
+struct ol_uring {
+    int ring_fd;                    /**< io_uring file descriptor */
+    int event_fd;                   /**< Completion notifier (in epoll set) */
+    
+    /* Submission queue */
+    unsigned *sq_head;              /**< Kernel-owned head */
+    unsigned *sq_tail;              /**< Our tail */
+    unsigned sq_mask;               /**< Index mask */
+    unsigned sq_entries;            /**< Ring size */
+    unsigned *sq_array;             /**< SQE index array */
+    struct io_uring_sqe *sqes;      /**< SQE storage */
+    unsigned sq_pending;            /**< Queued but not yet submitted */
+    ol_mutex_t sq_lock;             /**< Serializes producers and flush */
+    
+    /* Completion queue */
+    unsigned *cq_head;              /**< Our head */
+    unsigned *cq_tail;              /**< Kernel-owned tail */
+    unsigned cq_mask;               /**< Index mask */
+    struct io_uring_cqe *cqes;      /**< CQE storage */
+    
+    /* Mappings */
+    void *sq_ptr;                   /**< SQ ring mapping */
+    size_t sq_size;                 /**< SQ ring mapping size */
+    void *cq_ptr;                   /**< CQ ring mapping (may alias sq_ptr) */
+    size_t cq_size;                 /**< CQ ring mapping size */
+    size_t sqes_size;               /**< SQE array mapping size */
+};
+
+static int ol_uring_setup(unsigned entries, struct io_uring_params *params) {
+    return (int)syscall(__NR_io_uring_setup, entries, params);
+}
+
+static int ol_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+                          unsigned flags) {
+    return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+                        flags, NULL, 0);
+}
+
+static int ol_uring_register(int fd, unsigned opcode, void *arg,
+                             unsigned nr_args) {
+    return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+/**
+ * @brief Check that the kernel implements every opcode we hand out
+ */
+static bool ol_uring_probe_ops(int ring_fd) {
+    static const uint8_t needed[] = {
+        IORING_OP_READ, IORING_OP_WRITE, IORING_OP_RECV,
+        IORING_OP_SEND, IORING_OP_ACCEPT, IORING_OP_CONNECT
+    };
+    
+    size_t size = sizeof(struct io_uring_probe) +
+                  256 * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe *probe = (struct io_uring_probe*)calloc(1, size);
+    if (!probe) {
+        return false;
+    }
+    
+    bool ok = ol_uring_register(ring_fd, IORING_REGISTER_PROBE, probe, 256) == 0;
+    for (size_t i = 0; ok && i < sizeof(needed); i++) {
+        ok = needed[i] <= probe->last_op &&
+             (probe->ops[needed[i]].flags & IO_URING_OP_SUPPORTED);
+    }
+    
+    free(probe);
+    return ok;
+}
+
+static void ol_uring_destroy(struct ol_uring *u) {
+    if (!u) {
+        return;
+    }
+    
+    if (u->sqes) {
+        munmap(u->sqes, u->sqes_size);
+    }
+    if (u->cq_ptr && u->cq_ptr != u->sq_ptr) {
+        munmap(u->cq_ptr, u->cq_size);
+    }
+    if (u->sq_ptr) {
+        munmap(u->sq_ptr, u->sq_size);
+    }
+    if (u->event_fd >= 0) {
+        close(u->event_fd);
+    }
+    if (u->ring_fd >= 0) {
+        close(u->ring_fd);
+    }
+    
+    ol_mutex_destroy(&u->sq_lock);
+    free(u);
+}
+
+/**
+ * @brief Set up a ring and attach its notifier to the epoll set
+ *
+ * @return Ring, or NULL if io_uring is unavailable (caller falls back)
+ */
+static struct ol_uring* ol_uring_create(int epfd) {
+    struct ol_uring *u = (struct ol_uring*)calloc(1, sizeof(struct ol_uring));
+    if (!u) {
+        return NULL;
+    }
+    
+    u->ring_fd = -1;
+    u->event_fd = -1;
+    if (ol_mutex_init(&u->sq_lock) != OL_SUCCESS) {
+        free(u);
+        return NULL;
+    }
+    
+    struct io_uring_params params;
+    memset(&params, 0, sizeof(params));
+    
+    u->ring_fd = ol_uring_setup(OL_URING_ENTRIES, &params);
+    if (u->ring_fd < 0 || !ol_uring_probe_ops(u->ring_fd)) {
+        ol_uring_destroy(u);
+        return NULL;
+    }
+    
+    u->sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    u->cq_size = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        if (u->cq_size > u->sq_size) {
+            u->sq_size = u->cq_size;
+        }
+        u->cq_size = u->sq_size;
+    }
+    
+    u->sq_ptr = mmap(NULL, u->sq_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, u->ring_fd, IORING_OFF_SQ_RING);
+    if (u->sq_ptr == MAP_FAILED) {
+        u->sq_ptr = NULL;
+        ol_uring_destroy(u);
+        return NULL;
+    }
+    
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+        u->cq_ptr = u->sq_ptr;
+    } else {
+        u->cq_ptr = mmap(NULL, u->cq_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, u->ring_fd, IORING_OFF_CQ_RING);
+        if (u->cq_ptr == MAP_FAILED) {
+            u->cq_ptr = NULL;
+            ol_uring_destroy(u);
+            return NULL;
+        }
+    }
+    
+    u->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+    u->sqes = (struct io_uring_sqe*)mmap(NULL, u->sqes_size,
+                                         PROT_READ | PROT_WRITE,
+                                         MAP_SHARED | MAP_POPULATE,
+                                         u->ring_fd, IORING_OFF_SQES);
+    if (u->sqes == MAP_FAILED) {
+        u->sqes = NULL;
+        ol_uring_destroy(u);
+        return NULL;
+    }
+    
+    char *sq = (char*)u->sq_ptr;
+    u->sq_head = (unsigned*)(sq + params.sq_off.head);
+    u->sq_tail = (unsigned*)(sq + params.sq_off.tail);
+    u->sq_mask = *(unsigned*)(sq + params.sq_off.ring_mask);
+    u->sq_entries = *(unsigned*)(sq + params.sq_off.ring_entries);
+    u->sq_array = (unsigned*)(sq + params.sq_off.array);
+    
+    char *cq = (char*)u->cq_ptr;
+    u->cq_head = (unsigned*)(cq + params.cq_off.head);
+    u->cq_tail = (unsigned*)(cq + params.cq_off.tail);
+    u->cq_mask = *(unsigned*)(cq + params.cq_off.ring_mask);
+    u->cqes = (struct io_uring_cqe*)(cq + params.cq_off.cqes);
+    
+    /* Completion notifier */
+    u->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (u->event_fd < 0 ||
+        ol_uring_register(u->ring_fd, IORING_REGISTER_EVENTFD, &u->event_fd, 1) != 0) {
+        ol_uring_destroy(u);
+        return NULL;
+    }
+    
+    struct epoll_event ev;
+    ev.events = EPOLLIN;
+    ev.data.u64 = OL_POLLER_RESERVED_TAG;
+    if (epoll_ctl(epfd, EPOLL_CTL_ADD, u->event_fd, &ev) < 0) {
+        ol_uring_destroy(u);
+        return NULL;
+    }
+    
+    return u;
+}
+
+/**
+ * @brief Hand queued SQEs to the kernel (caller holds sq_lock)
+ */
+static int ol_uring_flush_locked(struct ol_uring *u) {
+    while (u->sq_pending > 0) {
+        int n = ol_uring_enter(u->ring_fd, u->sq_pending, 0, 0);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return (errno == EAGAIN || errno == EBUSY) ? OL_AGAIN : OL_ERROR;
+        }
+        u->sq_pending -= (unsigned)n;
+        if (n == 0) {
+            break;
+        }
+    }
+    
+    return OL_SUCCESS;
+}
+
+static int ol_uring_flush(struct ol_uring *u) {
+    ol_mutex_lock(&u->sq_lock);
+    int rc = ol_uring_flush_locked(u);
+    ol_mutex_unlock(&u->sq_lock);
+    return rc;
+}
+
+/**
+ * @brief Queue one SQE
+ */
+static int ol_uring_queue(struct ol_uring *u,
+                          ol_io_op_type_t op,
+                          int fd,
+                          void *buf,
+                          size_t len,
+                          uint64_t tag) {
+    ol_mutex_lock(&u->sq_lock);
+    
+    unsigned tail = *u->sq_tail;
+    unsigned head = __atomic_load_n(u->sq_head, __ATOMIC_ACQUIRE);
+    
+    if (tail - head >= u->sq_entries) {
+        /* Ring full: submit what we have and re-check */
+        ol_uring_flush_locked(u);
+        head = __atomic_load_n(u->sq_head, __ATOMIC_ACQUIRE);
+        if (tail - head >= u->sq_entries) {
+            ol_mutex_unlock(&u->sq_lock);
+            return OL_AGAIN;
+        }
+    }
+    
+    unsigned index = tail & u->sq_mask;
+    struct io_uring_sqe *sqe = &u->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->fd = fd;
+    sqe->user_data = tag;
+    
+    switch (op) {
+        case OL_IO_OP_READ:
+            sqe->opcode = IORING_OP_READ;
+            sqe->addr = (uint64_t)(uintptr_t)buf;
+            sqe->len = (uint32_t)len;
+            sqe->off = (uint64_t)-1; /* Current position / stream */
+            break;
+        case OL_IO_OP_WRITE:
+            sqe->opcode = IORING_OP_WRITE;
+            sqe->addr = (uint64_t)(uintptr_t)buf;
+            sqe->len = (uint32_t)len;
+            sqe->off = (uint64_t)-1;
+            break;
+        case OL_IO_OP_RECV:
+            sqe->opcode = IORING_OP_RECV;
+            sqe->addr = (uint64_t)(uintptr_t)buf;
+            sqe->len = (uint32_t)len;
+            break;
+        case OL_IO_OP_SEND:
+            sqe->opcode = IORING_OP_SEND;
+            sqe->addr = (uint64_t)(uintptr_t)buf;
+            sqe->len = (uint32_t)len;
+            sqe->msg_flags = MSG_NOSIGNAL;
+            break;
+        case OL_IO_OP_ACCEPT:
+            sqe->opcode = IORING_OP_ACCEPT;
+            sqe->accept_flags = SOCK_NONBLOCK | SOCK_CLOEXEC;
+            break;
+        case OL_IO_OP_CONNECT:
+            sqe->opcode = IORING_OP_CONNECT;
+            sqe->addr = (uint64_t)(uintptr_t)buf;
+            sqe->off = (uint64_t)len; /* sockaddr length */
+            break;
+        default:
+            ol_mutex_unlock(&u->sq_lock);
+            return OL_ERROR;
+    }
+    
+    u->sq_array[index] = index;
+    __atomic_store_n(u->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    u->sq_pending++;
+    
+    ol_mutex_unlock(&u->sq_lock);
+    return OL_SUCCESS;
+}
+
+/**
+ * @brief Move available CQEs into the caller's event array
+ *
+ * @return Number of completions written
+ */
+static int ol_uring_reap(struct ol_uring *u, ol_poll_event_t *out, int cap) {
+    unsigned head = *u->cq_head;
+    unsigned tail = __atomic_load_n(u->cq_tail, __ATOMIC_ACQUIRE);
+    int n = 0;
+    
+    while (head != tail && n < cap) {
+        struct io_uring_cqe *cqe = &u->cqes[head & u->cq_mask];
+        out[n].fd = -1;
+        out[n].mask = OL_POLL_COMPLETE;
+        out[n].tag = cqe->user_data;
+        out[n].result = cqe->res;
+        n++;
+        head++;
+    }
+    
+    __atomic_store_n(u->cq_head, head, __ATOMIC_RELEASE);
+    return n;
+}
+
+#endif /* OL_HAVE_IO_URING */
+
 /* --------------------------------------------------------------------------
  * Public API implementation
  * -------------------------------------------------------------------------- */
 
 ol_poller_t* ol_poller_create(void) {
+    return ol_poller_create_ex(OL_POLLER_BACKEND_DEFAULT);
+}
+
+ol_poller_t* ol_poller_create_ex(ol_poller_backend_t backend) {
     ol_poller_t *p = (ol_poller_t*)calloc(1, sizeof(ol_poller_t));
     if (!p) {
         return NULL;
@@ -146,7 +521,19 @@ ol_poller_t* ol_poller_create(void) {
         return NULL;
     }
     
+#if defined(OL_HAVE_IO_URING)
+    /* NULL ring means no kernel support: plain epoll fallback */
+    p->uring = NULL;
+    if (backend == OL_POLLER_BACKEND_IO_URING) {
+        p->uring = ol_uring_create(p->epfd);
+    }
+#else
+    (void)backend;
+#endif
+    
 #elif defined(OL_BACKEND_KQUEUE)
+    (void)backend;
+    
     p->kq = kqueue();
     if (p->kq < 0) {
         free(p);
@@ -163,6 +550,7 @@ ol_poller_t* ol_poller_create(void) {
     }
     
 #else /* SELECT backend */
+    (void)backend;
     
 #if defined(OL_PLATFORM_WINDOWS)
     /* Initialize Winsock on Windows */
@@ -204,6 +592,9 @@ void ol_poller_destroy(ol_poller_t *p) {
     }
     
 #if defined(OL_BACKEND_EPOLL)
+#if defined(OL_HAVE_IO_URING)
+    ol_uring_destroy(p->uring);
+#endif
     if (p->events) {
         free(p->events);
     }
@@ -230,6 +621,39 @@ void ol_poller_destroy(ol_poller_t *p) {
     free(p);
 }
 
+bool ol_poller_has_completions(const ol_poller_t *p) {
+#if defined(OL_HAVE_IO_URING)
+    return p && p->uring != NULL;
+#else
+    (void)p;
+    return false;
+#endif
+}
+
+int ol_poller_submit(ol_poller_t *p,
+                     ol_io_op_type_t op,
+                     int fd,
+                     void *buf,
+                     size_t len,
+                     uint64_t tag) {
+    if (!p || fd < 0 || tag == OL_POLLER_RESERVED_TAG) {
+        return OL_ERROR;
+    }
+    
+#if defined(OL_HAVE_IO_URING)
+    if (!p->uring) {
+        return OL_ERROR;
+    }
+    
+    return ol_uring_queue(p->uring, op, fd, buf, len, tag);
+#else
+    (void)op;
+    (void)buf;
+    (void)len;
+    return OL_ERROR;
+#endif
+}
+
 int ol_poller_add(ol_poller_t *p, int fd, uint32_t mask, uint64_t tag) {
     if (!p || fd < 0) {
         return OL_ERROR;
@@ -252,12 +676,12 @@ int ol_poller_add(ol_poller_t *p, int fd, uint32_t mask, uint64_t tag) {
     
     if (mask & OL_POLL_IN) {
         EV_SET(&changes[n_changes++], fd, EVFILT_READ,
-               EV_ADD | EV_ENABLE, 0, 0, (void*)(uintptr_t)tag);
+               ol_kqueue_add_flags(mask), 0, 0, (void*)(uintptr_t)tag);
     }
     
     if (mask & OL_POLL_OUT) {
         EV_SET(&changes[n_changes++], fd, EVFILT_WRITE,
-               EV_ADD | EV_ENABLE, 0, 0, (void*)(uintptr_t)tag);
+               ol_kqueue_add_flags(mask), 0, 0, (void*)(uintptr_t)tag);
     }
     
     if (n_changes == 0) {
@@ -361,12 +785,12 @@ int ol_poller_mod(ol_poller_t *p, int fd, uint32_t mask, uint64_t tag) {
     n_changes = 0;
     if (mask & OL_POLL_IN) {
         EV_SET(&changes[n_changes++], fd, EVFILT_READ,
-               EV_ADD | EV_ENABLE, 0, 0, (void*)(uintptr_t)tag);
+               ol_kqueue_add_flags(mask), 0, 0, (void*)(uintptr_t)tag);
     }
     
     if (mask & OL_POLL_OUT) {
         EV_SET(&changes[n_changes++], fd, EVFILT_WRITE,
-               EV_ADD | EV_ENABLE, 0, 0, (void*)(uintptr_t)tag);
+               ol_kqueue_add_flags(mask), 0, 0, (void*)(uintptr_t)tag);
     }
     
     if (n_changes == 0) {
@@ -488,10 +912,29 @@ int ol_poller_wait(ol_poller_t *p,
     /* Calculate timeout */
     int timeout_ms = -1; /* Infinite by default */
     if (dl.when_ns != 0) {
-        int64_t remaining_ms = ol_deadline_remaining_ms(dl);
-        timeout_ms = ol_clamp_poll_timeout_ms(remaining_ms);
+        /* Round up: truncating would spin with a 0 timeout in the last ms */
+        int64_t remaining_ns = ol_deadline_remaining_ns(dl);
+        timeout_ms = ol_clamp_poll_timeout_ms((remaining_ns + 999999) / 1000000LL);
     }
     
+#if defined(OL_HAVE_IO_URING)
+    /* Submit the batch queued since the last wait, then collect any
+     * completions already posted; if there are some, only peek at epoll */
+    int reaped = 0;
+    if (p->uring) {
+        ol_uring_flush(p->uring);
+        reaped = ol_uring_reap(p->uring, out, cap);
+        if (reaped == cap) {
+            return reaped;
+        }
+        if (reaped > 0) {
+            timeout_ms = 0;
+        }
+        out += reaped;
+        cap -= reaped;
+    }
+#endif
+    
     /* Ensure buffer is large enough */
     if (p->capacity < cap) {
         int new_cap = cap;
@@ -507,6 +950,11 @@ int ol_poller_wait(ol_poller_t *p,
     /* Wait for events */
     int n = epoll_wait(p->epfd, p->events, cap, timeout_ms);
     if (n < 0) {
+#if defined(OL_HAVE_IO_URING)
+        if (reaped > 0) {
+            return reaped;
+        }
+#endif
         if (errno == EINTR) {
             return 0; /* Interrupted by signal */
         }
@@ -514,13 +962,36 @@ int ol_poller_wait(ol_poller_t *p,
     }
     
     /* Convert events */
+    int count = 0;
+#if defined(OL_HAVE_IO_URING)
+    bool uring_signaled = false;
+#endif
     for (int i = 0; i < n; i++) {
-        out[i].fd = -1; /* epoll doesn't provide fd in event */
-        out[i].mask = ol_backend_to_mask(p->events[i].events);
-        out[i].tag = p->events[i].data.u64;
+#if defined(OL_HAVE_IO_URING)
+        if (p->events[i].data.u64 == OL_POLLER_RESERVED_TAG && p->uring) {
+            uring_signaled = true;
+            continue;
+        }
+#endif
+        out[count].fd = -1; /* epoll doesn't provide fd in event */
+        out[count].mask = ol_backend_to_mask(p->events[i].events);
+        out[count].tag = p->events[i].data.u64;
+        out[count].result = 0;
+        count++;
     }
     
-    return n;
+#if defined(OL_HAVE_IO_URING)
+    if (uring_signaled) {
+        uint64_t counter;
+        while (read(p->uring->event_fd, &counter, sizeof(counter)) > 0) {
+            /* Reset notifier; CQEs left over are reaped on the next wait */
+        }
+        count += ol_uring_reap(p->uring, out + count, cap - count);
+    }
+    count += reaped;
+#endif
+    
+    return count;
     
 #elif defined(OL_BACKEND_KQUEUE)
     
@@ -558,6 +1029,7 @@ int ol_poller_wait(ol_poller_t *p,
     for (int i = 0; i < n; i++) {
         out[i].fd = (int)p->events[i].ident;
         out[i].tag = (uint64_t)(uintptr_t)p->events[i].udata;
+        out[i].result = 0;
         
         uint32_t mask = 0;
         if (p->events[i].filter == EVFILT_READ) {
@@ -585,9 +1057,9 @@ int ol_poller_wait(ol_poller_t *p,
     /* Calculate timeout */
     struct timeval tv, *ptv = NULL;
     if (dl.when_ns != 0) {
-        int64_t remaining_ms = ol_deadline_remaining_ms(dl);
-        tv.tv_sec = remaining_ms / 1000;
-        tv.tv_usec = (remaining_ms % 1000) * 1000;
+        int64_t remaining_us = (ol_deadline_remaining_ns(dl) + 999) / 1000;
+        tv.tv_sec = (long)(remaining_us / 1000000);
+        tv.tv_usec = (long)(remaining_us % 1000000);
         ptv = &tv;
     }
     
@@ -647,7 +1119,16 @@ int ol_poller_wait(ol_poller_t *p,
             out[count].fd = fd;
             out[count].mask = mask;
             out[count].tag = p->tags[fd];
+            out[count].result = 0;
             count++;
+            
+            /* Emulate one-shot: disarm until ol_poller_mod() re-arms */
+            if (p->masks[fd] & OL_POLL_ONESHOT) {
+                FD_CLR(fd, &p->rfds);
+                FD_CLR(fd, &p->wfds);
+                FD_CLR(fd, &p->efds);
+                p->masks[fd] = OL_POLL_ONESHOT; /* Still registered */
+            }
         }
     }
     
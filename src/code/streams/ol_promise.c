@@ -153,26 +153,24 @@ static void ol_core_unref(ol_core_t *c) {
 }
 
 /**
- * @brief Dispatch continuations
+ * @brief Continuation batch handed to an event loop thread
  */
-static void ol_core_dispatch(ol_core_t *c) {
-    /* Snapshot continuations under lock */
+typedef struct {
+    ol_core_t *core;                /**< Core (referenced until run) */
+    ol_cont_node_t *list;           /**< Continuations to run */
+} ol_cont_batch_t;
+
+/**
+ * @brief Call and free a list of continuations
+ */
+static void ol_core_run_conts(ol_core_t *c, ol_cont_node_t *list) {
     ol_mutex_lock(&c->mu);
-    ol_cont_node_t *list = c->conts;
-    c->conts = NULL; /* Consume list */
-    
     ol_promise_state_t state = c->state;
     const void *value = c->value_taken ? NULL : c->value;
     int error = c->error_code;
     ol_event_loop_t *loop = c->loop;
-    
     ol_mutex_unlock(&c->mu);
     
-    /* Wake event loop if attached */
-    if (loop) {
-        ol_event_loop_wake(loop);
-    }
-    
     /* Call continuations */
     ol_cont_node_t *node = list;
     while (node) {
@@ -189,6 +187,55 @@ static void ol_core_dispatch(ol_core_t *c) {
     }
 }
 
+/**
+ * @brief Run a posted continuation batch (event loop thread)
+ */
+static void ol_core_run_batch(void *arg) {
+    ol_cont_batch_t *batch = (ol_cont_batch_t*)arg;
+    
+    ol_core_run_conts(batch->core, batch->list);
+    ol_core_unref(batch->core);
+    free(batch);
+}
+
+/**
+ * @brief Dispatch continuations
+ *
+ * With an attached loop the continuations are posted to the loop thread
+ * (no loop->mutex involved); otherwise they run on the resolving thread.
+ */
+static void ol_core_dispatch(ol_core_t *c) {
+    /* Snapshot continuations under lock */
+    ol_mutex_lock(&c->mu);
+    ol_cont_node_t *list = c->conts;
+    c->conts = NULL; /* Consume list */
+    ol_event_loop_t *loop = c->loop;
+    ol_mutex_unlock(&c->mu);
+    
+    if (loop) {
+        if (!list) {
+            /* Nothing to run there, just wake the loop */
+            ol_event_loop_wake(loop);
+            return;
+        }
+        
+        ol_cont_batch_t *batch = (ol_cont_batch_t*)malloc(sizeof(ol_cont_batch_t));
+        if (batch) {
+            ol_core_ref(c);
+            batch->core = c;
+            batch->list = list;
+            if (ol_event_loop_post(loop, ol_core_run_batch, batch) != OL_NOMEM) {
+                return;
+            }
+            ol_core_unref(c);
+            free(batch);
+        }
+        /* Could not post: fall back to running inline */
+    }
+    
+    ol_core_run_conts(c, list);
+}
+
 /* --------------------------------------------------------------------------
  * Public API: Promise functions
  * -------------------------------------------------------------------------- */
@@ -435,6 +482,33 @@ int ol_future_then(ol_future_t *f, ol_future_cb cb, void *user_data) {
     }
 }
 
+int ol_future_remove_then(ol_future_t *f, ol_future_cb cb, void *user_data) {
+    if (!f || !f->core || !cb) {
+        return OL_ERROR;
+    }
+    
+    ol_core_t *c = f->core;
+    ol_cont_node_t *removed = NULL;
+    
+    /* Settlement detaches the whole list under the same lock */
+    ol_mutex_lock(&c->mu);
+    for (ol_cont_node_t **link = &c->conts; *link; link = &(*link)->next) {
+        if ((*link)->cb == cb && (*link)->user_data == user_data) {
+            removed = *link;
+            *link = removed->next;
+            break;
+        }
+    }
+    ol_mutex_unlock(&c->mu);
+    
+    if (!removed) {
+        return OL_ERROR;
+    }
+    
+    free(removed);
+    return OL_SUCCESS;
+}
+
 const void* ol_future_get_value_const(const ol_future_t *f) {
     if (!f || !f->core) {
         return NULL;
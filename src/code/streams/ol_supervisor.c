@@ -193,6 +193,40 @@ static child_info_t* supervisor_create_child_info(const ol_child_spec_t* spec,
     return child;
 }
 
+/**
+ * @brief Process entry function wrapper for a supervised child
+ */
+static void child_process_entry(ol_process_t* process, void* arg) {
+    (void)process;
+    child_info_t* child = (child_info_t*)arg;
+    if (!child || !child->spec.fn) return;
+    
+    /* Update child state */
+    child->state = CHILD_STATE_RUNNING;
+    child->start_time = ol_monotonic_now_ns();
+    
+    /* Execute child function */
+    int result = child->spec.fn(child->spec.arg);
+    
+    /* Update exit status */
+    child->exit_status = result;
+    
+    /* Update state */
+    if (result == 0) {
+        child->state = CHILD_STATE_STOPPED;
+    } else {
+        child->state = CHILD_STATE_CRASHED;
+        child->last_crash_time = ol_monotonic_now_ns();
+        child->crash_count++;
+    }
+    
+    /* Update uptime statistics */
+    if (child->start_time > 0) {
+        uint64_t uptime_ms = (ol_monotonic_now_ns() - child->start_time) / 1000000;
+        child->total_uptime_ms += uptime_ms;
+    }
+}
+
 /**
  * @brief Create child process from spec
  */
@@ -205,37 +239,6 @@ static ol_process_t* supervisor_create_child_process(
         return NULL;
     }
     
-    /* Process entry function wrapper */
-    static void child_process_entry(ol_process_t* process, void* arg) {
-        child_info_t* child = (child_info_t*)arg;
-        if (!child || !child->spec.fn) return;
-        
-        /* Update child state */
-        child->state = CHILD_STATE_RUNNING;
-        child->start_time = ol_monotonic_now_ns();
-        
-        /* Execute child function */
-        int result = child->spec.fn(child->spec.arg);
-        
-        /* Update exit status */
-        child->exit_status = result;
-        
-        /* Update state */
-        if (result == 0) {
-            child->state = CHILD_STATE_STOPPED;
-        } else {
-            child->state = CHILD_STATE_CRASHED;
-            child->last_crash_time = ol_monotonic_now_ns();
-            child->crash_count++;
-        }
-        
-        /* Update uptime statistics */
-        if (child->start_time > 0) {
-            uint64_t uptime_ms = (ol_monotonic_now_ns() - child->start_time) / 1000000;
-            child->total_uptime_ms += uptime_ms;
-        }
-    }
-    
     /* Create child process with isolation */
     ol_process_t* process = ol_process_create(
         child_process_entry,
@@ -0,0 +1,118 @@
+/**
+ * @file bench_actor_mailbox.c
+ * @brief Mailbox throughput with 1, 8 and 64 concurrent senders to one actor
+ *
+ * Each sender thread pushes its share of messages to a single pooled actor
+ * as fast as it can; the clock stops when the actor has handled them all.
+ * Every message carries (sender, seq) so the run also checks per-sender FIFO.
+ */
+
+#include "ol_actor.h"
+#include "ol_parallel.h"
+#include "ol_deadlines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#define BENCH_MESSAGES (1 << 21)  /* Messages per run, split across senders */
+#define BENCH_MAX_SENDERS 64
+
+typedef struct {
+    ol_actor_t *actor;
+    uintptr_t sender;
+    size_t count;
+} bench_sender_t;
+
+static atomic_size_t handled;
+static size_t next_seq[BENCH_MAX_SENDERS];
+static atomic_size_t order_errors;
+
+/* Message = (sender << 32) | (seq + 1): never NULL, which is not delivered */
+static int bench_behavior(ol_actor_t *actor, void *msg) {
+    (void)actor;
+    uintptr_t v = (uintptr_t)msg;
+    size_t sender = (size_t)(v >> 32);
+    size_t seq = (size_t)(v & 0xffffffffu) - 1;
+    if (seq != next_seq[sender]) {
+        atomic_fetch_add(&order_errors, 1);
+    }
+    next_seq[sender] = seq + 1;
+    atomic_fetch_add_explicit(&handled, 1, memory_order_release);
+    return 0;
+}
+
+static void *bench_send(void *arg) {
+    bench_sender_t *s = (bench_sender_t*)arg;
+    for (size_t i = 0; i < s->count; i++) {
+        while (ol_actor_send(s->actor, (void*)((s->sender << 32) | (i + 1))) != 0) {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+/* Returns millions of messages per second */
+static double bench_run(ol_parallel_pool_t *pool, int senders) {
+    ol_actor_t *actor = ol_actor_create(pool, 0, NULL, bench_behavior, NULL);
+    if (!actor || ol_actor_start(actor) != 0) {
+        fprintf(stderr, "actor setup failed\n");
+        exit(1);
+    }
+
+    atomic_store(&handled, 0);
+    for (int i = 0; i < senders; i++) {
+        next_seq[i] = 0;
+    }
+
+    pthread_t threads[BENCH_MAX_SENDERS];
+    bench_sender_t work[BENCH_MAX_SENDERS];
+    size_t per_sender = BENCH_MESSAGES / (size_t)senders;
+    size_t total = per_sender * (size_t)senders;
+
+    int64_t start = ol_monotonic_now_ns();
+    for (int i = 0; i < senders; i++) {
+        work[i].actor = actor;
+        work[i].sender = (uintptr_t)i;
+        work[i].count = per_sender;
+        pthread_create(&threads[i], NULL, bench_send, &work[i]);
+    }
+    for (int i = 0; i < senders; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    while (atomic_load_explicit(&handled, memory_order_acquire) < total) {
+        sched_yield();
+    }
+    int64_t elapsed = ol_monotonic_now_ns() - start;
+
+    ol_actor_destroy(actor);
+    return (double)total * 1e3 / (double)elapsed;
+}
+
+int main(void) {
+    static const int configs[] = { 1, 8, 64 };
+
+    ol_parallel_pool_t *pool = ol_parallel_create(2);
+    if (!pool) {
+        fprintf(stderr, "pool setup failed\n");
+        return 1;
+    }
+
+    /* With fewer cores than senders this mostly measures preemption */
+    printf("online CPUs: %ld\n", sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-8s  %12s\n", "senders", "Mmsg/s");
+    for (size_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
+        printf("%-8d  %12.2f\n", configs[i], bench_run(pool, configs[i]));
+    }
+
+    ol_parallel_destroy(pool);
+
+    if (atomic_load(&order_errors) != 0) {
+        fprintf(stderr, "per-sender FIFO violated %zu times\n", atomic_load(&order_errors));
+        return 1;
+    }
+    return 0;
+}
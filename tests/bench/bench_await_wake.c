@@ -0,0 +1,128 @@
+/**
+ * @file bench_await_wake.c
+ * @brief Wake latency of ol_await_future_with_loop: 10 ms polling vs continuation
+ *
+ * A resolver thread fulfills a promise after a fixed delay while the awaiting
+ * thread owns an event loop with a 1 ms periodic timer. Latency is measured
+ * from the fulfill call to the awaiter's return. The polling variant is the
+ * previous implementation (10 ms await slices with a 10 ms sleep between
+ * them), minus its bug of returning OL_TIMEOUT after the first slice; it
+ * never runs the loop, so its timer column stays at zero.
+ */
+
+#include "ol_await.h"
+#include "ol_deadlines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+
+#define BENCH_ROUNDS 40
+#define POLL_SLICE_MS 10
+
+typedef struct {
+    ol_promise_t *promise;
+    int64_t delay_ns;
+    atomic_llong fulfilled_ns;
+} bench_resolver_t;
+
+static size_t timer_ticks;
+
+static void tick_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *user_data) {
+    (void)loop; (void)type; (void)fd; (void)user_data;
+    timer_ticks++;
+}
+
+static void *bench_resolve(void *arg) {
+    bench_resolver_t *r = (bench_resolver_t*)arg;
+    struct timespec ts = { 0, (long)r->delay_ns };
+    nanosleep(&ts, NULL);
+    atomic_store(&r->fulfilled_ns, ol_monotonic_now_ns());
+    ol_promise_fulfill(r->promise, NULL, NULL);
+    return NULL;
+}
+
+/* The pre-continuation await: block in slices, sleep between them */
+static int await_polling(ol_event_loop_t *loop, ol_future_t *f, int64_t deadline_ns) {
+    for (;;) {
+        int64_t now = ol_monotonic_now_ns();
+        if (now >= deadline_ns) {
+            return OL_TIMEOUT;
+        }
+        int64_t slice = deadline_ns - now < POLL_SLICE_MS * 1000000LL
+                            ? deadline_ns - now : POLL_SLICE_MS * 1000000LL;
+        if (ol_future_await(f, now + slice) == 1) {
+            return 1;
+        }
+        ol_event_loop_wake(loop);
+        usleep(POLL_SLICE_MS * 1000);
+    }
+}
+
+static int cmp_i64(const void *a, const void *b) {
+    int64_t x = *(const int64_t*)a, y = *(const int64_t*)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_run(ol_event_loop_t *loop, bool polling, int64_t delay_ns) {
+    int64_t lat[BENCH_ROUNDS];
+    size_t ticks = 0;
+
+    for (int i = 0; i < BENCH_ROUNDS; i++) {
+        bench_resolver_t r;
+        r.promise = ol_promise_create(NULL);
+        r.delay_ns = delay_ns;
+        atomic_init(&r.fulfilled_ns, 0);
+        ol_future_t *f = ol_promise_get_future(r.promise);
+
+        timer_ticks = 0;
+        pthread_t th;
+        pthread_create(&th, NULL, bench_resolve, &r);
+        int64_t deadline = ol_deadline_from_ms(5000).when_ns;
+        int rc = polling ? await_polling(loop, f, deadline)
+                         : ol_await_future_with_loop(loop, f, deadline);
+        int64_t done = ol_monotonic_now_ns();
+        pthread_join(th, NULL);
+        if (rc != 1) {
+            fprintf(stderr, "await failed: %d\n", rc);
+            exit(1);
+        }
+
+        lat[i] = done - atomic_load(&r.fulfilled_ns);
+        ticks += timer_ticks;
+        ol_future_destroy(f);
+        ol_promise_destroy(r.promise);
+    }
+
+    qsort(lat, BENCH_ROUNDS, sizeof(lat[0]), cmp_i64);
+    printf("%-12s  %8.1f  %12.1f  %12.1f  %10.1f\n",
+           polling ? "poll 10ms" : "continuation", (double)delay_ns / 1e6,
+           (double)lat[BENCH_ROUNDS / 2] / 1e3,
+           (double)lat[BENCH_ROUNDS * 99 / 100] / 1e3,
+           (double)ticks / BENCH_ROUNDS);
+}
+
+int main(void) {
+    static const int64_t delays_us[] = { 500, 2000, 15000 };
+
+    ol_event_loop_t *loop = ol_event_loop_create();
+    if (!loop) {
+        fprintf(stderr, "loop setup failed\n");
+        return 1;
+    }
+    /* Keeps the loop busy: each tick is one event served while waiting */
+    ol_event_loop_register_timer(loop, ol_deadline_from_ms(1), 1000000, tick_cb, NULL);
+
+    printf("online CPUs: %ld\n", sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-12s  %8s  %12s  %12s  %10s\n", "await", "delay ms", "p50 us", "p99 us", "ticks/wait");
+    for (size_t i = 0; i < sizeof(delays_us) / sizeof(delays_us[0]); i++) {
+        bench_run(loop, true, delays_us[i] * 1000);
+        bench_run(loop, false, delays_us[i] * 1000);
+    }
+
+    ol_event_loop_destroy(loop);
+    return 0;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file bench_channel.c
+ * @brief Bounded channel throughput for 1P1C, 4P4C and 16P16C
+ *
+ * Compares the bounded channel (lock-free MPMC ring) with a copy of the
+ * bounded channel it replaced: a mutex-guarded node list with one
+ * malloc/free per item and not_empty/not_full condition variables, both
+ * signaled on every operation.
+ */
+
+#include "ol_channel.h"
+#include "ol_deadlines.h"
+#include "ol_lock_mutex.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define BENCH_ITEMS    (1 << 21)  /* Items per run, split across producers */
+#define BENCH_CAPACITY 1024
+
+/* ---- baseline: bounded channel before the ring ---- */
+
+typedef struct bench_node {
+    void *item;
+    struct bench_node *next;
+} bench_node_t;
+
+typedef struct {
+    bench_node_t *head;
+    bench_node_t *tail;
+    size_t size;
+    size_t capacity;
+    ol_mutex_t mutex;
+    ol_cond_t not_empty;
+    ol_cond_t not_full;
+} bench_list_chan_t;
+
+static void bench_list_init(bench_list_chan_t *ch, size_t capacity) {
+    ch->head = ch->tail = NULL;
+    ch->size = 0;
+    ch->capacity = capacity;
+    ol_mutex_init(&ch->mutex);
+    ol_cond_init(&ch->not_empty);
+    ol_cond_init(&ch->not_full);
+}
+
+static void bench_list_destroy(bench_list_chan_t *ch) {
+    while (ch->head) {
+        bench_node_t *n = ch->head;
+        ch->head = n->next;
+        free(n);
+    }
+    ol_cond_destroy(&ch->not_full);
+    ol_cond_destroy(&ch->not_empty);
+    ol_mutex_destroy(&ch->mutex);
+}
+
+static int bench_list_send(bench_list_chan_t *ch, void *item) {
+    ol_mutex_lock(&ch->mutex);
+    while (ch->size >= ch->capacity) {
+        ol_cond_wait_until(&ch->not_full, &ch->mutex, 0);
+    }
+    bench_node_t *n = (bench_node_t*)malloc(sizeof(*n));
+    if (!n) {
+        ol_mutex_unlock(&ch->mutex);
+        return OL_ERROR;
+    }
+    n->item = item;
+    n->next = NULL;
+    if (ch->tail) {
+        ch->tail->next = n;
+    } else {
+        ch->head = n;
+    }
+    ch->tail = n;
+    ch->size++;
+    ol_cond_signal(&ch->not_empty);
+    ol_mutex_unlock(&ch->mutex);
+    return OL_SUCCESS;
+}
+
+static int bench_list_recv(bench_list_chan_t *ch, void **out_item) {
+    ol_mutex_lock(&ch->mutex);
+    while (ch->size == 0) {
+        ol_cond_wait_until(&ch->not_empty, &ch->mutex, 0);
+    }
+    bench_node_t *n = ch->head;
+    ch->head = n->next;
+    if (!ch->head) {
+        ch->tail = NULL;
+    }
+    ch->size--;
+    ol_cond_signal(&ch->not_full);
+    ol_mutex_unlock(&ch->mutex);
+    *out_item = n->item;
+    free(n);
+    return 1;
+}
+
+/* ---- workers ---- */
+
+typedef struct {
+    ol_channel_t *ring;         /**< Ring under test, or NULL */
+    bench_list_chan_t *list;    /**< Baseline when ring is NULL */
+    size_t count;
+} bench_worker_t;
+
+static void *bench_producer(void *arg) {
+    bench_worker_t *w = (bench_worker_t*)arg;
+    for (size_t i = 0; i < w->count; i++) {
+        void *item = (void*)(uintptr_t)(i + 1);
+        int r = w->ring ? ol_channel_send(w->ring, item)
+                        : bench_list_send(w->list, item);
+        if (r != OL_SUCCESS) {
+            fprintf(stderr, "send failed\n");
+            exit(1);
+        }
+    }
+    return NULL;
+}
+
+static void *bench_consumer(void *arg) {
+    bench_worker_t *w = (bench_worker_t*)arg;
+    for (size_t i = 0; i < w->count; i++) {
+        void *item = NULL;
+        int r = w->ring ? ol_channel_recv(w->ring, &item)
+                        : bench_list_recv(w->list, &item);
+        if (r != 1) {
+            fprintf(stderr, "recv failed\n");
+            exit(1);
+        }
+    }
+    return NULL;
+}
+
+/* Returns millions of items per second */
+static double bench_run(bool ring, int pairs) {
+    bench_list_chan_t list;
+    bench_worker_t work = { NULL, NULL, BENCH_ITEMS / (size_t)pairs };
+    pthread_t threads[64];
+
+    if (ring) {
+        work.ring = ol_channel_create(BENCH_CAPACITY, NULL);
+    } else {
+        bench_list_init(&list, BENCH_CAPACITY);
+        work.list = &list;
+    }
+
+    int64_t start = ol_monotonic_now_ns();
+    for (int i = 0; i < pairs; i++) {
+        pthread_create(&threads[i], NULL, bench_consumer, &work);
+        pthread_create(&threads[pairs + i], NULL, bench_producer, &work);
+    }
+    for (int i = 0; i < 2 * pairs; i++) {
+        pthread_join(threads[i], NULL);
+    }
+    int64_t elapsed = ol_monotonic_now_ns() - start;
+
+    if (ring) {
+        ol_channel_destroy(work.ring);
+    } else {
+        bench_list_destroy(&list);
+    }
+    return (double)(work.count * (size_t)pairs) * 1e3 / (double)elapsed;
+}
+
+int main(void) {
+    static const int configs[] = { 1, 4, 16 };
+
+    /* With fewer cores than threads this mostly measures blocking/wakeup */
+    printf("online CPUs: %ld\n", sysconf(_SC_NPROCESSORS_ONLN));
+    printf("%-8s  %14s  %14s  %8s\n", "config", "ring Mitem/s", "old Mitem/s", "speedup");
+    for (size_t i = 0; i < sizeof(configs) / sizeof(configs[0]); i++) {
+        int n = configs[i];
+        double ring = bench_run(true, n);
+        double old = bench_run(false, n);
+        char name[16];
+        snprintf(name, sizeof(name), "%dP%dC", n, n);
+        printf("%-8s  %14.2f  %14.2f  %7.2fx\n", name, ring, old, ring / old);
+    }
+
+    return 0;
+}
@@ -0,0 +1,92 @@
+/**
+ * @file bench_timer_heap.c
+ * @brief Event loop timer scaling from 1k to 1M armed timers
+ *
+ * For each population size N this arms N far-future timers and reports:
+ *  - register / unregister cost per timer (expected O(log N)),
+ *  - an idle loop iteration with nothing due (expected flat in N),
+ *  - expiry of 1000 due timers among N (expected to depend on the 1000 only).
+ * Before the heap, idle iterations and expiry both scanned all N events.
+ */
+
+#include "ol_event_loop.h"
+#include "ol_deadlines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define BENCH_IDLE_ITERS 1000
+#define BENCH_DUE_TIMERS 1000
+
+static size_t fired = 0;
+
+static void bench_timer_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *user_data) {
+    (void)loop; (void)type; (void)fd; (void)user_data;
+    fired++;
+}
+
+static void bench_population(size_t n) {
+    ol_event_loop_t *loop = ol_event_loop_create();
+    uint64_t *ids = (uint64_t*)malloc(n * sizeof(uint64_t));
+    if (!loop || !ids) {
+        fprintf(stderr, "allocation failed for n=%zu\n", n);
+        exit(1);
+    }
+
+    /* Arm N timers an hour out, spread so the heap is not degenerate */
+    int64_t base = ol_monotonic_now_ns() + 3600LL * 1000000000LL;
+    int64_t t0 = ol_monotonic_now_ns();
+    for (size_t i = 0; i < n; i++) {
+        ol_deadline_t dl = { base + (int64_t)((i * 2654435761u) % 1000000u) * 1000 };
+        ids[i] = ol_event_loop_register_timer(loop, dl, 0, bench_timer_cb, NULL);
+        if (ids[i] == 0) {
+            fprintf(stderr, "register failed at %zu\n", i);
+            exit(1);
+        }
+    }
+    int64_t t1 = ol_monotonic_now_ns();
+
+    /* Idle iterations: nothing is due, the wait is bounded by "now" */
+    for (int i = 0; i < BENCH_IDLE_ITERS; i++) {
+        ol_event_loop_run_once(loop, ol_monotonic_now_ns());
+    }
+    int64_t t2 = ol_monotonic_now_ns();
+
+    /* Expiry: a batch of already-due timers among the N */
+    fired = 0;
+    ol_deadline_t now = { ol_monotonic_now_ns() };
+    for (int i = 0; i < BENCH_DUE_TIMERS; i++) {
+        ol_event_loop_register_timer(loop, now, 0, bench_timer_cb, NULL);
+    }
+    int64_t t3 = ol_monotonic_now_ns();
+    while (fired < BENCH_DUE_TIMERS) {
+        ol_event_loop_run_once(loop, ol_monotonic_now_ns());
+    }
+    int64_t t4 = ol_monotonic_now_ns();
+
+    for (size_t i = 0; i < n; i++) {
+        ol_event_loop_unregister(loop, ids[i]);
+    }
+    int64_t t5 = ol_monotonic_now_ns();
+
+    printf("%9zu  %10.1f  %10.1f  %10.1f  %10.1f\n", n,
+           (double)(t1 - t0) / (double)n,
+           (double)(t2 - t1) / BENCH_IDLE_ITERS,
+           (double)(t4 - t3) / BENCH_DUE_TIMERS,
+           (double)(t5 - t4) / (double)n);
+
+    free(ids);
+    ol_event_loop_destroy(loop);
+}
+
+int main(int argc, char **argv) {
+    size_t max_n = argc > 1 ? (size_t)strtoull(argv[1], NULL, 10) : 1000000;
+
+    printf("%9s  %10s  %10s  %10s  %10s\n",
+           "timers", "reg ns", "idle ns", "expire ns", "unreg ns");
+    for (size_t n = 1000; n <= max_n; n *= 10) {
+        bench_population(n);
+    }
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file test_actor_hashmap.c
+ * @brief ol_hashmap: put/get/remove, key collisions and bucket growth
+ */
+
+#include "ol_actor_hashmap.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TEST_ASSERT(cond, msg) \
+do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__); \
+        exit(1); \
+    } \
+} while(0)
+
+static int destroyed;
+
+static void count_dtor(void *value) {
+    (void)value;
+    destroyed++;
+}
+
+/* Test 1: put, get, replace and remove with a value destructor */
+static void test_hashmap_basic(void) {
+    printf("Test 1: Put, get, replace and remove...\n");
+
+    destroyed = 0;
+    ol_hashmap_t *map = ol_hashmap_create(0, count_dtor);
+    TEST_ASSERT(map != NULL, "Failed to create map");
+
+    int a = 1, b = 2, c = 3;
+    TEST_ASSERT(ol_hashmap_put(map, "alpha", 5, &a), "Put alpha failed");
+    TEST_ASSERT(ol_hashmap_put(map, "beta", 4, &b), "Put beta failed");
+    TEST_ASSERT(ol_hashmap_size(map) == 2, "Wrong size after two puts");
+    TEST_ASSERT(ol_hashmap_get(map, "alpha", 5) == &a, "Wrong value for alpha");
+    TEST_ASSERT(ol_hashmap_get(map, "beta", 4) == &b, "Wrong value for beta");
+    TEST_ASSERT(ol_hashmap_get(map, "gamma", 5) == NULL, "Found a missing key");
+
+    /* Keys are compared by length as well as bytes */
+    TEST_ASSERT(ol_hashmap_get(map, "alpha", 4) == NULL, "Key prefix matched");
+
+    /* Replacing destroys the old value, not the new one */
+    TEST_ASSERT(ol_hashmap_put(map, "alpha", 5, &c), "Replace failed");
+    TEST_ASSERT(ol_hashmap_size(map) == 2, "Replace changed the size");
+    TEST_ASSERT(ol_hashmap_get(map, "alpha", 5) == &c, "Replace not visible");
+    TEST_ASSERT(destroyed == 1, "Old value not destroyed on replace");
+
+    TEST_ASSERT(ol_hashmap_remove(map, "alpha", 5), "Remove failed");
+    TEST_ASSERT(!ol_hashmap_remove(map, "alpha", 5), "Removed twice");
+    TEST_ASSERT(ol_hashmap_get(map, "alpha", 5) == NULL, "Removed key still found");
+    TEST_ASSERT(ol_hashmap_size(map) == 1, "Wrong size after remove");
+    TEST_ASSERT(destroyed == 2, "Value not destroyed on remove");
+
+    ol_hashmap_destroy(map);
+    TEST_ASSERT(destroyed == 3, "Value not destroyed with the map");
+    printf("  PASS\n");
+}
+
+/* FNV-1a, as the map hashes keys: used to pick keys that share a bucket */
+static uint64_t fnv1a(const void *key, size_t size) {
+    const unsigned char *p = (const unsigned char*)key;
+    uint64_t h = 14695981039346656037ull;
+    for (size_t i = 0; i < size; i++) {
+        h ^= p[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+/* Test 2: keys sharing a bucket stay distinct, from any chain position */
+static void test_hashmap_collisions(void) {
+    printf("Test 2: Keys in the same bucket...\n");
+
+    /* 8 buckets hold 6 entries before growing; all 6 go to bucket 0 */
+    ol_hashmap_t *map = ol_hashmap_create(8, NULL);
+    TEST_ASSERT(map != NULL, "Failed to create map");
+
+    uint32_t keys[6];
+    uint32_t candidate = 0;
+    for (int i = 0; i < 6; i++) {
+        while ((fnv1a(&candidate, sizeof(candidate)) & 7) != 0) {
+            candidate++;
+        }
+        keys[i] = candidate++;
+        TEST_ASSERT(ol_hashmap_put(map, &keys[i], sizeof(keys[i]), &keys[i]), "Put failed");
+    }
+
+    /* Remove from the middle, then the rest in another order */
+    TEST_ASSERT(ol_hashmap_remove(map, &keys[3], sizeof(keys[3])), "Remove failed");
+    for (int i = 0; i < 6; i++) {
+        void *want = i == 3 ? NULL : &keys[i];
+        TEST_ASSERT(ol_hashmap_get(map, &keys[i], sizeof(keys[i])) == want, "Chain lookup wrong");
+    }
+    for (int i = 5; i >= 0; i--) {
+        TEST_ASSERT(ol_hashmap_remove(map, &keys[i], sizeof(keys[i])) == (i != 3), "Remove wrong");
+    }
+    TEST_ASSERT(ol_hashmap_size(map) == 0, "Map not empty");
+
+    ol_hashmap_destroy(map);
+    printf("  PASS\n");
+}
+
+/* Test 3: growth past the load factor keeps every entry reachable */
+static void test_hashmap_resize(void) {
+    printf("Test 3: Growth from 8 buckets to 100000 entries...\n");
+
+    enum { COUNT = 100000 };
+    ol_hashmap_t *map = ol_hashmap_create(0, NULL);
+    TEST_ASSERT(map != NULL, "Failed to create map");
+
+    for (uintptr_t i = 0; i < COUNT; i++) {
+        TEST_ASSERT(ol_hashmap_put(map, &i, sizeof(i), (void*)(i + 1)), "Put failed");
+    }
+    TEST_ASSERT(ol_hashmap_size(map) == COUNT, "Wrong size after growth");
+    for (uintptr_t i = 0; i < COUNT; i++) {
+        TEST_ASSERT(ol_hashmap_get(map, &i, sizeof(i)) == (void*)(i + 1), "Entry lost in growth");
+    }
+
+    for (uintptr_t i = 0; i < COUNT; i += 2) {
+        TEST_ASSERT(ol_hashmap_remove(map, &i, sizeof(i)), "Remove failed");
+    }
+    TEST_ASSERT(ol_hashmap_size(map) == COUNT / 2, "Wrong size after removes");
+    for (uintptr_t i = 0; i < COUNT; i++) {
+        void *want = (i & 1) ? (void*)(i + 1) : NULL;
+        TEST_ASSERT(ol_hashmap_get(map, &i, sizeof(i)) == want, "Wrong entry after removes");
+    }
+
+    ol_hashmap_clear(map);
+    TEST_ASSERT(ol_hashmap_size(map) == 0, "Clear left entries");
+    uintptr_t k = 1;
+    TEST_ASSERT(ol_hashmap_get(map, &k, sizeof(k)) == NULL, "Cleared entry found");
+
+    ol_hashmap_destroy(map);
+    printf("  PASS\n");
+}
+
+/* Main test runner */
+int main(void) {
+    printf("=== Actor Hashmap Tests ===\n");
+
+    test_hashmap_basic();
+    test_hashmap_collisions();
+    test_hashmap_resize();
+
+    printf("\n=== All Tests PASSED ===\n");
+    return 0;
+}
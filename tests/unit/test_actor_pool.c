@@ -0,0 +1,181 @@
+/**
+ * @file test_actor_pool.c
+ * @brief Pooled actors: destroy after a cancelling shutdown, from a worker
+ *        and with a call still waiting
+ */
+
+#include "ol_actor.h"
+#include "ol_parallel.h"
+#include "ol_deadlines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#define TEST_ASSERT(cond, msg) \
+do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__); \
+        exit(1); \
+    } \
+} while(0)
+
+static atomic_size_t handled;
+
+static int count_behavior(ol_actor_t *actor, void *msg) {
+    (void)actor; (void)msg;
+    atomic_fetch_add(&handled, 1);
+    return 0;
+}
+
+/* Test 1: slices queued at ol_parallel_shutdown(pool, false) are not lost */
+static void test_actor_cancel_shutdown(void) {
+    printf("Test 1: Destroy after a cancelling shutdown...\n");
+
+    ol_parallel_pool_t *pool = ol_parallel_create(2);
+    TEST_ASSERT(pool != NULL, "Failed to create pool");
+
+    enum { ACTORS = 64 };
+    ol_actor_t *actors[ACTORS];
+    for (int i = 0; i < ACTORS; i++) {
+        actors[i] = ol_actor_create(pool, 0, NULL, count_behavior, NULL);
+        TEST_ASSERT(actors[i] != NULL, "Failed to create actor");
+        TEST_ASSERT(ol_actor_start(actors[i]) == 0, "Failed to start actor");
+    }
+
+    /* Leave a run queued for (most) actors, then cancel pending work */
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < ACTORS; i++) {
+            ol_actor_send(actors[i], NULL);
+        }
+    }
+    TEST_ASSERT(ol_parallel_shutdown(pool, false) == 0, "Shutdown failed");
+
+    /* Used to spin forever on a dropped run */
+    for (int i = 0; i < ACTORS; i++) {
+        ol_actor_destroy(actors[i]);
+    }
+    ol_parallel_destroy(pool);
+    printf("  PASS\n");
+}
+
+/* Test 2: destroying an actor from a task on its only worker */
+static atomic_bool destroyed_on_worker;
+
+static void destroy_task(void *arg) {
+    ol_actor_t *actor = (ol_actor_t*)arg;
+    /* The actor's run lands in this worker's own queue, behind us */
+    ol_actor_send(actor, NULL);
+    ol_actor_destroy(actor);
+    atomic_store(&destroyed_on_worker, true);
+}
+
+static void test_actor_destroy_on_worker(void) {
+    printf("Test 2: Destroy from a pool worker...\n");
+
+    ol_parallel_pool_t *pool = ol_parallel_create(1);
+    TEST_ASSERT(pool != NULL, "Failed to create pool");
+
+    ol_actor_t *actor = ol_actor_create(pool, 0, NULL, count_behavior, NULL);
+    TEST_ASSERT(actor != NULL, "Failed to create actor");
+    TEST_ASSERT(ol_actor_start(actor) == 0, "Failed to start actor");
+
+    atomic_store(&destroyed_on_worker, false);
+    TEST_ASSERT(ol_parallel_submit(pool, destroy_task, actor) == 0, "Submit failed");
+
+    int64_t deadline = ol_monotonic_now_ns() + 5000000000LL;
+    while (!atomic_load(&destroyed_on_worker) && ol_monotonic_now_ns() < deadline) {
+        usleep(1000);
+    }
+    TEST_ASSERT(atomic_load(&destroyed_on_worker), "Destroy on a worker deadlocked");
+
+    ol_parallel_destroy(pool);
+    printf("  PASS\n");
+}
+
+/* Test 3: a call cancelled by ol_actor_destroy() returns its record safely */
+static atomic_int call_result;
+static atomic_bool gate_running;
+static atomic_bool gate_open;
+
+static void *call_thread(void *arg) {
+    atomic_store(&call_result, ol_actor_call((ol_actor_t*)arg, NULL, NULL, NULL, 0));
+    return NULL;
+}
+
+/* Holds the only worker so the actor's run stays queued */
+static void gate_task(void *arg) {
+    (void)arg;
+    atomic_store(&gate_running, true);
+    while (!atomic_load(&gate_open)) {
+        sched_yield();
+    }
+}
+
+static uint64_t normal_submitted(ol_parallel_pool_t *pool) {
+    ol_parallel_class_stats_t stats;
+    TEST_ASSERT(ol_parallel_get_class_stats(pool, OL_TASK_PRIORITY_NORMAL, &stats) == 0,
+                "Failed to read pool stats");
+    return stats.submitted;
+}
+
+static void test_actor_destroy_pending_call(void) {
+    printf("Test 3: Destroy with a call waiting...\n");
+
+    ol_parallel_pool_t *pool = ol_parallel_create(1);
+    TEST_ASSERT(pool != NULL, "Failed to create pool");
+
+    for (int round = 0; round < 100; round++) {
+        atomic_store(&gate_running, false);
+        atomic_store(&gate_open, false);
+        TEST_ASSERT(ol_parallel_submit(pool, gate_task, NULL) == 0, "Submit failed");
+        while (!atomic_load(&gate_running)) {
+            sched_yield();
+        }
+
+        ol_actor_t *actor = ol_actor_create(pool, 0, NULL, count_behavior, NULL);
+        TEST_ASSERT(actor != NULL, "Failed to create actor");
+        TEST_ASSERT(ol_actor_start(actor) == 0, "Failed to start actor");
+
+        /* Scheduling the actor's run is the send's last step, so once the
+         * pool has accepted it the caller has left the mailbox: a send
+         * must not overlap ol_actor_destroy() */
+        uint64_t base = normal_submitted(pool);
+        atomic_store(&call_result, 1);
+        pthread_t th;
+        TEST_ASSERT(pthread_create(&th, NULL, call_thread, actor) == 0, "Failed to start caller");
+        while (normal_submitted(pool) == base) {
+            sched_yield();
+        }
+
+        /* The queued run sees the actor closed and leaves the ask queued */
+        ol_actor_close(actor);
+        atomic_store(&gate_open, true);
+
+        /* The caller wakes, and hands its record back, after the destroy */
+        ol_actor_destroy(actor);
+        pthread_join(th, NULL);
+        TEST_ASSERT(atomic_load(&call_result) == -1, "Cancelled call should return -1");
+    }
+
+    ol_parallel_destroy(pool);
+    printf("  PASS\n");
+}
+
+/* Main test runner */
+int main(void) {
+    printf("=== Actor Pool Tests ===\n");
+
+    /* A regression here hangs rather than fails */
+    alarm(60);
+
+    test_actor_cancel_shutdown();
+    test_actor_destroy_on_worker();
+    test_actor_destroy_pending_call();
+
+    printf("\n=== All Tests PASSED ===\n");
+    return 0;
+}
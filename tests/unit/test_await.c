@@ -0,0 +1,82 @@
+/**
+ * @file test_await.c
+ * @brief Awaiting a future while running its event loop
+ */
+
+#include "ol_await.h"
+#include "ol_deadlines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#define TEST_ASSERT(cond, msg) \
+do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__); \
+        exit(1); \
+    } \
+} while(0)
+
+static void *fulfill_later(void *arg) {
+    usleep(20000);
+    ol_promise_fulfill((ol_promise_t*)arg, NULL, NULL);
+    return NULL;
+}
+
+/* Test 1: a future settled from another thread after 20 ms completes */
+static void test_await_settled(void) {
+    printf("Test 1: Await a future settled by another thread...\n");
+
+    ol_event_loop_t *loop = ol_event_loop_create();
+    TEST_ASSERT(loop != NULL, "Failed to create loop");
+    ol_promise_t *p = ol_promise_create(NULL);
+    ol_future_t *f = ol_promise_get_future(p);
+    TEST_ASSERT(p && f, "Failed to create promise");
+
+    pthread_t th;
+    TEST_ASSERT(pthread_create(&th, NULL, fulfill_later, p) == 0, "Failed to start resolver");
+    int rc = ol_await_future_with_loop(loop, f, ol_deadline_from_ms(5000).when_ns);
+    TEST_ASSERT(rc == 1, "Await did not complete");
+    TEST_ASSERT(ol_future_state(f) == OL_PROMISE_FULFILLED, "Future not fulfilled");
+    pthread_join(th, NULL);
+
+    ol_future_destroy(f);
+    ol_promise_destroy(p);
+    ol_event_loop_destroy(loop);
+    printf("  PASS\n");
+}
+
+/* Test 2: timeouts, then the pending promise is destroyed unsettled */
+static void test_await_timeout_then_destroy(void) {
+    printf("Test 2: Timeout, then destroy the pending promise...\n");
+
+    ol_event_loop_t *loop = ol_event_loop_create();
+    TEST_ASSERT(loop != NULL, "Failed to create loop");
+    ol_promise_t *p = ol_promise_create(NULL);
+    ol_future_t *f = ol_promise_get_future(p);
+    TEST_ASSERT(p && f, "Failed to create promise");
+
+    for (int i = 0; i < 3; i++) {
+        int rc = ol_await_future_with_loop(loop, f, ol_deadline_from_ms(5).when_ns);
+        TEST_ASSERT(rc == OL_TIMEOUT, "Await of a pending future should time out");
+    }
+
+    /* The continuations were taken back: nothing may run or leak here */
+    ol_future_destroy(f);
+    ol_promise_destroy(p);
+    ol_event_loop_destroy(loop);
+    printf("  PASS\n");
+}
+
+/* Main test runner */
+int main(void) {
+    printf("=== Await Tests ===\n");
+
+    test_await_settled();
+    test_await_timeout_then_destroy();
+
+    printf("\n=== All Tests PASSED ===\n");
+    return 0;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file test_channel.c
+ * @brief Bounded channels: capacity-1 ring and producer/consumer FIFO
+ */
+
+#include "ol_channel.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+
+#define TEST_ASSERT(cond, msg) \
+do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__); \
+        exit(1); \
+    } \
+} while(0)
+
+#define ITEMS 200000
+
+/* Test 1: a full single-cell ring refuses the second item */
+static void test_capacity_one_full(void) {
+    printf("Test 1: Capacity-1 ring holds one item...\n");
+
+    ol_channel_t *ch = ol_channel_create(1, NULL);
+    TEST_ASSERT(ch != NULL, "Failed to create channel");
+    TEST_ASSERT(ol_channel_capacity(ch) == 1, "Wrong capacity");
+
+    void *item = NULL;
+    for (uintptr_t round = 1; round <= 1000; round++) {
+        TEST_ASSERT(ol_channel_try_send(ch, (void*)round) == 1, "Send to empty ring failed");
+        TEST_ASSERT(ol_channel_try_send(ch, (void*)(round + 5000)) == 0, "Send overwrote an unconsumed item");
+        TEST_ASSERT(ol_channel_len(ch) == 1, "Wrong length when full");
+        TEST_ASSERT(ol_channel_try_recv(ch, &item) == 1 && item == (void*)round, "Wrong item received");
+        TEST_ASSERT(ol_channel_try_recv(ch, &item) == 0, "Received from an empty ring");
+    }
+
+    ol_channel_destroy(ch);
+    printf("  PASS\n");
+}
+
+static void *producer(void *arg) {
+    ol_channel_t *ch = (ol_channel_t*)arg;
+    for (uintptr_t i = 1; i <= ITEMS; i++) {
+        TEST_ASSERT(ol_channel_send(ch, (void*)i) == OL_SUCCESS, "Send failed");
+    }
+    return NULL;
+}
+
+/* Test 2: one producer, one consumer through a single cell: nothing lost */
+static void test_capacity_one_threads(void) {
+    printf("Test 2: Capacity-1 producer/consumer...\n");
+
+    ol_channel_t *ch = ol_channel_create(1, NULL);
+    TEST_ASSERT(ch != NULL, "Failed to create channel");
+
+    pthread_t th;
+    TEST_ASSERT(pthread_create(&th, NULL, producer, ch) == 0, "Failed to start producer");
+    for (uintptr_t want = 1; want <= ITEMS; want++) {
+        void *item = NULL;
+        TEST_ASSERT(ol_channel_recv(ch, &item) == 1, "Recv failed");
+        TEST_ASSERT(item == (void*)want, "Item lost, duplicated or reordered");
+    }
+    pthread_join(th, NULL);
+
+    void *item = NULL;
+    TEST_ASSERT(ol_channel_try_recv(ch, &item) == 0, "Extra item left in the ring");
+
+    ol_channel_destroy(ch);
+    printf("  PASS\n");
+}
+
+/* Main test runner */
+int main(void) {
+    printf("=== Channel Tests ===\n");
+
+    test_capacity_one_full();
+    test_capacity_one_threads();
+
+    printf("\n=== All Tests PASSED ===\n");
+    return 0;
+}
@@ -0,0 +1,134 @@
+/**
+ * @file test_coroutines.c
+ * @brief Stackless coroutines: frame macros, join and cancellation
+ */
+
+#include "ol_coroutines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_ASSERT(cond, msg) \
+do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__); \
+        exit(1); \
+    } \
+} while(0)
+
+typedef struct {
+    int i;
+    int n;
+    int sum;     /* Sum of resume payloads seen so far */
+} counter_frame_t;
+
+/* Yields &i for i = 0..n-1, adds each resume payload, returns &sum */
+static ol_co_step_t counter_step(ol_co_t *co, void *frame, void *payload) {
+    counter_frame_t *f = (counter_frame_t*)frame;
+
+    OL_CO_BEGIN(co);
+    for (f->i = 0; f->i < f->n; f->i++) {
+        OL_CO_YIELD(co, &f->i);
+        if (payload) {
+            f->sum += *(int*)payload;
+        }
+    }
+    OL_CO_RETURN(co, &f->sum);
+    OL_CO_END(co);
+}
+
+/* Runs off the end of the body: OL_CO_END finishes with NULL */
+static ol_co_step_t fallthrough_step(ol_co_t *co, void *frame, void *payload) {
+    (void)frame; (void)payload;
+
+    OL_CO_BEGIN(co);
+    OL_CO_YIELD(co, NULL);
+    OL_CO_END(co);
+}
+
+/* Cancels itself, then yields as if it meant to continue */
+static ol_co_step_t self_cancel_step(ol_co_t *co, void *frame, void *payload) {
+    int *steps = (int*)frame;
+    (void)payload;
+
+    OL_CO_BEGIN(co);
+    (*steps)++;
+    ol_co_cancel(co);
+    OL_CO_YIELD(co, NULL);
+    (*steps)++;
+    OL_CO_END(co);
+}
+
+/* Test 1: BEGIN/YIELD/RETURN resume where they left off */
+static void test_co_yield_resume(void) {
+    printf("Test 1: Stackless yield and resume...\n");
+
+    counter_frame_t init = { 0, 3, 0 };
+    ol_co_t *co = ol_co_stackless_spawn(counter_step, sizeof(init), &init);
+    TEST_ASSERT(co != NULL, "Failed to spawn coroutine");
+    TEST_ASSERT(ol_co_is_alive(co), "New coroutine not alive");
+
+    int inputs[3] = { 10, 20, 30 };
+    TEST_ASSERT(ol_co_resume(co, NULL) == OL_SUCCESS, "First resume failed");
+    for (int k = 0; k < 3; k++) {
+        int *yielded = (int*)ol_co_yielded(co);
+        TEST_ASSERT(yielded != NULL && *yielded == k, "Wrong yielded value");
+        TEST_ASSERT(ol_co_resume(co, &inputs[k]) == OL_SUCCESS, "Resume failed");
+    }
+
+    TEST_ASSERT(!ol_co_is_alive(co), "Coroutine alive after OL_CO_RETURN");
+    TEST_ASSERT(ol_co_resume(co, NULL) != OL_SUCCESS, "Resumed a finished coroutine");
+
+    int *sum = (int*)ol_co_join(co);
+    TEST_ASSERT(sum != NULL && *sum == 60, "Wrong result from join");
+
+    ol_co_destroy(co);
+    printf("  PASS\n");
+}
+
+/* Test 2: join drives a fresh coroutine to OL_CO_END */
+static void test_co_join_end(void) {
+    printf("Test 2: Join runs to OL_CO_END...\n");
+
+    ol_co_t *co = ol_co_stackless_spawn(fallthrough_step, 0, NULL);
+    TEST_ASSERT(co != NULL, "Failed to spawn coroutine");
+
+    TEST_ASSERT(ol_co_join(co) == NULL, "OL_CO_END should finish with NULL");
+    TEST_ASSERT(!ol_co_is_alive(co), "Coroutine alive after join");
+
+    ol_co_destroy(co);
+    printf("  PASS\n");
+}
+
+/* Test 3: a cancel made inside a step sticks once the step returns */
+static void test_co_self_cancel(void) {
+    printf("Test 3: Self-cancel inside a step...\n");
+
+    int steps = 0;
+    ol_co_t *co = ol_co_stackless_spawn(self_cancel_step, sizeof(steps), &steps);
+    TEST_ASSERT(co != NULL, "Failed to spawn coroutine");
+
+    ol_co_resume(co, NULL);
+    TEST_ASSERT(ol_co_is_canceled(co), "Cancel flag lost after the step");
+    TEST_ASSERT(!ol_co_is_alive(co), "Canceled coroutine still alive");
+    TEST_ASSERT(ol_co_resume(co, NULL) != OL_SUCCESS, "Resumed a canceled coroutine");
+
+    ol_co_destroy(co);
+    printf("  PASS\n");
+}
+
+/* Main test runner */
+int main(void) {
+    printf("=== Coroutine Tests ===\n");
+
+    TEST_ASSERT(ol_coroutine_scheduler_init() == OL_SUCCESS, "Scheduler init failed");
+
+    test_co_yield_resume();
+    test_co_join_end();
+    test_co_self_cancel();
+
+    ol_coroutine_scheduler_shutdown();
+
+    printf("\n=== All Tests PASSED ===\n");
+    return 0;
+}
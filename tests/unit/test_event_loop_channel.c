@@ -0,0 +1,125 @@
+/**
+ * @file test_event_loop_channel.c
+ * @brief Channel registrations: delivery and cross-thread unregister
+ */
+
+#include "ol_event_loop.h"
+#include "ol_channel.h"
+#include "ol_deadlines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+
+#define TEST_ASSERT(cond, msg) \
+do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__); \
+        exit(1); \
+    } \
+} while(0)
+
+static atomic_size_t received;
+static atomic_size_t callbacks;
+static atomic_size_t empty_callbacks;
+
+static void *loop_thread(void *arg) {
+    ol_event_loop_run((ol_event_loop_t*)arg);
+    return NULL;
+}
+
+static void drain_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *user_data) {
+    (void)loop;
+    TEST_ASSERT(type == OL_EV_CHANNEL, "Channel callback with wrong type");
+    atomic_fetch_add(&callbacks, 1);
+    if (fd == 0) {
+        atomic_fetch_add(&empty_callbacks, 1);
+    }
+
+    ol_channel_t *ch = (ol_channel_t*)user_data;
+    void *items[32];
+    int got;
+    while ((got = ol_channel_try_recv_many(ch, items, 32)) > 0) {
+        atomic_fetch_add(&received, (size_t)got);
+    }
+}
+
+/* Test 1: items sent from another thread all reach the loop callback */
+static void test_channel_delivery(void) {
+    printf("Test 1: Channel delivery...\n");
+
+    ol_event_loop_t *loop = ol_event_loop_create();
+    TEST_ASSERT(loop != NULL, "Failed to create loop");
+    pthread_t th;
+    TEST_ASSERT(pthread_create(&th, NULL, loop_thread, loop) == 0, "Failed to start loop thread");
+
+    ol_channel_t *ch = ol_channel_create(64, NULL);
+    atomic_store(&received, 0);
+    atomic_store(&callbacks, 0);
+    atomic_store(&empty_callbacks, 0);
+    uint64_t id = ol_event_loop_register_channel(loop, ch, OL_POLL_IN, drain_cb, ch);
+    TEST_ASSERT(id != 0, "Failed to register channel");
+
+    for (uintptr_t i = 1; i <= 10000; i++) {
+        TEST_ASSERT(ol_channel_send(ch, (void*)i) == OL_SUCCESS, "Send failed");
+    }
+
+    int64_t deadline = ol_monotonic_now_ns() + 5000000000LL;
+    while (atomic_load(&received) < 10000 && ol_monotonic_now_ns() < deadline) {
+        sched_yield();
+    }
+    TEST_ASSERT(atomic_load(&received) == 10000, "Items lost");
+    TEST_ASSERT(atomic_load(&empty_callbacks) == 0, "Callback ran with no events");
+    printf("  %zu callbacks for 10000 items\n", atomic_load(&callbacks));
+
+    TEST_ASSERT(ol_event_loop_unregister(loop, id) == OL_SUCCESS, "Unregister failed");
+    ol_channel_destroy(ch);
+
+    ol_event_loop_stop(loop);
+    pthread_join(th, NULL);
+    ol_event_loop_destroy(loop);
+    printf("  PASS\n");
+}
+
+/* Test 2: unregister + destroy from another thread while deliveries run */
+static void test_channel_unregister_race(void) {
+    printf("Test 2: Cross-thread unregister while delivering...\n");
+
+    ol_event_loop_t *loop = ol_event_loop_create();
+    TEST_ASSERT(loop != NULL, "Failed to create loop");
+    pthread_t th;
+    TEST_ASSERT(pthread_create(&th, NULL, loop_thread, loop) == 0, "Failed to start loop thread");
+
+    for (int round = 0; round < 500; round++) {
+        ol_channel_t *ch = ol_channel_create(16, NULL);
+        TEST_ASSERT(ch != NULL, "Failed to create channel");
+        uint64_t id = ol_event_loop_register_channel(loop, ch, OL_POLL_IN, drain_cb, ch);
+        TEST_ASSERT(id != 0, "Failed to register channel");
+
+        for (uintptr_t i = 1; i <= (uintptr_t)(round % 8) + 1; i++) {
+            ol_channel_try_send(ch, (void*)i);
+            sched_yield();
+        }
+
+        TEST_ASSERT(ol_event_loop_unregister(loop, id) == OL_SUCCESS, "Unregister failed");
+        ol_channel_destroy(ch);
+    }
+
+    ol_event_loop_stop(loop);
+    pthread_join(th, NULL);
+    ol_event_loop_destroy(loop);
+    printf("  PASS\n");
+}
+
+/* Main test runner */
+int main(void) {
+    printf("=== Event Loop Channel Tests ===\n");
+
+    test_channel_delivery();
+    test_channel_unregister_race();
+
+    printf("\n=== All Tests PASSED ===\n");
+    return 0;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file test_event_loop_timers.c
+ * @brief Event loop timer heap: expiry order, cancel and periodic re-arm
+ */
+
+#include "ol_event_loop.h"
+#include "ol_deadlines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_ASSERT(cond, msg) \
+do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__); \
+        exit(1); \
+    } \
+} while(0)
+
+static int order[64];
+static int order_len = 0;
+
+static void record_cb(ol_event_loop_t *loop, ol_ev_type_t type, int fd, void *user_data) {
+    (void)loop; (void)fd;
+    TEST_ASSERT(type == OL_EV_TIMER, "Timer callback with wrong type");
+    if (order_len < 64) {
+        order[order_len++] = (int)(intptr_t)user_data;
+    }
+}
+
+static void run_for_ms(ol_event_loop_t *loop, int64_t ms) {
+    int64_t end = ol_monotonic_now_ns() + ms * 1000000LL;
+    while (ol_monotonic_now_ns() < end) {
+        ol_event_loop_run_once(loop, end);
+    }
+}
+
+/* Test 1: timers fire in deadline order, not registration order */
+static void test_timer_order(void) {
+    printf("Test 1: Timer expiry order...\n");
+
+    ol_event_loop_t *loop = ol_event_loop_create();
+    TEST_ASSERT(loop != NULL, "Failed to create loop");
+
+    order_len = 0;
+    static const int delays[] = { 30, 5, 20, 10, 25, 15 };
+    for (int i = 0; i < 6; i++) {
+        uint64_t id = ol_event_loop_register_timer(loop, ol_deadline_from_ms(delays[i]), 0,
+                                                   record_cb, (void*)(intptr_t)delays[i]);
+        TEST_ASSERT(id != 0, "Failed to register timer");
+    }
+
+    run_for_ms(loop, 60);
+
+    TEST_ASSERT(order_len == 6, "Not every timer fired");
+    for (int i = 1; i < order_len; i++) {
+        TEST_ASSERT(order[i - 1] < order[i], "Timers fired out of order");
+    }
+
+    ol_event_loop_destroy(loop);
+    printf("  PASS\n");
+}
+
+/* Test 2: unregistering from the middle of the heap keeps it consistent */
+static void test_timer_cancel(void) {
+    printf("Test 2: Timer cancel...\n");
+
+    ol_event_loop_t *loop = ol_event_loop_create();
+    TEST_ASSERT(loop != NULL, "Failed to create loop");
+
+    order_len = 0;
+    uint64_t ids[10];
+    for (int i = 0; i < 10; i++) {
+        ids[i] = ol_event_loop_register_timer(loop, ol_deadline_from_ms(5 + i * 3), 0,
+                                              record_cb, (void*)(intptr_t)i);
+        TEST_ASSERT(ids[i] != 0, "Failed to register timer");
+    }
+
+    /* Cancel every odd timer */
+    for (int i = 1; i < 10; i += 2) {
+        TEST_ASSERT(ol_event_loop_unregister(loop, ids[i]) == OL_SUCCESS, "Unregister failed");
+    }
+    TEST_ASSERT(ol_event_loop_unregister(loop, ids[1]) != OL_SUCCESS, "Double unregister succeeded");
+
+    run_for_ms(loop, 60);
+
+    TEST_ASSERT(order_len == 5, "Canceled timers fired or live ones did not");
+    for (int i = 0; i < order_len; i++) {
+        TEST_ASSERT(order[i] == i * 2, "Wrong timer fired");
+    }
+
+    ol_event_loop_destroy(loop);
+    printf("  PASS\n");
+}
+
+/* Test 3: a periodic timer re-arms until unregistered */
+static void test_timer_periodic(void) {
+    printf("Test 3: Periodic timer...\n");
+
+    ol_event_loop_t *loop = ol_event_loop_create();
+    TEST_ASSERT(loop != NULL, "Failed to create loop");
+
+    order_len = 0;
+    uint64_t id = ol_event_loop_register_timer(loop, ol_deadline_from_ms(5), 5000000,
+                                               record_cb, (void*)(intptr_t)7);
+    TEST_ASSERT(id != 0, "Failed to register timer");
+
+    run_for_ms(loop, 38);
+    int fired = order_len;
+    TEST_ASSERT(fired >= 3 && fired <= 8, "Periodic timer fired an unexpected number of times");
+
+    TEST_ASSERT(ol_event_loop_unregister(loop, id) == OL_SUCCESS, "Unregister failed");
+    run_for_ms(loop, 15);
+    TEST_ASSERT(order_len == fired, "Periodic timer fired after unregister");
+
+    ol_event_loop_destroy(loop);
+    printf("  PASS\n");
+}
+
+/* Main test runner */
+int main(void) {
+    printf("=== Event Loop Timer Tests ===\n");
+
+    test_timer_order();
+    test_timer_cancel();
+    test_timer_periodic();
+
+    printf("\n=== All Tests PASSED ===\n");
+    return 0;
+}
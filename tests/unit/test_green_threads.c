@@ -0,0 +1,218 @@
+/**
+ * @file test_green_threads.c
+ * @brief Green threads: cooperative yield, netpoller parking, idle sleep
+ *        and the preemption timer's lifetime
+ */
+
+#include "ol_green_threads.h"
+#include "ol_deadlines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <signal.h>
+#include <sys/resource.h>
+
+#define TEST_ASSERT(cond, msg) \
+do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__); \
+        exit(1); \
+    } \
+} while(0)
+
+static int64_t cpu_time_us(void) {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return (int64_t)(ru.ru_utime.tv_sec + ru.ru_stime.tv_sec) * 1000000 +
+           ru.ru_utime.tv_usec + ru.ru_stime.tv_usec;
+}
+
+/* Test 1: yielding threads interleave and all run to completion */
+static int yield_counter = 0;
+
+static void yield_task(void *arg) {
+    for (int i = 0; i < 3; i++) {
+        yield_counter += (int)(intptr_t)arg;
+        ol_gt_yield();
+    }
+}
+
+static void test_gt_yield(void) {
+    printf("Test 1: Cooperative yield...\n");
+
+    yield_counter = 0;
+    ol_gt_t *threads[4];
+    for (int i = 0; i < 4; i++) {
+        threads[i] = ol_gt_spawn(yield_task, (void*)(intptr_t)(i + 1), 64 * 1024);
+        TEST_ASSERT(threads[i] != NULL, "Failed to spawn green thread");
+    }
+
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT(ol_gt_join(threads[i]) == 0, "Join failed");
+        ol_gt_destroy(threads[i]);
+    }
+
+    TEST_ASSERT(yield_counter == 30, "Yield counter mismatch");
+    printf("  PASS\n");
+}
+
+/* Test 2: a reader parks on an empty pipe until a sleeping writer fills it */
+static int pipe_fds[2];
+static char pipe_buf[16];
+static ptrdiff_t pipe_got = -1;
+static int64_t pipe_read_done_ns = 0;
+
+static void pipe_reader(void *arg) {
+    (void)arg;
+    pipe_got = ol_gt_read(pipe_fds[0], pipe_buf, sizeof(pipe_buf), 0);
+    pipe_read_done_ns = ol_monotonic_now_ns();
+}
+
+static void pipe_writer(void *arg) {
+    (void)arg;
+    ol_gt_sleep_until(ol_monotonic_now_ns() + 20000000LL);
+    TEST_ASSERT(write(pipe_fds[1], "hi", 2) == 2, "Pipe write failed");
+}
+
+static void test_gt_pipe_park(void) {
+    printf("Test 2: Park on a pipe read...\n");
+
+    TEST_ASSERT(pipe(pipe_fds) == 0, "pipe() failed");
+
+    int64_t start = ol_monotonic_now_ns();
+    int64_t cpu_start = cpu_time_us();
+    ol_gt_t *reader = ol_gt_spawn(pipe_reader, NULL, 0);
+    ol_gt_t *writer = ol_gt_spawn(pipe_writer, NULL, 0);
+    TEST_ASSERT(reader && writer, "Failed to spawn green threads");
+
+    TEST_ASSERT(ol_gt_join(reader) == 0, "Join reader failed");
+    TEST_ASSERT(ol_gt_join(writer) == 0, "Join writer failed");
+
+    TEST_ASSERT(pipe_got == 2 && memcmp(pipe_buf, "hi", 2) == 0, "Reader got wrong data");
+    TEST_ASSERT(pipe_read_done_ns - start >= 20000000LL, "Reader returned before the write");
+    /* Parked, not spinning: the 20ms wait must not burn a core */
+    TEST_ASSERT(cpu_time_us() - cpu_start < 15000, "Scheduler busy-waited while parked");
+
+    ol_gt_destroy(reader);
+    ol_gt_destroy(writer);
+    close(pipe_fds[0]);
+    close(pipe_fds[1]);
+    printf("  PASS\n");
+}
+
+/* Test 3: a sleeping thread blocks the scheduler instead of spinning */
+static void sleep_task(void *arg) {
+    (void)arg;
+    ol_gt_sleep_until(ol_monotonic_now_ns() + 100000000LL);
+}
+
+static void test_gt_sleep_idle(void) {
+    printf("Test 3: Idle sleep...\n");
+
+    int64_t start = ol_monotonic_now_ns();
+    int64_t cpu_start = cpu_time_us();
+    ol_gt_t *gt = ol_gt_spawn(sleep_task, NULL, 0);
+    TEST_ASSERT(gt != NULL, "Failed to spawn green thread");
+    TEST_ASSERT(ol_gt_join(gt) == 0, "Join failed");
+
+    TEST_ASSERT(ol_monotonic_now_ns() - start >= 100000000LL, "Woke before the deadline");
+    TEST_ASSERT(cpu_time_us() - cpu_start < 30000, "Scheduler busy-waited while sleeping");
+
+    ol_gt_destroy(gt);
+    printf("  PASS\n");
+}
+
+/* Test 4: driving threads with ol_gt_resume from the root context */
+static void test_gt_resume_loop(void) {
+    printf("Test 4: Resume loop...\n");
+
+    yield_counter = 0;
+    ol_gt_t *threads[8];
+    for (int i = 0; i < 8; i++) {
+        threads[i] = ol_gt_spawn(yield_task, (void*)(intptr_t)1, 64 * 1024);
+        TEST_ASSERT(threads[i] != NULL, "Failed to spawn green thread");
+    }
+
+    for (int i = 0; i < 8; i++) {
+        while (ol_gt_is_alive(threads[i])) {
+            ol_gt_resume(threads[i]);
+        }
+        ol_gt_destroy(threads[i]);
+    }
+
+    TEST_ASSERT(yield_counter == 24, "Resume counter mismatch");
+    printf("  PASS\n");
+}
+
+#if defined(__linux__)
+/* Test 5: the SIGURG timer stops once no preemptive thread is left */
+static volatile sig_atomic_t timer_ticks = 0;
+
+static void count_timer_ticks(int sig, siginfo_t *info, void *uctx) {
+    (void)sig; (void)uctx;
+    if (info->si_code == SI_TIMER) {
+        timer_ticks++;
+    }
+}
+
+static void spin_cpu_us(int64_t us) {
+    int64_t until = cpu_time_us() + us;
+    while (cpu_time_us() < until) {
+    }
+}
+
+static void preemptive_task(void *arg) {
+    (void)arg;
+    spin_cpu_us(20000);
+}
+
+static void test_gt_preempt_timer_disarm(void) {
+    printf("Test 5: Preemption timer disarmed after the last preemptive thread...\n");
+
+    ol_gt_config_t config;
+    memset(&config, 0, sizeof(config));
+    config.priority = OL_GT_PRIORITY_NORMAL;
+    config.sched_policy = OL_GT_SCHED_PREEMPTIVE;
+    config.numa_node = -1;
+
+    ol_gt_t *gt = ol_gt_spawn_ex(preemptive_task, NULL, &config);
+    TEST_ASSERT(gt != NULL, "Failed to spawn preemptive thread");
+    TEST_ASSERT(ol_gt_join(gt) == 0, "Join failed");
+    ol_gt_destroy(gt);
+
+    /* Count timer signals ourselves while burning several slices of CPU */
+    struct sigaction sa, prev;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_sigaction = count_timer_ticks;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    TEST_ASSERT(sigaction(SIGURG, &sa, &prev) == 0, "sigaction failed");
+    spin_cpu_us(100000);
+    TEST_ASSERT(sigaction(SIGURG, &prev, NULL) == 0, "sigaction failed");
+
+    TEST_ASSERT(timer_ticks == 0, "Preemption timer still firing");
+    printf("  PASS\n");
+}
+#endif
+
+/* Main test runner */
+int main(void) {
+    printf("=== Green Thread Tests ===\n");
+
+    TEST_ASSERT(ol_gt_scheduler_init() == 0, "Scheduler init failed");
+
+    test_gt_yield();
+    test_gt_pipe_park();
+    test_gt_sleep_idle();
+    test_gt_resume_loop();
+#if defined(__linux__)
+    test_gt_preempt_timer_disarm();
+#endif
+
+    ol_gt_scheduler_shutdown();
+
+    printf("\n=== All Tests PASSED ===\n");
+    return 0;
+}
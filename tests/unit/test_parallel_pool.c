@@ -0,0 +1,197 @@
+/**
+ * @file test_parallel_pool.c
+ * @brief Thread pool scheduling: stealing from a busy worker's deque,
+ *        exactly-once execution across all queues, shutdown of parked workers
+ */
+
+#include "ol_parallel.h"
+#include "ol_deadlines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#define TEST_ASSERT(cond, msg) \
+do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__); \
+        exit(1); \
+    } \
+} while(0)
+
+/* Test 1: tasks queued on one worker's deque are stolen by the others */
+#define STEAL_TASKS 64
+
+static pthread_t spawner_thread;
+static atomic_int steal_done;
+static atomic_int steal_on_spawner;
+
+static void steal_child(void *arg) {
+    (void)arg;
+    if (pthread_equal(pthread_self(), spawner_thread)) {
+        atomic_fetch_add(&steal_on_spawner, 1);
+    }
+    atomic_fetch_add(&steal_done, 1);
+}
+
+/* Fills its own deque, then holds its worker without helping: only
+ * thieves can run the children */
+static void steal_spawner(void *arg) {
+    ol_parallel_pool_t *pool = (ol_parallel_pool_t*)arg;
+    spawner_thread = pthread_self();
+    for (int i = 0; i < STEAL_TASKS; i++) {
+        TEST_ASSERT(ol_parallel_submit(pool, steal_child, NULL) == 0, "Submit failed");
+    }
+
+    int64_t deadline = ol_monotonic_now_ns() + 10000000000LL;
+    while (atomic_load(&steal_done) < STEAL_TASKS && ol_monotonic_now_ns() < deadline) {
+        sched_yield();
+    }
+}
+
+static void test_steal_imbalanced(void) {
+    printf("Test 1: Stealing from an imbalanced submit...\n");
+
+    ol_parallel_pool_t *pool = ol_parallel_create(4);
+    TEST_ASSERT(pool != NULL, "Failed to create pool");
+
+    atomic_store(&steal_done, 0);
+    atomic_store(&steal_on_spawner, 0);
+    TEST_ASSERT(ol_parallel_submit(pool, steal_spawner, pool) == 0, "Submit failed");
+    TEST_ASSERT(ol_parallel_flush(pool) == 0, "Flush failed");
+
+    TEST_ASSERT(atomic_load(&steal_done) == STEAL_TASKS, "Children left on a busy worker");
+    TEST_ASSERT(atomic_load(&steal_on_spawner) == 0, "Spawner ran its own children");
+
+    ol_parallel_destroy(pool);
+    printf("  PASS\n");
+}
+
+/* Test 2: every task runs exactly once, whichever queue it went through */
+#define ONCE_TASKS  120000
+#define ONCE_FANOUT 100
+
+static atomic_uchar once_runs[ONCE_TASKS];
+
+static void once_task(void *arg) {
+    atomic_fetch_add(&once_runs[(uintptr_t)arg], 1);
+}
+
+typedef struct {
+    ol_parallel_pool_t *pool;
+    size_t begin;
+    size_t end;
+} once_fanout_t;
+
+/* Submits from a worker: its own deque first, the injection queue once full */
+static void once_fanout(void *arg) {
+    once_fanout_t *f = (once_fanout_t*)arg;
+    for (size_t i = f->begin; i < f->end; i++) {
+        TEST_ASSERT(ol_parallel_submit(f->pool, once_task, (void*)(uintptr_t)i) == 0,
+                    "Submit from a worker failed");
+    }
+}
+
+static void test_exactly_once(void) {
+    printf("Test 2: All tasks run exactly once...\n");
+
+    ol_parallel_pool_t *pool = ol_parallel_create(4);
+    TEST_ASSERT(pool != NULL, "Failed to create pool");
+
+    const size_t third = ONCE_TASKS / 3;
+
+    /* External submits: the injection queue */
+    for (size_t i = 0; i < third; i++) {
+        TEST_ASSERT(ol_parallel_submit(pool, once_task, (void*)(uintptr_t)i) == 0,
+                    "Submit failed");
+    }
+
+    /* One batch under a single lock */
+    void **args = (void**)malloc(third * sizeof(void*));
+    TEST_ASSERT(args != NULL, "Out of memory");
+    for (size_t i = 0; i < third; i++) {
+        args[i] = (void*)(uintptr_t)(third + i);
+    }
+    TEST_ASSERT(ol_parallel_submit_batch(pool, once_task, args, third) == (int)third,
+                "Batch submit failed");
+
+    /* Worker-local deques, stolen from by the others */
+    once_fanout_t fan[ONCE_FANOUT];
+    size_t rest = ONCE_TASKS - 2 * third;
+    for (size_t i = 0; i < ONCE_FANOUT; i++) {
+        fan[i].pool = pool;
+        fan[i].begin = 2 * third + rest * i / ONCE_FANOUT;
+        fan[i].end = 2 * third + rest * (i + 1) / ONCE_FANOUT;
+        TEST_ASSERT(ol_parallel_submit(pool, once_fanout, &fan[i]) == 0, "Submit failed");
+    }
+
+    TEST_ASSERT(ol_parallel_flush(pool) == 0, "Flush failed");
+    for (size_t i = 0; i < ONCE_TASKS; i++) {
+        TEST_ASSERT(atomic_load(&once_runs[i]) == 1, "Task lost or run twice");
+    }
+
+    ol_parallel_class_stats_t stats;
+    TEST_ASSERT(ol_parallel_get_class_stats(pool, OL_TASK_PRIORITY_NORMAL, &stats) == 0,
+                "Stats failed");
+    TEST_ASSERT(stats.completed == ONCE_TASKS + ONCE_FANOUT, "Completed count mismatch");
+    TEST_ASSERT(stats.queued == 0, "Tasks still queued after flush");
+
+    free(args);
+    ol_parallel_destroy(pool);
+    printf("  PASS\n");
+}
+
+/* Test 3: parked workers wake for new work and for shutdown */
+static atomic_int parked_ran;
+
+static void parked_task(void *arg) {
+    (void)arg;
+    atomic_fetch_add(&parked_ran, 1);
+}
+
+static void test_shutdown_parked(void) {
+    printf("Test 3: Shutdown with parked workers...\n");
+
+    for (int drain = 0; drain <= 1; drain++) {
+        ol_parallel_pool_t *pool = ol_parallel_create(4);
+        TEST_ASSERT(pool != NULL, "Failed to create pool");
+
+        /* Idle long enough for every worker to park */
+        usleep(20000);
+        atomic_store(&parked_ran, 0);
+        TEST_ASSERT(ol_parallel_submit(pool, parked_task, NULL) == 0, "Submit failed");
+        TEST_ASSERT(ol_parallel_flush(pool) == 0, "Flush failed");
+        TEST_ASSERT(atomic_load(&parked_ran) == 1, "Parked pool did not run the task");
+
+        usleep(20000);
+        int64_t start = ol_monotonic_now_ns();
+        TEST_ASSERT(ol_parallel_shutdown(pool, drain != 0) == 0, "Shutdown failed");
+        TEST_ASSERT(ol_monotonic_now_ns() - start < 1000000000LL, "Parked workers not woken");
+
+        TEST_ASSERT(!ol_parallel_is_running(pool), "Pool still running");
+        TEST_ASSERT(ol_parallel_submit(pool, parked_task, NULL) == -2,
+                    "Submit after shutdown accepted");
+        ol_parallel_destroy(pool);
+    }
+
+    printf("  PASS\n");
+}
+
+/* Main test runner */
+int main(void) {
+    printf("=== Parallel Pool Tests ===\n");
+
+    /* A lost wake-up hangs rather than fails */
+    alarm(60);
+
+    test_steal_imbalanced();
+    test_exactly_once();
+    test_shutdown_parked();
+
+    printf("\n=== All Tests PASSED ===\n");
+    return 0;
+}
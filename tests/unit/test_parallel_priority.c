@@ -0,0 +1,279 @@
+/**
+ * @file test_parallel_priority.c
+ * @brief Priority classes and task groups: HIGH earliest-deadline order,
+ *        the LOW share under load, per-class counters, group wait on a worker
+ */
+
+#include "ol_parallel.h"
+#include "ol_deadlines.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <sched.h>
+#include <unistd.h>
+
+#define TEST_ASSERT(cond, msg) \
+do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__); \
+        exit(1); \
+    } \
+} while(0)
+
+/* Holds the only worker while a test fills the queues */
+static atomic_bool gate_running;
+static atomic_bool gate_open;
+
+static void gate_task(void *arg) {
+    (void)arg;
+    atomic_store(&gate_running, true);
+    while (!atomic_load(&gate_open)) {
+        sched_yield();
+    }
+}
+
+static void gate_close(ol_parallel_pool_t *pool) {
+    atomic_store(&gate_running, false);
+    atomic_store(&gate_open, false);
+    TEST_ASSERT(ol_parallel_submit(pool, gate_task, NULL) == 0, "Submit failed");
+    while (!atomic_load(&gate_running)) {
+        sched_yield();
+    }
+}
+
+/* Tests 1 and 2: run order across the classes, and their counters */
+#define ORDER_MAX 16
+
+static int order[ORDER_MAX];
+static atomic_int order_len;
+
+static void record_task(void *arg) {
+    int i = atomic_fetch_add(&order_len, 1);
+    if (i < ORDER_MAX) {
+        order[i] = (int)(intptr_t)arg;
+    }
+}
+
+static ol_parallel_pool_t *order_pool;
+
+static void test_class_order(void) {
+    printf("Test 1: HIGH in deadline order, then NORMAL, then LOW...\n");
+
+    order_pool = ol_parallel_create(1);
+    TEST_ASSERT(order_pool != NULL, "Failed to create pool");
+    ol_parallel_pool_t *pool = order_pool;
+
+    gate_close(pool);
+    atomic_store(&order_len, 0);
+
+    /* Submitted out of order; the tag is the expected position */
+    int64_t now = ol_monotonic_now_ns();
+    const int64_t sec = 1000000000LL;
+    TEST_ASSERT(ol_parallel_submit_ex(pool, record_task, (void*)7, OL_TASK_PRIORITY_LOW, 0) == 0,
+                "Submit failed");
+    TEST_ASSERT(ol_parallel_submit(pool, record_task, (void*)5) == 0, "Submit failed");
+    TEST_ASSERT(ol_parallel_submit_ex(pool, record_task, (void*)4, OL_TASK_PRIORITY_HIGH, 0) == 0,
+                "Submit failed");
+    TEST_ASSERT(ol_parallel_submit_ex(pool, record_task, (void*)3, OL_TASK_PRIORITY_HIGH,
+                                      now + 30 * sec) == 0, "Submit failed");
+    TEST_ASSERT(ol_parallel_submit_ex(pool, record_task, (void*)1, OL_TASK_PRIORITY_HIGH,
+                                      now + 10 * sec) == 0, "Submit failed");
+    TEST_ASSERT(ol_parallel_submit_ex(pool, record_task, (void*)8, OL_TASK_PRIORITY_LOW, 0) == 0,
+                "Submit failed");
+    TEST_ASSERT(ol_parallel_submit(pool, record_task, (void*)6) == 0, "Submit failed");
+    TEST_ASSERT(ol_parallel_submit_ex(pool, record_task, (void*)2, OL_TASK_PRIORITY_HIGH,
+                                      now + 20 * sec) == 0, "Submit failed");
+    /* Already late: earliest deadline of all, and counted as a miss */
+    TEST_ASSERT(ol_parallel_submit_ex(pool, record_task, (void*)0, OL_TASK_PRIORITY_HIGH,
+                                      now - 1) == 0, "Submit failed");
+
+    ol_parallel_class_stats_t st;
+    TEST_ASSERT(ol_parallel_get_class_stats(pool, OL_TASK_PRIORITY_HIGH, &st) == 0, "Stats failed");
+    TEST_ASSERT(st.queued == 5, "HIGH queue depth mismatch");
+    TEST_ASSERT(ol_parallel_get_class_stats(pool, OL_TASK_PRIORITY_NORMAL, &st) == 0, "Stats failed");
+    TEST_ASSERT(st.queued == 2, "NORMAL queue depth mismatch");
+    TEST_ASSERT(ol_parallel_get_class_stats(pool, OL_TASK_PRIORITY_LOW, &st) == 0, "Stats failed");
+    TEST_ASSERT(st.queued == 2, "LOW queue depth mismatch");
+
+    atomic_store(&gate_open, true);
+    TEST_ASSERT(ol_parallel_flush(pool) == 0, "Flush failed");
+
+    TEST_ASSERT(atomic_load(&order_len) == 9, "Tasks lost");
+    for (int i = 0; i < 9; i++) {
+        TEST_ASSERT(order[i] == i, "Tasks ran out of class/deadline order");
+    }
+
+    printf("  PASS\n");
+}
+
+static void test_class_stats(void) {
+    printf("Test 2: Per-class counters...\n");
+
+    /* Counters left by test 1 (the gate is one more NORMAL task) */
+    ol_parallel_pool_t *pool = order_pool;
+    ol_parallel_class_stats_t st;
+
+    TEST_ASSERT(ol_parallel_get_class_stats(pool, OL_TASK_PRIORITY_HIGH, &st) == 0, "Stats failed");
+    TEST_ASSERT(st.submitted == 5 && st.completed == 5 && st.queued == 0, "HIGH counts mismatch");
+    TEST_ASSERT(st.wait_samples == 5, "Every HIGH task is timed");
+    TEST_ASSERT(st.wait_ns_max > 0 && st.wait_ns_total >= st.wait_ns_max, "HIGH wait times");
+    TEST_ASSERT(st.deadline_misses == 1, "HIGH deadline misses mismatch");
+
+    TEST_ASSERT(ol_parallel_get_class_stats(pool, OL_TASK_PRIORITY_NORMAL, &st) == 0, "Stats failed");
+    TEST_ASSERT(st.submitted == 3 && st.completed == 3 && st.queued == 0, "NORMAL counts mismatch");
+    TEST_ASSERT(st.wait_samples <= st.submitted, "NORMAL timed more than it ran");
+    TEST_ASSERT(st.deadline_misses == 0, "NORMAL has no deadlines");
+
+    TEST_ASSERT(ol_parallel_get_class_stats(pool, OL_TASK_PRIORITY_LOW, &st) == 0, "Stats failed");
+    TEST_ASSERT(st.submitted == 2 && st.completed == 2 && st.queued == 0, "LOW counts mismatch");
+    TEST_ASSERT(st.wait_samples == 2, "Every LOW task is timed");
+
+    TEST_ASSERT(ol_parallel_get_class_stats(pool, (ol_task_priority_t)OL_TASK_PRIORITY_COUNT, &st) == -1,
+                "Invalid class accepted");
+
+    /* Dropped tasks leave the queue without completing */
+    gate_close(pool);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT(ol_parallel_submit_ex(pool, record_task, NULL, OL_TASK_PRIORITY_LOW, 0) == 0,
+                    "Submit failed");
+    }
+    atomic_store(&gate_open, true);
+    TEST_ASSERT(ol_parallel_shutdown(pool, false) == 0, "Shutdown failed");
+    TEST_ASSERT(ol_parallel_get_class_stats(pool, OL_TASK_PRIORITY_LOW, &st) == 0, "Stats failed");
+    TEST_ASSERT(st.submitted == 5 && st.queued == 0, "Dropped LOW tasks still queued");
+    TEST_ASSERT(st.completed <= 5, "LOW completed more than submitted");
+
+    ol_parallel_destroy(pool);
+    order_pool = NULL;
+    printf("  PASS\n");
+}
+
+/* Test 3: LOW tasks progress while NORMAL work never runs out */
+#define LOW_TASKS 8
+
+static atomic_bool load_stop;
+static atomic_size_t normal_runs;
+static atomic_int low_done;
+
+static void normal_load(void *arg) {
+    atomic_fetch_add(&normal_runs, 1);
+    if (!atomic_load(&load_stop)) {
+        /* From the worker: lands in its own deque, ahead of LOW */
+        TEST_ASSERT(ol_parallel_submit((ol_parallel_pool_t*)arg, normal_load, arg) == 0,
+                    "Resubmit failed");
+    }
+}
+
+static void low_task(void *arg) {
+    (void)arg;
+    atomic_fetch_add(&low_done, 1);
+}
+
+static void test_low_share(void) {
+    printf("Test 3: LOW progress under constant NORMAL load...\n");
+
+    ol_parallel_pool_t *pool = ol_parallel_create(1);
+    TEST_ASSERT(pool != NULL, "Failed to create pool");
+
+    atomic_store(&load_stop, false);
+    atomic_store(&normal_runs, 0);
+    atomic_store(&low_done, 0);
+    for (int i = 0; i < 2; i++) {
+        TEST_ASSERT(ol_parallel_submit(pool, normal_load, pool) == 0, "Submit failed");
+    }
+    for (int i = 0; i < LOW_TASKS; i++) {
+        TEST_ASSERT(ol_parallel_submit_ex(pool, low_task, NULL, OL_TASK_PRIORITY_LOW, 0) == 0,
+                    "Submit failed");
+    }
+
+    int64_t deadline = ol_monotonic_now_ns() + 10000000000LL;
+    while (atomic_load(&low_done) < LOW_TASKS && ol_monotonic_now_ns() < deadline) {
+        usleep(1000);
+    }
+    size_t normal_at_low = atomic_load(&normal_runs);
+    atomic_store(&load_stop, true);
+    TEST_ASSERT(ol_parallel_flush(pool) == 0, "Flush failed");
+
+    TEST_ASSERT(atomic_load(&low_done) == LOW_TASKS, "LOW tasks starved by NORMAL load");
+    /* Each LOW task took one pick in OL_POOL_LOW_EVERY (32) */
+    TEST_ASSERT(normal_at_low >= (size_t)LOW_TASKS * 16, "LOW ran more than its share");
+
+    ol_parallel_destroy(pool);
+    printf("  PASS\n");
+}
+
+/* Test 4: a worker waiting on a group runs the group's tasks meanwhile */
+#define GROUP_OUTER    6
+#define GROUP_CHILDREN 200
+
+typedef struct {
+    ol_parallel_pool_t *pool;
+    atomic_int children;
+    int seen_after_wait;
+    int rc;
+} group_job_t;
+
+static void group_child(void *arg) {
+    atomic_fetch_add(&((group_job_t*)arg)->children, 1);
+}
+
+static void group_outer(void *arg) {
+    group_job_t *job = (group_job_t*)arg;
+    ol_task_group_t *g = ol_task_group_create(job->pool);
+    TEST_ASSERT(g != NULL, "Failed to create group");
+    for (int i = 0; i < GROUP_CHILDREN; i++) {
+        TEST_ASSERT(ol_task_group_run(g, group_child, job) == 0, "Group run failed");
+    }
+    job->rc = ol_task_group_wait(g);
+    job->seen_after_wait = atomic_load(&job->children);
+    ol_task_group_destroy(g);
+}
+
+static void test_group_wait_on_worker(void) {
+    printf("Test 4: Task group wait from a worker...\n");
+
+    /* More waiting tasks than workers: every worker ends up waiting */
+    static const size_t threads[] = { 1, 2 };
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        ol_parallel_pool_t *pool = ol_parallel_create(threads[t]);
+        TEST_ASSERT(pool != NULL, "Failed to create pool");
+
+        group_job_t jobs[GROUP_OUTER];
+        for (int i = 0; i < GROUP_OUTER; i++) {
+            jobs[i].pool = pool;
+            atomic_init(&jobs[i].children, 0);
+            jobs[i].seen_after_wait = -1;
+            jobs[i].rc = -1;
+            TEST_ASSERT(ol_parallel_submit(pool, group_outer, &jobs[i]) == 0, "Submit failed");
+        }
+        TEST_ASSERT(ol_parallel_flush(pool) == 0, "Flush failed");
+
+        for (int i = 0; i < GROUP_OUTER; i++) {
+            TEST_ASSERT(jobs[i].rc == 0, "Group wait failed");
+            TEST_ASSERT(jobs[i].seen_after_wait == GROUP_CHILDREN,
+                        "Group wait returned before its tasks finished");
+        }
+
+        ol_parallel_destroy(pool);
+    }
+
+    printf("  PASS\n");
+}
+
+/* Main test runner */
+int main(void) {
+    printf("=== Parallel Priority Tests ===\n");
+
+    /* Starvation or a blocked group wait hangs rather than fails */
+    alarm(60);
+
+    test_class_order();
+    test_class_stats();
+    test_low_share();
+    test_group_wait_on_worker();
+
+    printf("\n=== All Tests PASSED ===\n");
+    return 0;
+}
@@ -0,0 +1,213 @@
+/**
+ * @file test_parallel_reduce.c
+ * @brief Data-parallel loops: ordered combine of ol_parallel_reduce, empty
+ *        and single-index ranges, nested reduce from inside pool tasks
+ */
+
+#include "ol_parallel.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+#define TEST_ASSERT(cond, msg) \
+do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__); \
+        exit(1); \
+    } \
+} while(0)
+
+/* Test 1: partial results are combined in range order.
+ * The accumulator is the run of indices it covers; appending a run that
+ * does not start right after it is an ordering error. Associative, but
+ * not commutative. */
+typedef struct {
+    size_t first;
+    size_t last;
+    size_t count;
+    int ordered;
+} span_acc_t;
+
+static void span_reduce(size_t begin, size_t end, void *acc, void *ctx) {
+    (void)ctx;
+    span_acc_t *a = (span_acc_t*)acc;
+    if (a->count == 0) {
+        a->first = begin;
+    } else if (a->last + 1 != begin) {
+        a->ordered = 0;
+    }
+    a->last = end - 1;
+    a->count += end - begin;
+}
+
+static void span_combine(void *acc, const void *other, void *ctx) {
+    (void)ctx;
+    span_acc_t *a = (span_acc_t*)acc;
+    const span_acc_t *b = (const span_acc_t*)other;
+    if (b->count == 0) {
+        return;
+    }
+    if (a->count == 0) {
+        a->first = b->first;
+    } else if (a->last + 1 != b->first) {
+        a->ordered = 0;
+    }
+    a->last = b->last;
+    a->count += b->count;
+    a->ordered &= b->ordered;
+}
+
+static void test_reduce_ordered(void) {
+    printf("Test 1: Ordered combine with a non-commutative operator...\n");
+
+    ol_parallel_pool_t *pool = ol_parallel_create(4);
+    TEST_ASSERT(pool != NULL, "Failed to create pool");
+
+    static const size_t grains[] = { 1, 7, 0 };
+    for (int round = 0; round < 20; round++) {
+        for (size_t g = 0; g < sizeof(grains) / sizeof(grains[0]); g++) {
+            span_acc_t acc = { 0, 0, 0, 1 };
+            TEST_ASSERT(ol_parallel_reduce(pool, 100, 20100, grains[g], &acc, sizeof(acc),
+                                           span_reduce, span_combine, NULL) == 0,
+                        "Reduce failed");
+            TEST_ASSERT(acc.ordered, "Partial results combined out of order");
+            TEST_ASSERT(acc.first == 100 && acc.last == 20099, "Wrong range covered");
+            TEST_ASSERT(acc.count == 20000, "Indices lost or repeated");
+        }
+    }
+
+    ol_parallel_destroy(pool);
+    printf("  PASS\n");
+}
+
+/* Test 2: empty and single-index ranges */
+static atomic_int for_calls;
+static atomic_size_t for_begin;
+static atomic_size_t for_end;
+
+static void record_range(size_t begin, size_t end, void *ctx) {
+    (void)ctx;
+    atomic_fetch_add(&for_calls, 1);
+    atomic_store(&for_begin, begin);
+    atomic_store(&for_end, end);
+}
+
+static void sum_reduce(size_t begin, size_t end, void *acc, void *ctx) {
+    (void)ctx;
+    for (size_t i = begin; i < end; i++) {
+        *(size_t*)acc += i;
+    }
+}
+
+static void sum_combine(void *acc, const void *other, void *ctx) {
+    (void)ctx;
+    *(size_t*)acc += *(const size_t*)other;
+}
+
+static void test_small_ranges(void) {
+    printf("Test 2: Empty and size-1 ranges...\n");
+
+    ol_parallel_pool_t *pool = ol_parallel_create(4);
+    TEST_ASSERT(pool != NULL, "Failed to create pool");
+
+    /* Empty (and reversed) ranges call nothing and leave the result alone */
+    atomic_store(&for_calls, 0);
+    TEST_ASSERT(ol_parallel_for(pool, 10, 10, 0, record_range, NULL) == 0, "For failed");
+    TEST_ASSERT(ol_parallel_for(pool, 10, 5, 1, record_range, NULL) == 0, "For failed");
+    TEST_ASSERT(atomic_load(&for_calls) == 0, "Body ran for an empty range");
+
+    span_acc_t span = { 0, 0, 0, 1 };
+    TEST_ASSERT(ol_parallel_reduce(pool, 3, 3, 0, &span, sizeof(span),
+                                   span_reduce, span_combine, NULL) == 0, "Reduce failed");
+    TEST_ASSERT(span.count == 0 && span.ordered, "Empty reduce changed the result");
+
+    size_t sum = 42;
+    TEST_ASSERT(ol_parallel_reduce(pool, 0, 0, 1, &sum, sizeof(sum),
+                                   sum_reduce, sum_combine, NULL) == 0, "Reduce failed");
+    TEST_ASSERT(sum == 42, "Empty reduce changed the initial value");
+
+    /* One index: one call, whatever the grain */
+    static const size_t grains[] = { 0, 1, 64 };
+    for (size_t g = 0; g < sizeof(grains) / sizeof(grains[0]); g++) {
+        atomic_store(&for_calls, 0);
+        TEST_ASSERT(ol_parallel_for(pool, 7, 8, grains[g], record_range, NULL) == 0,
+                    "For failed");
+        TEST_ASSERT(atomic_load(&for_calls) == 1, "Size-1 range not run exactly once");
+        TEST_ASSERT(atomic_load(&for_begin) == 7 && atomic_load(&for_end) == 8,
+                    "Size-1 range has the wrong bounds");
+
+        sum = 100;
+        TEST_ASSERT(ol_parallel_reduce(pool, 7, 8, grains[g], &sum, sizeof(sum),
+                                       sum_reduce, sum_combine, NULL) == 0, "Reduce failed");
+        TEST_ASSERT(sum == 107, "Size-1 reduce result mismatch");
+    }
+
+    ol_parallel_destroy(pool);
+    printf("  PASS\n");
+}
+
+/* Test 3: a reduce started from inside a pool task runs on that worker
+ * and helps instead of blocking it */
+#define NESTED_OUTER 16
+#define NESTED_INNER 5000
+
+typedef struct {
+    ol_parallel_pool_t *pool;
+    size_t sums[NESTED_OUTER];
+    int rc[NESTED_OUTER];
+} nested_ctx_t;
+
+static void nested_body(size_t begin, size_t end, void *ctx) {
+    nested_ctx_t *n = (nested_ctx_t*)ctx;
+    for (size_t i = begin; i < end; i++) {
+        size_t sum = 0;
+        n->rc[i] = ol_parallel_reduce(n->pool, 0, NESTED_INNER * (i + 1), 16,
+                                      &sum, sizeof(sum), sum_reduce, sum_combine, NULL);
+        n->sums[i] = sum;
+    }
+}
+
+static void test_nested_reduce(void) {
+    printf("Test 3: Nested reduce from inside a worker...\n");
+
+    /* A single worker must not deadlock waiting on its own halves */
+    static const size_t threads[] = { 1, 4 };
+    for (size_t t = 0; t < sizeof(threads) / sizeof(threads[0]); t++) {
+        ol_parallel_pool_t *pool = ol_parallel_create(threads[t]);
+        TEST_ASSERT(pool != NULL, "Failed to create pool");
+
+        nested_ctx_t n;
+        memset(&n, 0, sizeof(n));
+        n.pool = pool;
+        TEST_ASSERT(ol_parallel_for(pool, 0, NESTED_OUTER, 1, nested_body, &n) == 0,
+                    "Outer loop failed");
+
+        for (size_t i = 0; i < NESTED_OUTER; i++) {
+            size_t len = NESTED_INNER * (i + 1);
+            TEST_ASSERT(n.rc[i] == 0, "Nested reduce failed");
+            TEST_ASSERT(n.sums[i] == len * (len - 1) / 2, "Nested reduce result mismatch");
+        }
+
+        ol_parallel_destroy(pool);
+    }
+
+    printf("  PASS\n");
+}
+
+/* Main test runner */
+int main(void) {
+    printf("=== Parallel Reduce Tests ===\n");
+
+    /* A join that never completes hangs rather than fails */
+    alarm(60);
+
+    test_reduce_ordered();
+    test_small_ranges();
+    test_nested_reduce();
+
+    printf("\n=== All Tests PASSED ===\n");
+    return 0;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file test_process_recv.c
+ * @brief Selective receive: matcher ctx reused across calls, ref replies
+ */
+
+#include "ol_common.h"
+#include "ol_actor_process.h"
+#include "ol_green_threads.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_ASSERT(cond, msg) \
+do { \
+    if (!(cond)) { \
+        fprintf(stderr, "FAIL: %s at %s:%d\n", msg, __FILE__, __LINE__); \
+        exit(1); \
+    } \
+} while(0)
+
+/* Accepts the int message equal to *ctx */
+static bool match_int(const void *data, size_t size, ol_pid_t sender, void *ctx) {
+    (void)sender;
+    return size == sizeof(int) && *(const int*)data == *(const int*)ctx;
+}
+
+static void send_int(ol_process_t *process, int value) {
+    TEST_ASSERT(ol_process_send(process, &value, sizeof(value), 0) == OL_SUCCESS, "Send failed");
+}
+
+static int recv_int(ol_process_t *process, int *want) {
+    void *data = NULL;
+    size_t size = 0;
+    int rc = ol_process_recv_match(process, match_int, want, &data, &size, NULL, 0);
+    if (rc == 1) {
+        TEST_ASSERT(size == sizeof(int) && *(int*)data == *want, "Wrong message received");
+        free(data);
+    }
+    return rc;
+}
+
+/* Runs a test body as a process entry, on its own mailbox */
+static void run_in_process(ol_process_entry_fn body) {
+    ol_process_t *process = ol_process_create(body, NULL, NULL, OL_PROCESS_HEAP_ONLY, 0);
+    TEST_ASSERT(process != NULL, "Failed to create process");
+    TEST_ASSERT(ol_gt_join(ol_process_green_thread(process)) == 0, "Join failed");
+    ol_process_destroy(process, OL_EXIT_NORMAL);
+}
+
+/* Test 1: a message rejected by one call is offered again to the next */
+static void recv_match_body(ol_process_t *process, void *arg) {
+    (void)arg;
+
+    send_int(process, 1);
+    send_int(process, 2);
+    send_int(process, 3);
+
+    /* Same matcher and ctx pointer, different answers between calls */
+    int want = 4;
+    TEST_ASSERT(recv_int(process, &want) == 0, "Nothing should match 4");
+    want = 2;
+    TEST_ASSERT(recv_int(process, &want) == 1, "Rejected message never offered again");
+    want = 1;
+    TEST_ASSERT(recv_int(process, &want) == 1, "Head message skipped");
+    want = 3;
+    TEST_ASSERT(recv_int(process, &want) == 1, "Tail message skipped");
+    TEST_ASSERT(recv_int(process, &want) == 0, "Mailbox should be empty");
+}
+
+static void test_recv_match_reused_ctx(void) {
+    printf("Test 1: Selective receive with a reused ctx...\n");
+    run_in_process(recv_match_body);
+    printf("  PASS\n");
+}
+
+/* Test 2: a reply sent with a ref is found behind untagged traffic */
+static void recv_ref_body(ol_process_t *process, void *arg) {
+    (void)arg;
+
+    uint64_t ref = ol_process_make_ref();
+    TEST_ASSERT(ref != 0, "Zero reference");
+    for (int i = 0; i < 100; i++) {
+        send_int(process, i);
+    }
+    int reply = 42;
+    TEST_ASSERT(ol_process_send_ref(process, &reply, sizeof(reply), 0, ref) == OL_SUCCESS, "Send with ref failed");
+
+    void *data = NULL;
+    size_t size = 0;
+    TEST_ASSERT(ol_process_recv_ref(process, ref, &data, &size, NULL, 0) == 1, "Reply not found");
+    TEST_ASSERT(size == sizeof(int) && *(int*)data == 42, "Wrong reply");
+    free(data);
+    TEST_ASSERT(ol_process_recv_ref(process, ref, &data, &size, NULL, 0) == 0, "Reply received twice");
+
+    /* The untagged traffic is still queued in order */
+    int want = 0;
+    TEST_ASSERT(recv_int(process, &want) == 1, "Untagged messages lost");
+}
+
+static void test_recv_ref(void) {
+    printf("Test 2: Receive by reference...\n");
+    run_in_process(recv_ref_body);
+    printf("  PASS\n");
+}
+
+/* Main test runner */
+int main(void) {
+    printf("=== Process Receive Tests ===\n");
+
+    TEST_ASSERT(ol_gt_scheduler_init() == 0, "Scheduler init failed");
+
+    test_recv_match_reused_ctx();
+    test_recv_ref();
+
+    ol_gt_scheduler_shutdown();
+
+    printf("\n=== All Tests PASSED ===\n");
+    return 0;
+}